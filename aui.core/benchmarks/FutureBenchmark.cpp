@@ -4,12 +4,52 @@
 #include "AUI/Thread/AThreadPool.h"
 #include "AUI/Util/Assert.h"
 #include "AUI/Util/kAUI.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
 
 using namespace std::chrono_literals;
 
 static constexpr auto VALUE = 228;
 
+// Global allocation counter used to report heap allocations per future. Replacing global operator new affects the
+// whole Benchmarks executable (and aui.core when it's linked as a shared library on ELF platforms), so the counter is
+// a single relaxed atomic increment.
+static std::atomic_size_t gAllocationCount = 0;
+
+void* operator new(std::size_t size) {
+    gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (auto p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+/**
+ * Counts heap allocations made by all threads while the benchmark loop is running and reports them as average per
+ * iteration.
+ */
+class AllocationsPerIteration {
+public:
+    explicit AllocationsPerIteration(benchmark::State& state)
+      : mState(state), mBegin(gAllocationCount.load(std::memory_order_relaxed)) {}
+    ~AllocationsPerIteration() {
+        mState.counters["allocs"] = benchmark::Counter(
+            double(gAllocationCount.load(std::memory_order_relaxed) - mBegin), benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    benchmark::State& mState;
+    std::size_t mBegin;
+};
+}   // namespace
+
 static void FutureImmediateValue(benchmark::State& state) {
+    AllocationsPerIteration allocations(state);
     for (auto _ : state) {
         AFuture f(VALUE);
         auto value = *f;
@@ -20,6 +60,7 @@ static void FutureImmediateValue(benchmark::State& state) {
 BENCHMARK(FutureImmediateValue);
 
 static void FutureSingleThread(benchmark::State& state) {
+    AllocationsPerIteration allocations(state);
     for (auto _ : state) {
         AFuture<int> f;
         f.supplyValue(VALUE);
@@ -32,6 +73,7 @@ BENCHMARK(FutureSingleThread);
 
 static void FutureMultiThread1(benchmark::State& state) {
     AThreadPool tp(1);
+    AllocationsPerIteration allocations(state);
     for (auto _ : state) {
         AFuture<int> f = tp * [] {
             return VALUE;  
@@ -63,4 +105,26 @@ static void FutureMultiThread2(benchmark::State& state) {
         benchmark::DoNotOptimize(value);
     }
 }
-BENCHMARK(FutureMultiThread2);
\ No newline at end of file
+BENCHMARK(FutureMultiThread2);
+
+static void ThreadPoolFireAndForget(benchmark::State& state) {
+    // tasks that fit to the inline buffer of AThreadPool::task are expected to not allocate (apart from amortized
+    // queue growth).
+    AThreadPool tp(1);
+    std::atomic_size_t done = 0;
+    std::size_t submitted = 0;
+    {
+        AllocationsPerIteration allocations(state);
+        for (auto _ : state) {
+            tp.run([&done, value = VALUE] {
+                benchmark::DoNotOptimize(value);
+                done.fetch_add(1, std::memory_order_release);
+            });
+            ++submitted;
+        }
+    }
+    while (done.load(std::memory_order_acquire) != submitted) {
+        std::this_thread::yield();
+    }
+}
+BENCHMARK(ThreadPoolFireAndForget);
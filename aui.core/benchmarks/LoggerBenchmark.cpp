@@ -0,0 +1,109 @@
+// AUI Framework - Declarative UI toolkit for modern C++20
+// Copyright (C) 2020-2025 Alex2772 and Contributors
+//
+// SPDX-License-Identifier: MPL-2.0
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <thread>
+#include "AUI/Logging/ALogger.h"
+
+#if AUI_PLATFORM_UNIX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Measures log entries/sec of ALogger in synchronous and asynchronous modes with 1..N threads logging concurrently
+// to a log file.
+//
+// Logger's stdout output is redirected to /dev/null during the benchmark (on unix only).
+//
+// Run:
+// Benchmarks --benchmark_filter=Logger.*
+
+namespace {
+
+/**
+ * Redirects stdout to /dev/null while alive.
+ */
+struct SilenceStdout {
+#if AUI_PLATFORM_UNIX
+    int saved = -1;
+    SilenceStdout() {
+        fflush(stdout);
+        saved = dup(STDOUT_FILENO);
+        int devNull = open("/dev/null", O_WRONLY);
+        dup2(devNull, STDOUT_FILENO);
+        close(devNull);
+    }
+    ~SilenceStdout() {
+        fflush(stdout);
+        dup2(saved, STDOUT_FILENO);
+        close(saved);
+    }
+#endif
+};
+
+ALogger* gLogger = nullptr;
+SilenceStdout* gSilence = nullptr;
+
+APath logPath() {
+    return APath::getDefaultPath(APath::TEMP).makeDirs() / "aui.logger_benchmark.log";
+}
+
+void runLogging(benchmark::State& state) {
+    std::size_t i = 0;
+    for (auto _ : state) {
+        gLogger->log(ALogger::INFO, "Benchmark") << "entry " << i++ << " of thread " << state.thread_index();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void LoggerSync(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        gSilence = new SilenceStdout;
+        gLogger = new ALogger(logPath());
+    }
+    runLogging(state);
+    if (state.thread_index() == 0) {
+        delete gLogger;
+        delete gSilence;
+    }
+}
+BENCHMARK(LoggerSync)->ThreadRange(1, 8)->UseRealTime();
+
+void LoggerAsync(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        gSilence = new SilenceStdout;
+        gLogger = new ALogger(logPath());
+        gLogger->enableAsync();
+    }
+    runLogging(state);
+    if (state.thread_index() == 0) {
+        // includes time to write out the staged entries.
+        gLogger->flush();
+        delete gLogger;
+        delete gSilence;
+    }
+}
+BENCHMARK(LoggerAsync)->ThreadRange(1, 8)->UseRealTime();
+
+void LoggerAsyncDrop(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        gSilence = new SilenceStdout;
+        gLogger = new ALogger(logPath());
+        gLogger->enableAsync({ .overflowPolicy = ALogger::OverflowPolicy::DROP });
+    }
+    runLogging(state);
+    if (state.thread_index() == 0) {
+        state.counters["dropped"] = double(gLogger->droppedCount());
+        delete gLogger;
+        delete gSilence;
+    }
+}
+BENCHMARK(LoggerAsyncDrop)->ThreadRange(1, 8)->UseRealTime();
+
+}   // namespace
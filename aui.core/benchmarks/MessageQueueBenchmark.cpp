@@ -0,0 +1,73 @@
+// AUI Framework - Declarative UI toolkit for modern C++20
+// Copyright (C) 2020-2025 Alex2772 and Contributors
+//
+// SPDX-License-Identifier: MPL-2.0
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "AUI/Util/AMessageQueue.h"
+#include "AUI/Util/ALockFreeMessageQueue.h"
+
+// Compares mutex-guarded AMessageQueue with ALockFreeMessageQueue (used by AAbstractThread) in the scenario of many
+// threads posting short messages to a single consumer (i.e., worker threads posting progress updates to UI thread).
+// Each benchmark is parametrized by producer count.
+//
+// Run:
+// Benchmarks --benchmark_filter=MessageQueue.*
+
+namespace {
+
+constexpr auto MESSAGES_PER_PRODUCER = 100'000;
+
+void producerCounts(benchmark::internal::Benchmark* b) {
+    const auto max = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+    for (unsigned i = 1; i < max; i *= 2) {
+        b->Arg(i);
+    }
+    b->Arg(max);
+}
+
+template<typename Queue>
+void runProducersAndConsumer(benchmark::State& state, Queue& queue) {
+    const auto producerCount = state.range(0);
+    const auto total = std::size_t(producerCount) * MESSAGES_PER_PRODUCER;
+    for (auto _ : state) {
+        std::size_t processed = 0;
+        std::vector<std::thread> producers;
+        producers.reserve(producerCount);
+        for (int p = 0; p < producerCount; ++p) {
+            producers.emplace_back([&] {
+                for (int i = 0; i < MESSAGES_PER_PRODUCER; ++i) {
+                    queue.enqueue([&processed] { ++processed; });
+                }
+            });
+        }
+        while (processed != total) {
+            queue.processMessages();
+        }
+        for (auto& t : producers) {
+            t.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * total);
+}
+
+void MessageQueueMutex(benchmark::State& state) {
+    AMessageQueue<> queue;
+    runProducersAndConsumer(state, queue);
+}
+BENCHMARK(MessageQueueMutex)->Apply(producerCounts)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+void MessageQueueLockFree(benchmark::State& state) {
+    ALockFreeMessageQueue<> queue;
+    runProducersAndConsumer(state, queue);
+}
+BENCHMARK(MessageQueueLockFree)->Apply(producerCounts)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+}   // namespace
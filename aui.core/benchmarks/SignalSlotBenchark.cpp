@@ -37,3 +37,50 @@ static void SignalSlot(benchmark::State& state) {
     }
 }
 BENCHMARK(SignalSlot);
+
+/**
+ * Each thread emits its own signal. Unrelated signals must not contend with each other, so throughput should scale
+ * with thread count.
+ */
+static void SignalSlotMultithreadedUnrelated(benchmark::State& state) {
+    auto emitter = _new<Emitter>();
+    auto receiver = _new<Receiver>();
+    AObject::connect(emitter->test, AUI_SLOT(receiver)::receive);
+
+    for (auto _ : state) {
+        emitter->makeSignal();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(SignalSlotMultithreadedUnrelated)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * All threads emit signals connected to the same receiver while another thread keeps connecting and disconnecting
+ * slots on the same signals.
+ */
+static void SignalSlotMultithreadedConnectDuringEmit(benchmark::State& state) {
+    static _<Receiver> receiver;
+    static AVector<_<Emitter>> emitters;
+    if (state.thread_index() == 0) {
+        receiver = _new<Receiver>();
+        emitters.clear();
+        for (int i = 0; i < state.threads(); ++i) {
+            emitters << _new<Emitter>();
+            AObject::connect(emitters.last()->test, AUI_SLOT(receiver)::receive);
+        }
+    }
+    // google benchmark synchronizes threads before the first iteration, so emitters are initialized here.
+    for (auto _ : state) {
+        if (state.thread_index() == 0) {
+            auto connection = AObject::connect(emitters.first()->test, AUI_SLOT(receiver)::receive);
+            connection->disconnect();
+        }
+        emitters[state.thread_index()]->makeSignal();
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        emitters.clear();
+        receiver = nullptr;
+    }
+}
+BENCHMARK(SignalSlotMultithreadedConnectDuringEmit)->ThreadRange(1, 8)->UseRealTime();
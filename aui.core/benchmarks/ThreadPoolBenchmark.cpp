@@ -0,0 +1,118 @@
+// AUI Framework - Declarative UI toolkit for modern C++20
+// Copyright (C) 2020-2025 Alex2772 and Contributors
+//
+// SPDX-License-Identifier: MPL-2.0
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <thread>
+#include "AUI/Thread/AThreadPool.h"
+#include "AUI/Thread/AThread.h"
+
+// Measures how AThreadPool scales with worker count. Each benchmark is parametrized by worker count (1..N, where N is
+// hardware concurrency). Tasks are deliberately short (a few hundred nanoseconds) so the scheduling overhead
+// dominates.
+//
+// Run:
+// Benchmarks --benchmark_filter=ThreadPool.*
+
+namespace {
+
+constexpr auto TASK_COUNT = 100'000;
+
+void shortWork() {
+    std::uint64_t v = 0;
+    for (int i = 0; i < 64; ++i) {
+        v = v * 6364136223846793005ull + 1442695040888963407ull;
+    }
+    benchmark::DoNotOptimize(v);
+}
+
+void waitUntil(const std::atomic_size_t& counter, size_t expected) {
+    while (counter.load(std::memory_order_acquire) != expected) {
+        std::this_thread::yield();
+    }
+}
+
+void workerCounts(benchmark::internal::Benchmark* b) {
+    const auto max = std::max(std::thread::hardware_concurrency(), 1u);
+    for (unsigned i = 1; i < max; i *= 2) {
+        b->Arg(i);
+    }
+    b->Arg(max);
+}
+
+/**
+ * Submits short tasks from a non-worker thread (injection queues).
+ */
+void ThreadPoolExternalSubmit(benchmark::State& state) {
+    AThreadPool tp(state.range(0));
+    for (auto _ : state) {
+        std::atomic_size_t done = 0;
+        for (int i = 0; i < TASK_COUNT; ++i) {
+            tp.run([&] {
+                shortWork();
+                done.fetch_add(1, std::memory_order_release);
+            });
+        }
+        waitUntil(done, TASK_COUNT);
+    }
+    state.SetItemsProcessed(state.iterations() * TASK_COUNT);
+}
+BENCHMARK(ThreadPoolExternalSubmit)->Apply(workerCounts)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/**
+ * Submits a few root tasks, each of them spawns short tasks from inside of a worker (worker-local deques + stealing).
+ */
+void ThreadPoolSpawnFromWorker(benchmark::State& state) {
+    AThreadPool tp(state.range(0));
+    const size_t roots = state.range(0);
+    for (auto _ : state) {
+        std::atomic_size_t done = 0;
+        for (size_t r = 0; r < roots; ++r) {
+            tp.run([&, count = TASK_COUNT / roots] {
+                for (size_t i = 0; i < count; ++i) {
+                    tp.run([&] {
+                        shortWork();
+                        done.fetch_add(1, std::memory_order_release);
+                    });
+                }
+            });
+        }
+        waitUntil(done, TASK_COUNT / roots * roots);
+    }
+    state.SetItemsProcessed(state.iterations() * TASK_COUNT);
+}
+BENCHMARK(ThreadPoolSpawnFromWorker)->Apply(workerCounts)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/**
+ * Recursive binary fork: every task spawns two children until the depth is exhausted. Only one task is submitted
+ * externally, so all parallelism comes from stealing.
+ */
+void forkTree(AThreadPool& tp, std::atomic_size_t& done, int depth) {
+    shortWork();
+    done.fetch_add(1, std::memory_order_release);
+    if (depth == 0) {
+        return;
+    }
+    tp.run([&tp, &done, depth] { forkTree(tp, done, depth - 1); });
+    tp.run([&tp, &done, depth] { forkTree(tp, done, depth - 1); });
+}
+
+void ThreadPoolForkTree(benchmark::State& state) {
+    static constexpr int DEPTH = 16;
+    AThreadPool tp(state.range(0));
+    for (auto _ : state) {
+        std::atomic_size_t done = 0;
+        tp.run([&] { forkTree(tp, done, DEPTH); });
+        waitUntil(done, (1u << (DEPTH + 1)) - 1);
+    }
+    state.SetItemsProcessed(state.iterations() * ((1u << (DEPTH + 1)) - 1));
+}
+BENCHMARK(ThreadPoolForkTree)->Apply(workerCounts)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+}   // namespace
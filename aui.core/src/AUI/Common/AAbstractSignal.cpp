@@ -15,22 +15,20 @@
 #include "AObject.h"
 
 void AAbstractSignal::addIngoingConnectionIn(aui::no_escape<AObjectBase> object, _<Connection> connection) {
-    std::unique_lock lock(AObjectBase::SIGNAL_SLOT_GLOBAL_SYNC);
+    std::unique_lock lock(object->mIngoingConnectionsLock);
     object->mIngoingConnections.emplace_back(std::move(connection));
 }
 
-void AAbstractSignal::removeIngoingConnectionIn(aui::no_escape<AObjectBase> object, Connection& connection, std::unique_lock<ASpinlockMutex>& lock) {
-    auto c = [&]() -> _<Connection> {
-        auto it = ranges::find(object->mIngoingConnections, &connection, [](const auto& v) { return v.value.get(); });
-        if (it == object->mIngoingConnections.end()) {
-            return nullptr;
-        }
-        auto value = std::exchange(it->value, nullptr);
-        object->mIngoingConnections.erase(it);
-        lock.unlock();
-        return value;
-    }();
-    c.reset();
+_<AAbstractSignal::Connection> AAbstractSignal::removeIngoingConnectionIn(aui::no_escape<AObjectBase> object, Connection& connection) {
+    std::unique_lock lock(object->mIngoingConnectionsLock);
+    auto it = ranges::find(object->mIngoingConnections, &connection, [](const auto& v) { return v.value.get(); });
+    if (it == object->mIngoingConnections.end()) {
+        return nullptr;
+    }
+    // steal the value so ReceiverConnectionOwner destructor does not call onBeforeReceiverSideDestroyed.
+    auto value = std::exchange(it->value, nullptr);
+    object->mIngoingConnections.erase(it);
+    return value;
 }
 
 _weak<AObject> AAbstractSignal::weakPtrFromObject(AObject* object) {
@@ -468,6 +468,9 @@ protected:
 
     /**
      * @brief Removes a connection from the specified object.
+     * @return object's reference to the connection, if any. The caller is responsible to release it outside of its
+     * locks, as it may be the last reference to the connection.
      */
-    static void removeIngoingConnectionIn(aui::no_escape<AObjectBase> object, Connection& connection, std::unique_lock<ASpinlockMutex>& lock);
+    [[nodiscard]]
+    static _<Connection> removeIngoingConnectionIn(aui::no_escape<AObjectBase> object, Connection& connection);
 };
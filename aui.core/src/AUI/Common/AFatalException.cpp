@@ -79,6 +79,7 @@ static void onSignal(int c, siginfo_t * info, void *_p __attribute__ ((__unused_
     AFatalException e(signalName, c);
 
     ALogger::err("SignalHandler") << "Caught signal: " << signalName << "(" << c << ")\n" << AStacktrace::capture(3);
+    ALogger::global().flush();
 
     switch (c) {
         default:
@@ -119,6 +120,7 @@ static void __cdecl onSignal(int c) {
     AFatalException e(signalName, c);
 
     ALogger::err("SignalHandler") << "Caught signal: " << signalName << "(" << c << ")\n" << AStacktrace::capture(3);
+    ALogger::global().flush();
 
     //throw e;
 }
@@ -14,11 +14,9 @@
 #include "AObjectBase.h"
 #include "AUI/Logging/ALogger.h"
 
-ASpinlockMutex AObjectBase::SIGNAL_SLOT_GLOBAL_SYNC;
-
 void AObjectBase::clearAllIngoingConnections() noexcept {
     auto incomingConnections = [&] {
-      std::unique_lock lock(SIGNAL_SLOT_GLOBAL_SYNC);
+      std::unique_lock lock(mIngoingConnectionsLock);
       return std::exchange(mIngoingConnections, {});
     }();
     incomingConnections.clear();
@@ -31,11 +31,11 @@ class API_AUI_CORE AObjectBase {
     friend class PropertyPrecomputedTest;
 
 public:
-    virtual ~AObjectBase() = default;
+    virtual ~AObjectBase() {
+        clearAllIngoingConnections();
+    }
     AObjectBase() = default;
 
-    static ASpinlockMutex SIGNAL_SLOT_GLOBAL_SYNC;
-
     AObjectBase(AObjectBase&& rhs) noexcept {
         operator=(std::move(rhs));
     }
@@ -109,4 +109,9 @@ private:
     };
 
     AVector<ReceiverConnectionOwner> mIngoingConnections;
+
+    /**
+     * @brief Guards mIngoingConnections.
+     */
+    ASpinlockMutex mIngoingConnectionsLock;
 };
@@ -12,7 +12,9 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
+#include <memory>
 #include "AUI/Common/ADeque.h"
 #include "AUI/Common/AObject.h"
 #include "AUI/Thread/AMutex.h"
@@ -109,7 +111,9 @@ public:
         return *this;
     }
 
-    virtual ~ASignal() noexcept = default;
+    virtual ~ASignal() noexcept {
+        clearAllOutgoingConnections();
+    }
 
     /**
      * @brief Check whether signal contains any connected slots or not.
@@ -120,9 +124,21 @@ public:
      */
     operator bool() const { return hasOutgoingConnections(); }
 
-    void clearAllOutgoingConnections() const noexcept override { mOutgoingConnections.clear(); }
+    void clearAllOutgoingConnections() const noexcept override {
+        auto removed = [&] {
+            std::unique_lock lock(mConnectionsLock);
+            mOutgoingConnections.count = 0;
+            return std::exchange(mOutgoingConnections.array, nullptr);
+        }();
+        if (removed) {
+            for (const auto& connection : *removed) {
+                connection->onSenderSideDestroyed();
+            }
+        }
+    }
+
     void clearAllOutgoingConnectionsWith(aui::no_escape<AObjectBase> object) const noexcept override {
-        clearOutgoingConnectionsIf([&](const _<ConnectionImpl>& p) { return p->receiverBase == object.ptr(); });
+        clearOutgoingConnectionsIf([&](const ConnectionImpl& c) { return c.receiverBase == object.ptr(); });
     }
 
     [[nodiscard]] bool hasOutgoingConnections() const noexcept {
@@ -130,9 +146,11 @@ public:
     }
 
     [[nodiscard]] bool hasOutgoingConnectionsWith(aui::no_escape<AObjectBase> object) const noexcept override {
-        return std::any_of(
-            mOutgoingConnections.begin(), mOutgoingConnections.end(),
-            [&](const SenderConnectionOwner& s) { return s.value->receiverBase == object.ptr(); });
+        auto connections = outgoingConnectionsSnapshot();
+        return connections && std::any_of(connections->begin(), connections->end(), [&](const _<ConnectionImpl>& c) {
+            std::unique_lock lock(c->sync);
+            return !c->toBeRemoved && c->receiverBase == object.ptr();
+        });
     }
 
     [[nodiscard]]
@@ -141,21 +159,34 @@ public:
     }
 
 private:
+    struct ConnectionImpl;
+    using ConnectionArray = AVector<_<ConnectionImpl>>;
+
     struct ConnectionImpl final : Connection {
         friend class ASignal;
 
         void disconnect() override {
-            std::unique_lock lock(AObjectBase::SIGNAL_SLOT_GLOBAL_SYNC);
-            unlinkInSenderSideOnly(lock);
-            if (!lock.owns_lock()) lock.lock();
-            unlinkInReceiverSideOnly(lock);
+            std::unique_lock lock(sync);
+            auto senderSide = unlinkInSenderSideOnly();
+            auto receiverSide = unlinkInReceiverSideOnly();
 
             receiverBase = nullptr;
             receiver = nullptr;
             sender = nullptr;
+            lock.unlock();
+            // senderSide and receiverSide may hold the last references to this connection; they are released after
+            // sync is unlocked.
         }
 
     private:
+        /**
+         * @brief Guards sender, receiverBase, receiver and toBeRemoved.
+         * @details
+         * Lock order: ConnectionImpl::sync, then ASignal::mConnectionsLock or AObjectBase's ingoing connections lock.
+         * The opposite order is never taken, so connections of unrelated signals and objects never contend.
+         */
+        ASpinlockMutex sync;
+
         /**
          * @brief Pointer to the sender signal.
          * Guaranteed to be valid until set to null.
@@ -189,141 +220,166 @@ private:
         /**
          * @brief Whether is connection to be removed.
          * @details
-         * When disconnected, this variable is set to `false`. This means the connection should be removed fromm ingoing
+         * When disconnected, this variable is set to `true`. This means the connection should be removed from ingoing
          * and outgoing connections arrays (of `AObject` and `ASignal`, respectively). Moreover, the connection marked
          * to be removed must not invoke its handler.
          */
         bool toBeRemoved = false;
 
         /**
-         * @brief Breaks connection in the receiver side.
+         * @brief Breaks connection in the receiver side. sync must be locked.
          * @details
-         * Called when `ASignal` has cleaned its connection instance.
-         *
          * This cleanup function assumes that an appropriate clean action for the sender side is taken.
+         * @return receiver's reference to this connection; should be released after sync is unlocked.
          */
-        void unlinkInReceiverSideOnly(std::unique_lock<ASpinlockMutex>& lock) {
+        [[nodiscard]]
+        _<Connection> unlinkInReceiverSideOnly() {
             toBeRemoved = true;
 
             auto receiverLocal = std::exchange(receiverBase, nullptr);
             if (!receiverLocal) {
-                return;
+                return nullptr;
             }
             receiver = nullptr;
-            removeIngoingConnectionIn(receiverLocal, *this, lock);
+            return removeIngoingConnectionIn(receiverLocal, *this);
         }
 
-        void unlinkInSenderSideOnly(std::unique_lock<ASpinlockMutex>& lock) {
+        /**
+         * @brief Breaks connection in the sender side. sync must be locked.
+         * @return previous connection array of the sender; should be released after sync is unlocked.
+         */
+        [[nodiscard]]
+        std::shared_ptr<const ConnectionArray> unlinkInSenderSideOnly() {
             toBeRemoved = true;
             auto localSender = std::exchange(sender, nullptr);
             if (!localSender) {
-                return;
-            }
-
-            // As we marked toBeRemoved, we are not required to do anything further. However, we can perform a cheap
-            // operation to clean the connection right now. If we fail at some point we can leave it as is.
-            // invokeSignal will clean the connection for us at some point.
-            auto it = std::find_if(
-                localSender->mOutgoingConnections.begin(), localSender->mOutgoingConnections.end(),
-                [&](const SenderConnectionOwner& o) { return o.value.get() == this; });
-            if (it == localSender->mOutgoingConnections.end()) {
-                // It can happen probably when another thread is performing invocation on this signal and stole the
-                // mOutgoingConnections array.
-                return;
+                return nullptr;
             }
-            // it->value may be unique owner of this, let's steal the ownership before erasure to keep things safe.
-            auto self = std::exchange(it->value, nullptr);
-            localSender->mOutgoingConnections.erase(it);
-            lock.unlock();
+            std::unique_lock lock(localSender->mConnectionsLock);
+            return localSender->modifyConnections([&](ConnectionArray& connections) {
+                connections.removeIf([&](const _<ConnectionImpl>& c) { return c.get() == this; });
+            });
         }
 
         void onBeforeReceiverSideDestroyed() override {
-            std::unique_lock lock(AObjectBase::SIGNAL_SLOT_GLOBAL_SYNC);
+            std::unique_lock lock(sync);
             // this function can be called by receiver's AObject cleanup functions (presumably, destructor), so we
             // assume receiver (and thus receiverBase) are invalid.
             receiver = nullptr;
             receiverBase = nullptr;
-            unlinkInSenderSideOnly(lock);
+            auto senderSide = unlinkInSenderSideOnly();
+            lock.unlock();
+        }
+
+        /**
+         * @brief Called when the sender signal drops this connection (i.e., the signal is being destroyed).
+         */
+        void onSenderSideDestroyed() noexcept {
+            std::unique_lock lock(sync);
+            sender = nullptr;
+            auto receiverSide = unlinkInReceiverSideOnly();
+            lock.unlock();
         }
     };
 
     /**
-     * @brief Connection owner which destroys the connection from the sender side in destructor.
+     * @brief Copy-on-write array of outgoing connections.
+     * @details
+     * The array itself is immutable once published. invokeSignal takes a snapshot (a reference-counted pointer copy)
+     * under mConnectionsLock and iterates over it without holding any lock; connect and disconnect publish a modified
+     * copy. This way emission does not block and does not get blocked by modifications of unrelated signals.
      */
-    struct SenderConnectionOwner {
-        _<ConnectionImpl> value = nullptr;
-
-        SenderConnectionOwner() = default;
-        explicit SenderConnectionOwner(_<ConnectionImpl> connection) noexcept : value(std::move(connection)) {}
-        SenderConnectionOwner(const SenderConnectionOwner&) = default;
-        SenderConnectionOwner(SenderConnectionOwner&&) noexcept = default;
-        SenderConnectionOwner& operator=(const SenderConnectionOwner& rhs) {
-            if (this == &rhs) {
-                return *this;
-            }
-            release();
-            value = rhs;
-            return *this;
-        }
-        SenderConnectionOwner& operator=(SenderConnectionOwner&& rhs) noexcept {
-            if (this == &rhs) {
-                return *this;
-            }
-            release();
-            value = std::move(rhs.value);
-            return *this;
-        }
+    struct ConnectionList {
+        std::shared_ptr<const ConnectionArray> array;
+
+        /**
+         * @brief Size of array, readable without mConnectionsLock.
+         */
+        std::atomic_size_t count = 0;
 
-        ~SenderConnectionOwner() {
-            release();
+        [[nodiscard]]
+        std::size_t size() const noexcept {
+            return count.load(std::memory_order_relaxed);
         }
 
-    private:
-        void release() noexcept {
-            if (!value) {
-                return;
-            }
-            {
-                std::unique_lock lock(AObjectBase::SIGNAL_SLOT_GLOBAL_SYNC);
-                // this destructor can be called in ASignal destructor, so it's worth to reset the sender as well.
-                value->sender = nullptr;
-                value->unlinkInReceiverSideOnly(lock);
-            }
-            // releasing lock before value = nullptr.
-            // destroying `value` object could trigger a cascade of destructions, leading to a re-entrant lock
-            // attempt on a non-recursive mutex.
-            value = nullptr;
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return size() == 0;
         }
     };
 
-    mutable AVector<SenderConnectionOwner> mOutgoingConnections;
+    mutable ConnectionList mOutgoingConnections;
+
+    /**
+     * @brief Guards mOutgoingConnections.array.
+     */
+    mutable ASpinlockMutex mConnectionsLock;
     ASpinlockMutex mLoopGuard;
 
     void invokeSignal(AObject* sender, std::tuple<const Args&...> args = {});
 
+    [[nodiscard]]
+    std::shared_ptr<const ConnectionArray> outgoingConnectionsSnapshot() const {
+        std::unique_lock lock(mConnectionsLock);
+        return mOutgoingConnections.array;
+    }
+
+    /**
+     * @brief Publishes a modified copy of the connection array. mConnectionsLock must be locked.
+     * @return previous array; should be released after mConnectionsLock is unlocked, as it may hold the last references
+     * to connections.
+     */
+    template <typename Modifier>
+    std::shared_ptr<const ConnectionArray> modifyConnections(Modifier&& modifier) const {
+        auto copy = mOutgoingConnections.array ? std::make_shared<ConnectionArray>(*mOutgoingConnections.array)
+                                               : std::make_shared<ConnectionArray>();
+        modifier(*copy);
+        mOutgoingConnections.count = copy->size();
+        if (copy->empty()) {
+            copy = nullptr;
+        }
+        return std::exchange(mOutgoingConnections.array, std::move(copy));
+    }
+
+    /**
+     * @brief Appends a connection. mConnectionsLock must be locked.
+     * @details
+     * Unlike modifyConnections, the array is modified in place if no snapshot of it is alive, so connecting N slots
+     * does not cost O(N^2). Snapshots are taken under mConnectionsLock only, so a unique array can't get shared
+     * during the modification.
+     */
+    void appendConnection(_<ConnectionImpl> connection) const {
+        auto& array = mOutgoingConnections.array;
+        if (array && array.use_count() == 1) {
+            // pairs with the release decrement of the last snapshot owner, so its reads happen before our write.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            // the array is always created as non-const by modifyConnections.
+            const_cast<ConnectionArray&>(*array) << std::move(connection);
+            mOutgoingConnections.count = array->size();
+            return;
+        }
+        auto prev = modifyConnections([&](ConnectionArray& connections) { connections << std::move(connection); });
+        // prev can't hold the last references: the connections are copied to the new array.
+    }
+
     /**
      * @brief Helper function for AObject::connect to make connection.
      */
     template <aui::convertible_to<AObjectBase*> Object, aui::not_overloaded_lambda Lambda>
-    const _<ConnectionImpl>& connect(Object objectBase, Lambda&& lambda) {
+    _<ConnectionImpl> connect(Object objectBase, Lambda&& lambda) {
         AObject* object = nullptr;
         if constexpr (std::is_base_of_v<AObject, std::remove_pointer_t<Object>>) {
             object = objectBase;
         }
-        const auto& connection = [&]() -> _<ConnectionImpl>& {
-            auto conn = _new<ConnectionImpl>();
-            conn->sender = this;
-            conn->receiverBase = objectBase;
-            conn->receiver = object;
-            conn->func = ::aui::detail::signal::makeRawInvocable<Lambda&&, Args...>(std::forward<Lambda>(lambda));
-            std::unique_lock lock(AObjectBase::SIGNAL_SLOT_GLOBAL_SYNC);
-
-            std::erase_if(mOutgoingConnections, [](const SenderConnectionOwner& o) {
-                return o.value == nullptr;
-            });
-
-            return mOutgoingConnections.emplace_back(std::move(conn)).value;
-        }();
+        auto connection = _new<ConnectionImpl>();
+        connection->sender = this;
+        connection->receiverBase = objectBase;
+        connection->receiver = object;
+        connection->func = ::aui::detail::signal::makeRawInvocable<Lambda&&, Args...>(std::forward<Lambda>(lambda));
+        {
+            std::unique_lock lock(mConnectionsLock);
+            appendConnection(connection);
+        }
         if (objectBase != AObject::GENERIC_OBSERVER) {
             addIngoingConnectionIn(objectBase, connection);
         }
@@ -338,23 +394,30 @@ private:
 private:
     template <typename Predicate>
     void clearOutgoingConnectionsIf(Predicate&& predicate) const noexcept {
-        /*
-         * Removal of connections before end of execution of clearOutgoingConnectionsIf may cause this ASignal
-         * destruction, causing undefined behaviour. Destructing these connections after mSlotsLock unlocking solves the
-         * problem.
-         */
-        AVector<SenderConnectionOwner> slotsToRemove;
-
-        slotsToRemove.reserve(mOutgoingConnections.size());
-        mOutgoingConnections.removeIf([&slotsToRemove, predicate = std::move(predicate)](SenderConnectionOwner& p) {
-            if (predicate(p.value)) {
-                slotsToRemove << std::move(p);
-                return true;
+        auto connections = outgoingConnectionsSnapshot();
+        if (!connections) {
+            return;
+        }
+        ConnectionArray toRemove;
+        for (const auto& c : *connections) {
+            std::unique_lock lock(c->sync);
+            if (predicate(std::as_const(*c))) {
+                toRemove << c;
             }
-            return false;
-        });
-
-        slotsToRemove.clear();
+        }
+        if (toRemove.empty()) {
+            return;
+        }
+        {
+            std::unique_lock lock(mConnectionsLock);
+            auto prev = modifyConnections([&](ConnectionArray& connections) {
+                connections.removeIf([&](const _<ConnectionImpl>& c) { return toRemove.contains(c); });
+            });
+            lock.unlock();
+        }
+        for (const auto& c : toRemove) {
+            c->onSenderSideDestroyed();
+        }
     }
 };
 #include <AUI/Thread/AThread.h>
@@ -372,32 +435,19 @@ void ASignal<Args...>::invokeSignal(AObject* sender, std::tuple<const Args&...>
         }
     }
 
-    std::unique_lock lock(AObjectBase::SIGNAL_SLOT_GLOBAL_SYNC);
-    std::unique_lock lock2(mLoopGuard, std::try_to_lock);
-    if (!lock2.owns_lock()) {
+    std::unique_lock loopGuard(mLoopGuard, std::try_to_lock);
+    if (!loopGuard.owns_lock()) {
         throw AEvaluationLoopException();
     }
-    auto outgoingConnections = std::move(mOutgoingConnections);   // needed to safely iterate through the slots
-    ARaiiHelper returnBack = [&] {
-        if (!lock.owns_lock()) lock.lock();
-        AUI_MARK_AS_USED(senderPtr);
-        AUI_MARK_AS_USED(receiverPtr);
-
-        if (mOutgoingConnections.empty()) {
-            mOutgoingConnections = std::move(outgoingConnections);
-        } else {
-            // mSlots might have been modified by a single threaded signal call. In this case merge two vectors
-            mOutgoingConnections.insert(
-                mOutgoingConnections.begin(), std::make_move_iterator(outgoingConnections.begin()),
-                std::make_move_iterator(outgoingConnections.end()));
-        }
-    };
-    for (auto i = outgoingConnections.begin(); i != outgoingConnections.end();) {
-        _<ConnectionImpl>& outgoingConnection = i->value;
-        if (!lock.owns_lock()) lock.lock();
+
+    // snapshot of connections; connections made during emission will be called on the next emission.
+    auto outgoingConnections = outgoingConnectionsSnapshot();
+    if (!outgoingConnections) {
+        return;
+    }
+    for (const _<ConnectionImpl>& outgoingConnection : *outgoingConnections) {
+        std::unique_lock lock(outgoingConnection->sync);
         if (outgoingConnection->toBeRemoved) {
-            lock.unlock();
-            i = outgoingConnections.erase(i);
             continue;
         }
         _weak<AObject> receiverWeakPtr;
@@ -414,7 +464,9 @@ void ASignal<Args...>::invokeSignal(AObject* sender, std::tuple<const Args&...>
                  * destructed by shared_ptr but have not reached clearAllIngoingConnections() yet.
                  */
                 if (receiverWeakPtr.lock() != nullptr) {
-                    outgoingConnection->receiver->getThread()->enqueue(
+                    auto thread = outgoingConnection->receiver->getThread();
+                    lock.unlock();
+                    thread->enqueue(
                         [senderWeakPtr = senderPtr.weak(),
                          receiverWeakPtr = std::move(receiverWeakPtr),
                          connection = outgoingConnection,
@@ -444,7 +496,6 @@ void ASignal<Args...>::invokeSignal(AObject* sender, std::tuple<const Args&...>
                             }
                         });
                 }
-                ++i;
                 continue;
             }
         }
@@ -475,10 +526,8 @@ void ASignal<Args...>::invokeSignal(AObject* sender, std::tuple<const Args&...>
             }
         }
         if (AObject::isDisconnected()) {
-            i = outgoingConnections.erase(i);
-            continue;
+            outgoingConnection->disconnect();
         }
-        ++i;
     }
 }
 
@@ -11,25 +11,42 @@
 
 #include "ALogger.h"
 #include "AUI/Platform/AProcess.h"
+#include <bit>
+#include <condition_variable>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+#include <thread>
 
 #if AUI_PLATFORM_ANDROID
 #include <android/log.h>
 #else
-#include <ctime>
 #include <AUI/IO/AFileOutputStream.h>
-
 #endif
 
-ALogger::ALogger() {
-#ifdef AUI_SHARED_PTR_FIND_INSTANCES
-    log(WARN, "Performance",
-        "AUI_SHARED_PTR_FIND_INSTANCES is enabled which dramatically drops performance"
-        " since it creates stacktrace on every shared_ptr (_<T>) construction. Use it if"
-        " and only if it's actually needed.");
+#if !AUI_PLATFORM_WIN
+#include <cerrno>
+#include <climits>
+#include <sys/uio.h>
+#include <unistd.h>
 #endif
-}
 
-static const char* levelCStr(ALogger::Level level) {
+namespace {
+
+/**
+ * @brief Formatted log entry. Entries that fit in the inline storage don't allocate.
+ */
+using LineBuffer = fmt::basic_memory_buffer<char, 512>;
+
+/**
+ * @brief Part of a staging buffer to write out.
+ */
+struct Region {
+    const char* data;
+    std::size_t size;
+};
+
+const char* levelCStr(ALogger::Level level) {
     switch (level) {
         case ALogger::INFO:
             return "INFO";
@@ -50,6 +67,381 @@ static const char* levelCStr(ALogger::Level level) {
     return "UNKNOWN";
 }
 
+/**
+ * @brief Current time as `HH:MM:SS`.
+ * @details
+ * Cached per thread and recomputed only when the second changes, so localtime is not called on every entry.
+ */
+std::string_view currentTimeString() {
+    struct Cache {
+        std::time_t second = -1;
+        char buffer[16];
+        std::size_t length = 0;
+    };
+    thread_local Cache cache;
+
+    const auto t = std::time(nullptr);
+    if (t != cache.second) {
+        std::tm tm{};
+#if AUI_PLATFORM_WIN
+        localtime_s(&tm, &t);
+#else
+        localtime_r(&t, &tm);
+#endif
+        cache.length = std::strftime(cache.buffer, sizeof(cache.buffer), "%H:%M:%S", &tm);
+        cache.second = t;
+    }
+    return { cache.buffer, cache.length };
+}
+
+void formatLine(LineBuffer& out, ALogger::Level level, AStringView prefix, AStringView message) {
+    // AString is UTF-8 already, so thread name is formatted in place without conversion.
+    static const AString UNKNOWN_THREAD = "?";
+    const auto& thread = AThread::current();
+    const auto& threadName = thread ? thread->threadName() : UNKNOWN_THREAD;
+    auto it = std::back_inserter(out);
+    if (message.empty()) {
+        fmt::format_to(it, "[{}][{}][{}]: {}\n", currentTimeString(), threadName, levelCStr(level),
+                       std::string_view(prefix));
+    } else {
+        fmt::format_to(it, "[{}][{}][{}][{}]: {}\n", currentTimeString(), threadName, std::string_view(prefix),
+                       levelCStr(level), std::string_view(message));
+    }
+}
+
+/**
+ * @brief Writes regions to the stream with as few syscalls as possible.
+ */
+void writeRegions(FILE* stream, const AVector<Region>& regions) {
+#if AUI_PLATFORM_WIN
+    for (const auto& region : regions) {
+        fwrite(region.data, 1, region.size, stream);
+    }
+    fflush(stream);
+#else
+    // the stream might have been written with stdio by someone else; keep the order.
+    fflush(stream);
+    const int fd = fileno(stream);
+    AVector<iovec> iov;
+    iov.reserve(regions.size());
+    for (const auto& region : regions) {
+        iov << iovec { const_cast<char*>(region.data), region.size };
+    }
+    auto begin = iov.data();
+    auto end = iov.data() + iov.size();
+    while (begin != end) {
+        const auto count = std::min<std::ptrdiff_t>(end - begin, IOV_MAX);
+        auto written = ::writev(fd, begin, int(count));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        // skip fully written regions and adjust the partially written one.
+        while (begin != end && std::size_t(written) >= begin->iov_len) {
+            written -= begin->iov_len;
+            ++begin;
+        }
+        if (begin != end) {
+            begin->iov_base = static_cast<char*>(begin->iov_base) + written;
+            begin->iov_len -= written;
+        }
+    }
+#endif
+}
+
+/**
+ * @brief Single-producer single-consumer byte ring holding formatted entries of a single thread until the writer
+ * thread writes them out.
+ * @details
+ * Positions are monotonic; they are wrapped only on access. An entry is published at once, so the consumer never
+ * sees a partial entry.
+ */
+class StagingBuffer {
+public:
+    explicit StagingBuffer(std::size_t capacity)
+      : mCapacity(std::bit_ceil(std::max<std::size_t>(capacity, 256))), mData(new char[mCapacity]) {}
+
+    [[nodiscard]]
+    std::size_t capacity() const noexcept {
+        return mCapacity;
+    }
+
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+        return mTail.load(std::memory_order_acquire) - mHead.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Producer side.
+     * @return false if there's not enough space.
+     */
+    bool tryWrite(std::string_view line) noexcept {
+        const auto tail = mTail.load(std::memory_order_relaxed);
+        const auto head = mHead.load(std::memory_order_acquire);
+        if (mCapacity - (tail - head) < line.size()) {
+            return false;
+        }
+        const auto offset = tail & (mCapacity - 1);
+        const auto firstPart = std::min(line.size(), mCapacity - offset);
+        std::memcpy(mData.get() + offset, line.data(), firstPart);
+        std::memcpy(mData.get(), line.data() + firstPart, line.size() - firstPart);
+        mTail.store(tail + line.size(), std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Consumer side. Appends staged data to regions (up to 2 regions because of wrapping).
+     * @return position to pass to consume() when the regions are written.
+     */
+    std::size_t collect(AVector<Region>& regions) const {
+        const auto head = mHead.load(std::memory_order_relaxed);
+        const auto tail = mTail.load(std::memory_order_acquire);
+        if (head == tail) {
+            return tail;
+        }
+        const auto offset = head & (mCapacity - 1);
+        const auto firstPart = std::min(tail - head, mCapacity - offset);
+        regions << Region { mData.get() + offset, firstPart };
+        if (firstPart != tail - head) {
+            regions << Region { mData.get(), tail - head - firstPart };
+        }
+        return tail;
+    }
+
+    /**
+     * @brief Consumer side. Frees the space up to position returned by collect().
+     */
+    void consume(std::size_t position) noexcept { mHead.store(position, std::memory_order_release); }
+
+private:
+    const std::size_t mCapacity;
+    std::unique_ptr<char[]> mData;
+    alignas(64) std::atomic_size_t mHead = 0;
+    alignas(64) std::atomic_size_t mTail = 0;
+};
+
+}   // namespace
+
+/**
+ * @brief Staging buffers and writer thread of ALogger::enableAsync.
+ * @details
+ * The writer is a plain std::thread rather than AThread: logger is used by AThread itself and must outlive any
+ * AThread-related global state on application exit.
+ */
+struct ALogger::AsyncBackend {
+public:
+    AsyncBackend(ALogger& logger, AsyncOptions options)
+      : mLogger(logger), mOptions(options), mId(++ourLastId), mWriter([this] { run(); }) {}
+
+    /**
+     * @details
+     * Must be called when no producer is inside push(), so nothing can be staged after the final drain.
+     */
+    ~AsyncBackend() {
+        {
+            std::unique_lock lock(mWakeupSync);
+            mStopping = true;
+        }
+        mWakeupCV.notify_one();
+        if (mWriter.get_id() == std::this_thread::get_id()) {
+            // the writer thread itself causes application exit (i.e., crash in writev); can't join.
+            mWriter.detach();
+        } else {
+            mWriter.join();
+        }
+        drain();
+    }
+
+    /**
+     * @brief Stages an entry.
+     * @return false if the entry should be written synchronously by the caller.
+     */
+    bool push(std::string_view line, Level level) {
+        auto& buffer = stagingBuffer();
+        if (line.size() > buffer.capacity()) {
+            return false;
+        }
+        while (!buffer.tryWrite(line)) {
+            if (mOptions.overflowPolicy == OverflowPolicy::DROP) {
+                mDropped.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+            wakeWriter();
+            std::this_thread::yield();
+        }
+        if (level == ERR || buffer.size() >= buffer.capacity() / 2) {
+            wakeWriter();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Writes out everything staged so far. Can be called from any thread.
+     */
+    void drain() {
+        thread_local bool draining = false;
+        if (draining) {
+            // fatal signal is caught in the middle of drain() on this thread; mDrainSync is already locked.
+            return;
+        }
+        draining = true;
+        ARaiiHelper resetDraining = [] { draining = false; };
+        std::unique_lock drainLock(mDrainSync);
+        {
+            std::unique_lock lock(mRegistrySync);
+            // staging buffers of exited threads are referenced by the registry only.
+            mRegistry.removeIf([](const auto& entry) {
+                return entry.second.use_count() == 1 && entry.second->size() == 0;
+            });
+            mDrainBuffers.clear();
+            for (const auto& [threadId, buffer] : mRegistry) {
+                mDrainBuffers << buffer;
+            }
+        }
+
+        mDrainRegions.clear();
+        mDrainPositions.clear();
+        for (const auto& buffer : mDrainBuffers) {
+            mDrainPositions << buffer->collect(mDrainRegions);
+        }
+
+        LineBuffer droppedLine;
+        if (auto dropped = mDropped.exchange(0, std::memory_order_relaxed)) {
+            mDroppedTotal += dropped;
+            fmt::format_to(std::back_inserter(droppedLine), "[{}][Logger][Logger][WARN]: {} entries dropped\n",
+                           currentTimeString(), dropped);
+            mDrainRegions << Region { droppedLine.data(), droppedLine.size() };
+        }
+
+        if (!mDrainRegions.empty()) {
+            std::unique_lock lock(mLogger.mLogSync);
+#if !AUI_PLATFORM_ANDROID
+            writeRegions(stdout, mDrainRegions);
+#endif
+            if (mLogger.mLogFile && mLogger.mLogFile->nativeHandle()) {
+                writeRegions(mLogger.mLogFile->nativeHandle(), mDrainRegions);
+            }
+        }
+
+        for (std::size_t i = 0; i < mDrainBuffers.size(); ++i) {
+            mDrainBuffers[i]->consume(mDrainPositions[i]);
+        }
+        mDrainBuffers.clear();
+    }
+
+    [[nodiscard]]
+    std::size_t droppedCount() const noexcept {
+        std::unique_lock lock(mDrainSync);
+        return mDroppedTotal + mDropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    static inline std::atomic_uint64_t ourLastId = 0;
+
+    ALogger& mLogger;
+    const AsyncOptions mOptions;
+
+    /**
+     * @brief Unique id of the backend, used to validate thread local cache of the staging buffer.
+     */
+    const std::uint64_t mId;
+
+    std::mutex mRegistrySync;
+    AVector<std::pair<std::thread::id, std::shared_ptr<StagingBuffer>>> mRegistry;
+
+    /**
+     * @brief Serializes drain() calls. Guards the members below.
+     */
+    mutable std::mutex mDrainSync;
+    AVector<std::shared_ptr<StagingBuffer>> mDrainBuffers;
+    AVector<Region> mDrainRegions;
+    AVector<std::size_t> mDrainPositions;
+    std::size_t mDroppedTotal = 0;
+
+    std::atomic_size_t mDropped = 0;
+
+    std::mutex mWakeupSync;
+    std::condition_variable mWakeupCV;
+    std::atomic_bool mWakeupRequested = false;
+    std::atomic_bool mStopping = false;
+
+    std::thread mWriter;
+
+    StagingBuffer& stagingBuffer() {
+        struct Cache {
+            std::uint64_t backendId = 0;
+            std::shared_ptr<StagingBuffer> buffer;
+        };
+        thread_local Cache cache;
+        if (cache.backendId == mId) {
+            return *cache.buffer;
+        }
+
+        // either first entry of this thread or the thread logs to several loggers.
+        std::unique_lock lock(mRegistrySync);
+        const auto threadId = std::this_thread::get_id();
+        auto it = std::find_if(mRegistry.begin(), mRegistry.end(), [&](const auto& e) { return e.first == threadId; });
+        if (it == mRegistry.end()) {
+            mRegistry << std::make_pair(threadId, std::make_shared<StagingBuffer>(mOptions.bufferSize));
+            it = mRegistry.end() - 1;
+        }
+        cache = { mId, it->second };
+        return *cache.buffer;
+    }
+
+    void wakeWriter() {
+        if (mWakeupRequested.load(std::memory_order_relaxed) || mWakeupRequested.exchange(true)) {
+            // already requested; the writer is going to drain the buffers anyway.
+            return;
+        }
+        std::unique_lock lock(mWakeupSync);
+        mWakeupCV.notify_one();
+    }
+
+    void run() {
+        std::unique_lock lock(mWakeupSync);
+        while (!mStopping) {
+            mWakeupCV.wait_for(lock, mOptions.flushInterval, [&] { return mWakeupRequested.load() || mStopping; });
+            mWakeupRequested = false;
+            lock.unlock();
+            drain();
+            lock.lock();
+        }
+    }
+};
+
+/**
+ * @brief Pins ALogger::mAsync for the scope so ~ALogger does not destroy the backend in the middle of the call.
+ */
+struct ALogger::AsyncGuard {
+public:
+    explicit AsyncGuard(const ALogger& logger) : mUsers(logger.mAsyncUsers) {
+        // seq_cst pairs with ~ALogger: either the destructor sees the increment and waits, or we see nullptr.
+        mUsers.fetch_add(1);
+        backend = logger.mAsync.load();
+    }
+
+    ~AsyncGuard() { mUsers.fetch_sub(1, std::memory_order_release); }
+
+    AsyncBackend* backend;
+
+private:
+    std::atomic_size_t& mUsers;
+};
+
+ALogger::ALogger() {
+#ifdef AUI_SHARED_PTR_FIND_INSTANCES
+    log(WARN, "Performance",
+        "AUI_SHARED_PTR_FIND_INSTANCES is enabled which dramatically drops performance"
+        " since it creates stacktrace on every shared_ptr (_<T>) construction. Use it if"
+        " and only if it's actually needed.");
+#endif
+}
+
+ALogger::ALogger(AString filename) { setLogFileImpl(std::move(filename)); }
+
 static ALogger& globalImpl(AOptional<APath> path = std::nullopt) {
 #if AUI_PLATFORM_EMSCRIPTEN
     static ALogger l;
@@ -98,75 +490,86 @@ void ALogger::log(Level level, AStringView prefix, AStringView message) {
         __android_log_print(prio, prefix.data(), "%s", message.data());
     }
 
-    if (mLogFile) {
-        std::time_t t = std::time(nullptr);
-        std::tm* tm;
-        tm = localtime(&t);
-        const char* levelName = levelCStr(level);
-        char timebuf[64];
-        std::strftime(timebuf, sizeof(timebuf), "%H:%M:%S", tm);
+    if (!mLogFile) {
+        // logcat is the only output.
+        return;
+    }
+#endif
 
-        std::string threadName;
-        if (auto currentThread = AThread::current()) {
-            threadName = currentThread->threadName().toStdString();
-        } else {
-            threadName = "?";
+    LineBuffer line;
+    formatLine(line, level, prefix, message);
+    const std::string_view lineView(line.data(), line.size());
+    {
+        AsyncGuard async(*this);
+        if (async.backend && async.backend->push(lineView, level)) {
+            return;
         }
+    }
+    writeSync(lineView);
+}
 
-        std::unique_lock lock(mLogSync);
-        if (message.length() == 0) {
-            fprintf(
-                mLogFile->nativeHandle(), "[%s][%s][%s]: %s\n", timebuf, threadName.c_str(), levelName, prefix.data());
-        } else {
-            fprintf(mLogFile->nativeHandle(), "[%s][%s][%s][%s]: %s\n", timebuf, threadName.c_str(), prefix.data(),
-                    levelName, message.data());
-        }
+void ALogger::writeSync(std::string_view line) {
+    std::unique_lock lock(mLogSync);
+#if !AUI_PLATFORM_ANDROID
+    fwrite(line.data(), 1, line.size(), stdout);
+    fflush(stdout);
+#endif
+    if (mLogFile && mLogFile->nativeHandle()) {
+        fwrite(line.data(), 1, line.size(), mLogFile->nativeHandle());
         fflush(mLogFile->nativeHandle());
     }
+}
 
+void ALogger::enableAsync(AsyncOptions options) {
+#if AUI_PLATFORM_EMSCRIPTEN
+    // no threads; stay synchronous.
+    (void)options;
 #else
-    std::time_t t = std::time(nullptr);
-    std::tm* tm;
-    tm = localtime(&t);
-    char timebuf[64];
-    std::strftime(timebuf, sizeof(timebuf), "%H:%M:%S", tm);
-
-    std::string threadName;
-    if (auto currentThread = AThread::current()) {
-        threadName = currentThread->threadName().toStdString();
-    } else {
-        threadName = "?";
-    }
+    AUI_ASSERTX(mAsyncBackend == nullptr, "async mode is already enabled");
+    mAsyncBackend = std::make_unique<AsyncBackend>(*this, options);
+    mAsync.store(mAsyncBackend.get(), std::memory_order_release);
+#endif
+}
 
-    const char* levelName = levelCStr(level);
+void ALogger::enableAsync() { enableAsync(AsyncOptions {}); }
 
-    std::unique_lock lock(mLogSync);
-    if (message.length() == 0) {
-        printf("[%s][%s][%s]: %s\n", timebuf, threadName.c_str(), levelName, prefix.data());
-        if (mLogFile) {
-            fprintf(
-                mLogFile->nativeHandle(), "[%s][%s][%s]: %s\n", timebuf, threadName.c_str(), levelName, prefix.data());
-        }
-    } else {
-        printf("[%s][%s][%s][%s]: %s\n", timebuf, threadName.c_str(), prefix.data(), levelName, message.data());
-        if (mLogFile) {
-            fprintf(mLogFile->nativeHandle(), "[%s][%s][%s][%s]: %s\n", timebuf, threadName.c_str(), prefix.data(),
-                    levelName, message.data());
-        }
+void ALogger::flush() {
+    AsyncGuard async(*this);
+    if (async.backend) {
+        async.backend->drain();
     }
-    fflush(stdout);
-    if (mLogFile) {
-        fflush(mLogFile->nativeHandle());
+}
+
+std::size_t ALogger::droppedCount() const noexcept {
+    AsyncGuard async(*this);
+    if (async.backend) {
+        return async.backend->droppedCount();
     }
-#endif
+    return 0;
 }
 
 void ALogger::setLogFileImpl(AString path) {
-    mLogFile = AFileOutputStream(std::move(path));
+    {
+        std::unique_lock lock(mLogSync);
+        mLogFile = AFileOutputStream(std::move(path));
+    }
     log(INFO, "Logger", ("Log file: " + mLogFile->path()));
 }
 
-ALogger::~ALogger() { mLogFile.reset(); }
+ALogger::~ALogger() {
+    // the writer thread writes to mLogFile; stop it first.
+    if (mAsyncBackend) {
+        mAsync.store(nullptr);
+        // let the producers already in push() finish. Drain meanwhile: they might wait for space in a full buffer
+        // while this is the writer thread itself.
+        while (mAsyncUsers.load(std::memory_order_acquire) != 0) {
+            mAsyncBackend->drain();
+            std::this_thread::yield();
+        }
+        mAsyncBackend.reset();
+    }
+    mLogFile.reset();
+}
 
 bool ALogger::isTraceImpl() {
     return std::getenv("AUI_TRACE") != nullptr;
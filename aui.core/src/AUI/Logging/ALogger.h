@@ -21,6 +21,8 @@
 #include <fmt/format.h>
 #include <fmt/chrono.h>
 #include <AUI/Thread/AMutexWrapper.h>
+#include <atomic>
+#include <memory>
 
 class AString;
 
@@ -43,6 +45,10 @@ class AString;
  * [00:47:02][UI Thread][Logger][INFO]: Hello world!
  * ```
  *
+ * By default, each entry is written to stdout and log file synchronously. If the application logs a lot from multiple
+ * threads, consider ALogger::enableAsync: entries are then staged in per-thread buffers and written by a background
+ * thread in batches.
+ *
  * It's convenient to define `LOG_TAG` variable for your class:
  * ```cpp
  * static constexpr auto LOG_TAG = "MyDownloader";
@@ -67,6 +73,45 @@ public:
         TRACE,
     };
 
+    /**
+     * @brief Behaviour of the asynchronous logger when the staging buffer of the logging thread is full.
+     */
+    enum class OverflowPolicy {
+        /**
+         * @brief Wait until the writer thread frees space in the buffer. No entries are lost.
+         */
+        BLOCK,
+
+        /**
+         * @brief Discard the entry. The writer thread reports count of discarded entries to the log.
+         */
+        DROP,
+    };
+
+    /**
+     * @brief Options of ALogger::enableAsync.
+     */
+    struct AsyncOptions {
+        /**
+         * @brief Size of per-thread staging buffer in bytes. Rounded up to a power of two.
+         * @details
+         * Entries longer than the buffer bypass it and are written synchronously.
+         */
+        std::size_t bufferSize = 64 * 1024;
+
+        /**
+         * @brief What to do when the staging buffer is full.
+         */
+        OverflowPolicy overflowPolicy = OverflowPolicy::BLOCK;
+
+        /**
+         * @brief How often the writer thread writes staged entries out.
+         * @details
+         * The writer thread is woken earlier if a staging buffer is half full or an error is logged.
+         */
+        std::chrono::milliseconds flushInterval = std::chrono::milliseconds(50);
+    };
+
     struct LogWriter {
     private:
         ALogger& mLogger;
@@ -137,7 +182,7 @@ public:
                     };
                 }
                 auto& h = std::get<HeapBuffer>(mBuffer);
-                return { h.data(), h.size() };
+                return { h.data(), h.size() - 1 };
             }
         };
 
@@ -205,7 +250,7 @@ public:
      * @details
      * For the global logger, use ALogger::info, ALogger::warn, etc...
      */
-    ALogger(AString filename) { setLogFileImpl(std::move(filename)); }
+    ALogger(AString filename);
     ALogger();
     ~ALogger();
 
@@ -275,6 +320,47 @@ public:
         action();
     }
 
+    /**
+     * @brief Switches the logger to asynchronous mode.
+     * @param options options of asynchronous mode.
+     * @details
+     * In asynchronous mode, the logging thread only formats the entry and copies it to its own lock-free staging
+     * buffer. A background writer thread collects entries from all staging buffers and writes them to stdout and log
+     * file with a single `writev` per output. Hence, logging threads are not serialized on disk I/O.
+     *
+     * Entries of a single thread keep their order; entries of different threads may interleave differently than they
+     * were logged.
+     *
+     * Staged entries are written on ALogger::flush, on logger destruction (including the global logger on
+     * application exit) and when a fatal signal is caught.
+     *
+     * Asynchronous mode can't be disabled once enabled. Should be called once, preferably at application startup.
+     */
+    void enableAsync(AsyncOptions options);
+
+    /**
+     * @copydoc ALogger::enableAsync(AsyncOptions)
+     */
+    void enableAsync();
+
+    [[nodiscard]]
+    bool isAsync() const noexcept {
+        return mAsync.load(std::memory_order_acquire) != nullptr;
+    }
+
+    /**
+     * @brief Writes out entries staged in asynchronous mode. Blocks until they are written.
+     * @details
+     * In synchronous mode, does nothing: entries are written immediately.
+     */
+    void flush();
+
+    /**
+     * @brief Count of entries discarded by OverflowPolicy::DROP since asynchronous mode was enabled.
+     */
+    [[nodiscard]]
+    std::size_t droppedCount() const noexcept;
+
     static LogWriter info(AStringView str) { return { global(), INFO, str }; }
     static LogWriter warn(AStringView str) { return { global(), WARN, str }; }
     static LogWriter err(AStringView str) { return { global(), ERR, str }; }
@@ -289,10 +375,21 @@ public:
     LogWriter log(Level level, AStringView prefix) { return { *this, level, prefix }; }
 
 private:
+    struct AsyncBackend;
+    struct AsyncGuard;
+
     AOptional<AFileOutputStream> mLogFile;
     AMutex mLogSync;
     AMutexWrapper<std::function<void(const AString& prefix, const AString& message, Level level)>> mOnLogged;
 
+    std::unique_ptr<AsyncBackend> mAsyncBackend;
+    std::atomic<AsyncBackend*> mAsync = nullptr;
+
+    /**
+     * @brief Count of calls using mAsync at the moment. The destructor waits for them before destroying the backend.
+     */
+    mutable std::atomic_size_t mAsyncUsers = 0;
+
     bool mDebug = AUI_DEBUG;
     bool mTrace = isTraceImpl();
 
@@ -307,6 +404,11 @@ private:
      * @param message log message. If empty, prefix used as a message
      */
     void log(Level level, AStringView prefix, AStringView message);
+
+    /**
+     * @brief Writes a formatted entry to stdout and log file immediately.
+     */
+    void writeSync(std::string_view line);
 };
 namespace glm {
 template <glm::length_t L, typename T, glm::qualifier Q>
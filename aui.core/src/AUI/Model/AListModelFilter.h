@@ -14,14 +14,39 @@
 #include <AUI/Model/IListModel.h>
 #include <AUI/Model/IMutableListModel.h>
 #include <AUI/Common/AVector.h>
+#include <AUI/Thread/AThreadPool.h>
+#include <AUI/Util/kAUI.h>
+#include <atomic>
 
 template<typename T, typename Filter>
 class AListModelFilter: public IListModel<T> {
 private:
+    /**
+     * @brief Number of rows a rescan chunk checks between cancellation checks.
+     */
+    static constexpr size_t RESCAN_CANCELLATION_STEP = 1024;
+
     _<IListModel<T>> mOther;
     Filter mFilter;
+
+    /**
+     * @brief Sorted indices of the source model rows passing the filter.
+     * @details
+     * While a rescan result is being applied, holds the already reconciled beginning of the new mapping; the rest of
+     * the rows is in mTail.
+     */
     AVector<size_t> mMapping;
 
+    /**
+     * @brief Not yet reconciled end of the previous mapping, starting from mTailBegin.
+     */
+    AVector<size_t> mTail;
+    size_t mTailBegin = 0;
+
+    AFutureSet<AVector<size_t>> mRescan;
+    _<std::atomic_bool> mRescanCancelled;
+    size_t mRescanGeneration = 0;
+
     void fill() {
         for (size_t i = 0; i < mOther->listSize(); ++i) {
             if (mFilter(mOther->listItemAt(i))) {
@@ -29,6 +54,161 @@ private:
             }
         }
     }
+
+    /**
+     * @return the first filtered row which source row is not less than sourceRow.
+     */
+    size_t lowerBound(size_t sourceRow) const {
+        return std::distance(mMapping.begin(), std::lower_bound(mMapping.begin(), mMapping.end(), sourceRow));
+    }
+
+    void onSourceInserted(const AListModelRange<T>& r) {
+        const auto begin = r.getBegin().getRow();
+        const auto count = r.getEnd().getRow() - begin;
+        const auto at = lowerBound(begin);
+        for (auto it = mMapping.begin() + at; it != mMapping.end(); ++it) {
+            *it += count;
+        }
+
+        AVector<size_t> inserted;
+        for (size_t row = begin; row < begin + count; ++row) {
+            if (mFilter(mOther->listItemAt(row))) {
+                inserted << row;
+            }
+        }
+        if (!inserted.empty()) {
+            mMapping.insert(mMapping.begin() + at, inserted.begin(), inserted.end());
+            emit this->dataInserted(this->range(at, at + inserted.size()));
+        }
+        restartRescanIfRunning();
+    }
+
+    void onSourceRemoved(const AListModelRange<T>& r) {
+        const auto begin = r.getBegin().getRow();
+        const auto count = r.getEnd().getRow() - begin;
+        const auto first = lowerBound(begin);
+        const auto last = lowerBound(begin + count);
+        mMapping.erase(mMapping.begin() + first, mMapping.begin() + last);
+        for (auto it = mMapping.begin() + first; it != mMapping.end(); ++it) {
+            *it -= count;
+        }
+        if (first != last) {
+            emit this->dataRemoved(this->range(first, last));
+        }
+        restartRescanIfRunning();
+    }
+
+    void onSourceChanged(const AListModelRange<T>& r) {
+        // changed rows may start or stop passing the filter; adjacent rows with the same outcome are reported as a
+        // single range.
+        enum class Kind { NONE, CHANGED, INSERTED, REMOVED };
+        auto kind = Kind::NONE;
+        size_t position = lowerBound(r.getBegin().getRow());
+        size_t runBegin = position;
+        AVector<size_t> inserted;
+
+        auto flush = [&] {
+            switch (kind) {
+                case Kind::NONE:
+                    break;
+                case Kind::CHANGED:
+                    emit this->dataChanged(this->range(runBegin, position));
+                    break;
+                case Kind::INSERTED:
+                    mMapping.insert(mMapping.begin() + runBegin, inserted.begin(), inserted.end());
+                    position = runBegin + inserted.size();
+                    emit this->dataInserted(this->range(runBegin, position));
+                    inserted.clear();
+                    break;
+                case Kind::REMOVED:
+                    mMapping.erase(mMapping.begin() + runBegin, mMapping.begin() + position);
+                    emit this->dataRemoved(this->range(runBegin, position));
+                    position = runBegin;
+                    break;
+            }
+        };
+
+        for (size_t row = r.getBegin().getRow(); row < r.getEnd().getRow(); ++row) {
+            const bool present = position < mMapping.size() && mMapping[position] == row;
+            const bool passes = mFilter(mOther->listItemAt(row));
+            const auto rowKind = present ? (passes ? Kind::CHANGED : Kind::REMOVED)
+                                         : (passes ? Kind::INSERTED : Kind::NONE);
+            if (rowKind != kind) {
+                flush();
+                kind = rowKind;
+                runBegin = position;
+            }
+            if (rowKind == Kind::INSERTED) {
+                inserted << row;
+            } else if (rowKind != Kind::NONE) {
+                ++position;
+            }
+        }
+        flush();
+        restartRescanIfRunning();
+    }
+
+    /**
+     * @brief Replaces the mapping with newMapping, emitting removed and inserted ranges for the rows that differ.
+     * @details
+     * Rows passing both the previous and the new filter are not reported. Ranges are emitted from the beginning to
+     * the end; each of them is valid at the moment of emission.
+     */
+    void applyMapping(AVector<size_t> newMapping) {
+        mTail = std::exchange(mMapping, {});
+        mTailBegin = 0;
+        mMapping.reserve(newMapping.size());
+        AUI_DEFER {
+            mTail.clear();
+            mTailBegin = 0;
+        };
+
+        auto i = newMapping.begin();
+        while (mTailBegin < mTail.size() || i != newMapping.end()) {
+            if (mTailBegin < mTail.size() && i != newMapping.end() && mTail[mTailBegin] == *i) {
+                mMapping << *i;
+                ++mTailBegin;
+                ++i;
+                continue;
+            }
+            const auto position = mMapping.size();
+            if (i == newMapping.end() || (mTailBegin < mTail.size() && mTail[mTailBegin] < *i)) {
+                const auto removedEnd = i == newMapping.end()
+                                            ? mTail.end()
+                                            : std::lower_bound(mTail.begin() + mTailBegin, mTail.end(), *i);
+                const auto count = std::distance(mTail.begin() + mTailBegin, removedEnd);
+                mTailBegin += count;
+                emit this->dataRemoved(this->range(position, position + count));
+                continue;
+            }
+            const auto insertedEnd = mTailBegin == mTail.size()
+                                         ? newMapping.end()
+                                         : std::lower_bound(i, newMapping.end(), mTail[mTailBegin]);
+            mMapping.insert(mMapping.end(), i, insertedEnd);
+            i = insertedEnd;
+            emit this->dataInserted(this->range(position, mMapping.size()));
+        }
+    }
+
+    void cancelRescan() {
+        ++mRescanGeneration;
+        if (mRescanCancelled) {
+            *mRescanCancelled = true;
+            mRescanCancelled = nullptr;
+        }
+        for (const auto& future : mRescan) {
+            future.cancel();
+        }
+        mRescan.clear();
+    }
+
+    void restartRescanIfRunning() {
+        if (isRescanning()) {
+            // row indices of the running rescan are outdated.
+            invalidateParallel();
+        }
+    }
+
 public:
     using value_type = T;
 
@@ -38,45 +218,124 @@ public:
         fill();
 
         AObject::connect(other->dataChanged, this, [&](const AListModelRange<T>& r){
-            AUI_ASSERTX(0, "unimplemented");
+            onSourceChanged(r);
         });
         AObject::connect(other->dataInserted, this, [&](const AListModelRange<T>& r){
-            AUI_ASSERTX(0, "unimplemented");
+            onSourceInserted(r);
         });
         AObject::connect(other->dataRemoved, this, [&](const AListModelRange<T>& r){
-            AUI_ASSERTX(0, "unimplemented");
+            onSourceRemoved(r);
         });
     }
 
 
-    ~AListModelFilter() override = default;
+    ~AListModelFilter() override {
+        cancelRescan();
+    }
 
     size_t listSize() override {
-        return mMapping.size();
+        return mMapping.size() + mTail.size() - mTailBegin;
     }
 
     T listItemAt(const AListModelIndex& index) override {
-        return mOther->listItemAt(mMapping[index.getRow()]);
+        const auto row = index.getRow();
+        if (row < mMapping.size()) {
+            return mOther->listItemAt(mMapping[row]);
+        }
+        return mOther->listItemAt(mTail[mTailBegin + row - mMapping.size()]);
     }
 
     /**
-     * Removes all items and performs filtering again for all elements.
+     * @brief Performs filtering again for all elements.
+     * @details
+     * Intended to be called when the filter's behaviour changes. Only the rows that started or stopped passing the
+     * filter are reported, by dataInserted and dataRemoved respectively. Cancels the rescan started by
+     * invalidateParallel, if any.
      */
     void invalidate() {
-        size_t prevSize = mMapping.size();
-        mMapping.clear();
-        fill();
+        cancelRescan();
+        AVector<size_t> newMapping;
+        newMapping.reserve(mMapping.size());
+        for (size_t i = 0; i < mOther->listSize(); ++i) {
+            if (mFilter(mOther->listItemAt(i))) {
+                newMapping << i;
+            }
+        }
+        applyMapping(std::move(newMapping));
+    }
 
-        size_t currentSize = mMapping.size();
-        if (currentSize == prevSize) {
-            emit this->dataChanged(this->range(0, currentSize));
-        } else if (currentSize > prevSize) {
-            emit this->dataChanged(this->range(0, prevSize));
-            emit this->dataInserted(this->range(prevSize, currentSize));
-        } else {
-            emit this->dataChanged(this->range(0, currentSize));
-            emit this->dataRemoved(this->range(currentSize, prevSize));
+    /**
+     * @brief Performs filtering again for all elements, splitting the source model into chunks processed by
+     * AThreadPool.
+     * @details
+     * Returns immediately; the changes are applied and reported the same way as by invalidate, later, on the thread
+     * this model belongs to. Until then, the model keeps the previous results. Calling invalidateParallel or
+     * invalidate again cancels the rescan in progress, so it can be called on each change of the filter (i.e., on
+     * each keystroke of a search field).
+     *
+     * The items of the source model are copied on the calling thread before the rescan starts; the workers check the
+     * copy, never the source model itself. Thus, the source model may be modified on the model's thread during the
+     * rescan: modifications are applied immediately and restart the rescan with a fresh copy, so prefer modifying
+     * the source model in batches while rescanning. The filter is called from several threads simultaneously; it
+     * must be safe to do so.
+     */
+    void invalidateParallel() {
+        cancelRescan();
+        auto cancelled = mRescanCancelled = _new<std::atomic_bool>(false);
+        const auto generation = mRescanGeneration;
+        auto self = aui::ptr::weak_from_this(this);
+        auto items = _new<AVector<T>>();
+        items->reserve(mOther->listSize());
+        for (size_t i = 0; i < mOther->listSize(); ++i) {
+            *items << mOther->listItemAt(i);
         }
+        auto chunk = [this, self, cancelled, items](size_t begin, size_t end) {
+            AVector<size_t> result;
+            auto lock = self.lock();
+            if (!lock) {
+                return result;
+            }
+            for (size_t i = begin; i < end; ++i) {
+                if ((i - begin) % RESCAN_CANCELLATION_STEP == 0 && *cancelled) {
+                    return AVector<size_t>{};
+                }
+                if (mFilter((*items)[i])) {
+                    result << i;
+                }
+            }
+            return result;
+        };
+        mRescan = AThreadPool::global().parallel(size_t(0), items->size(), chunk);
+        if (mRescan.empty()) {
+            // empty source model
+            applyMapping({});
+            return;
+        }
+        mRescan.onAllComplete([this, self, generation, futures = mRescan, thread = this->getThread()] {
+            thread->enqueue([this, self, generation, futures] {
+                auto lock = self.lock();
+                if (!lock || generation != mRescanGeneration) {
+                    return;
+                }
+                mRescan.clear();
+                mRescanCancelled = nullptr;
+                futures.checkForExceptions();
+                AVector<size_t> newMapping;
+                for (const auto& future : futures) {
+                    const auto& chunk = *future;
+                    newMapping.insert(newMapping.end(), chunk.begin(), chunk.end());
+                }
+                applyMapping(std::move(newMapping));
+            });
+        });
+    }
+
+    /**
+     * @return true if the rescan started by invalidateParallel is in progress.
+     */
+    [[nodiscard]]
+    bool isRescanning() const noexcept {
+        return !mRescan.empty();
     }
 
     /**
@@ -89,10 +348,13 @@ public:
         auto ranges = this->rangesIncluding([&](size_t i) {
             return !mFilter(listItemAt(i));
         });
-        int offset = 0;
+        size_t offset = 0;
         for (const AListModelRange<T>& r : ranges) {
-            mMapping.erase(mMapping.begin() + r.getBegin().getRow() - offset, mMapping.begin() + r.getEnd().getRow()) - offset;
-            offset += r.getEnd().getRow() - r.getBegin().getRow();
+            const auto begin = r.getBegin().getRow() - offset;
+            const auto end = r.getEnd().getRow() - offset;
+            mMapping.erase(mMapping.begin() + begin, mMapping.begin() + end);
+            offset += end - begin;
+            emit this->dataRemoved(this->range(begin, end));
         }
     }
 };
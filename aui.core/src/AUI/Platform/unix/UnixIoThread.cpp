@@ -47,6 +47,11 @@ public:
     }
 
     void loop() override {
+        struct Triggered {
+            _<UnixIoThread::Callback> callback;
+            UnixPollEvent events;
+        };
+        AVector<Triggered> triggered;
         for (;;) {
             AThread::processMessages();
             epoll_event events[1024];
@@ -57,17 +62,26 @@ public:
                 }
                 aui::impl::unix_based::lastErrorToException("epoll_wait failed");
             }
-            std::unique_lock lock (mParent.mSync);
-            for (int i = 0; i < count; ++i) {
-                auto it = mParent.mFdInfo.find(events[i].data.fd);
-                if (it == mParent.mFdInfo.end()) continue;
-                for (const auto& callback : it->second.callbacks) {
-                    if (!callback.mask.testAny(static_cast<UnixPollEvent>(events[i].events))) {
-                        continue;
+            {
+                // the callbacks are collected first and then called without the lock, so they can (un)register
+                // callbacks.
+                std::unique_lock lock(mParent.mSync);
+                for (int i = 0; i < count; ++i) {
+                    auto it = mParent.mFdInfo.find(events[i].data.fd);
+                    if (it == mParent.mFdInfo.end()) continue;
+                    const auto triggeredEvents = static_cast<UnixPollEvent>(events[i].events);
+                    for (const auto& callback : it->second.callbacks) {
+                        if (!callback.mask.testAny(triggeredEvents)) {
+                            continue;
+                        }
+                        triggered << Triggered { callback.callback, triggeredEvents };
                     }
-                    callback.callback(static_cast<UnixPollEvent>(events[i].events));
                 }
             }
+            for (const auto& t : triggered) {
+                (*t.callback)(t.events);
+            }
+            triggered.clear();
         }
     }
 private:
@@ -76,11 +90,16 @@ private:
 
 void UnixIoThread::registerCallback(int fd, ABitField<UnixPollEvent> flags, Callback callback) noexcept {
     std::unique_lock lock(mSync);
-    mFdInfo[fd].callbacks << FDInfo::CallbackEntry { flags, std::move(callback) };
+    auto& callbacks = mFdInfo[fd].callbacks;
+    const bool alreadyRegistered = !callbacks.empty();
+    callbacks << FDInfo::CallbackEntry { flags, _new<Callback>(std::move(callback)) };
     epoll_event e;
-    e.events = static_cast<uint32_t>(flags.value());
+    e.events = 0;
+    for (const auto& entry : callbacks) {
+        e.events |= static_cast<uint32_t>(entry.mask.value());
+    }
     e.data.fd = fd;
-    if (epoll_ctl(mEpollFd, EPOLL_CTL_ADD, fd, &e) == -1) {
+    if (epoll_ctl(mEpollFd, alreadyRegistered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &e) == -1) {
         aui::impl::unix_based::lastErrorToException("epoll_ctl add failed");
     }
 }
@@ -92,10 +111,10 @@ void UnixIoThread::unregisterCallback(int fd) noexcept {
     if (epoll_ctl(mEpollFd, EPOLL_CTL_DEL, fd, &e) == -1) {
         aui::impl::unix_based::lastErrorToException("epoll_ctl del+ failed");
     }
-    mThread->enqueue([this, fd] {
-        std::unique_lock lock (mSync);
-        mFdInfo.erase(fd);
-    });
+    // erased immediately, so the fd can be reused (i.e., by a socket accepted right after this one is closed) without
+    // losing the callbacks of the new file descriptor.
+    std::unique_lock lock (mSync);
+    mFdInfo.erase(fd);
 }
 
 AFuture<ABitField<UnixPollEvent>> UnixIoThread::waitForEvent(int fd, ABitField<UnixPollEvent> flags) {
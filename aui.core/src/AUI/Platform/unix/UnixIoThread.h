@@ -28,11 +28,23 @@
 AUI_ENUM_FLAG(UnixPollEvent) {
     IN  = EPOLLIN,
     OUT = EPOLLOUT,
+    ERR = EPOLLERR,
+    HUP = EPOLLHUP,
+
+    /**
+     * @brief The callback is called when the state of the file descriptor changes only (EPOLLET).
+     * @details
+     * The file descriptor should be non-blocking and the callback should read/write until EAGAIN; otherwise, the
+     * remaining data would not cause another notification.
+     */
+    EDGE_TRIGGERED = static_cast<int>(EPOLLET),
 };
 #else
 AUI_ENUM_FLAG(UnixPollEvent) {
     IN  = POLLIN,
     OUT = POLLOUT,
+    ERR = POLLERR,
+    HUP = POLLHUP,
 };
 #endif
 
@@ -46,7 +58,22 @@ public:
 
     static UnixIoThread& inst() noexcept;
 
+    /**
+     * @brief Calls callback on IO thread each time one of the flags is triggered on fd.
+     * @details
+     * Multiple callbacks can be registered for the same file descriptor.
+     *
+     * The callbacks are called without internal locks held, so they are free to register and unregister callbacks
+     * (including their own one).
+     */
     void registerCallback(int fd, ABitField<UnixPollEvent> flags, Callback callback) noexcept;
+
+    /**
+     * @brief Unregisters all callbacks of fd.
+     * @details
+     * After the call, the file descriptor can be closed and reused. A callback that is being called on IO thread
+     * concurrently might still finish its work.
+     */
     void unregisterCallback(int fd) noexcept;
     static const _<AThread>& thread() noexcept {
         return inst().mThread;
@@ -83,7 +110,7 @@ private:
     struct FDInfo {
         struct CallbackEntry {
             ABitField<UnixPollEvent> mask;
-            Callback callback;
+            _<Callback> callback;
         };
         AVector<CallbackEntry> callbacks;
     };
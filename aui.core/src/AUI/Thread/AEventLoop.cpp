@@ -21,8 +21,12 @@ AEventLoop::~AEventLoop() {
 }
 
 void AEventLoop::notifyProcessMessages() {
+    mNotified.store(true);
+    if (!mSleeping.load()) {
+        // the loop is awake and will observe mNotified without help; avoid taking the mutex.
+        return;
+    }
     std::unique_lock lock(mMutex);
-    mNotified = true;
     mCV.notify_all();
 }
 
@@ -34,20 +38,18 @@ void AEventLoop::loop() {
 }
 
 void AEventLoop::iteration() {
-    std::unique_lock lock(mMutex);
-    if (mNotified) {
-        mNotified = false;
-        lock.unlock();
+    if (mNotified.exchange(false) || !AThread::current()->messageQueueEmpty()) {
         AThread::processMessages();
         return;
     }
-    if (!AThread::current()->messageQueueEmpty()) {
-        lock.unlock();
-        AThread::processMessages();
-        return;
+    {
+        std::unique_lock lock(mMutex);
+        mSleeping.store(true);
+        // Dekker-style handshake with notifyProcessMessages: either we observe mNotified here or the notifier
+        // observes mSleeping and signals the condition variable.
+        mCV.wait(lock, [&] { return mNotified.load(); });
+        mSleeping.store(false);
     }
-    mNotified = true;
-    mCV.wait(lock);
-    lock.unlock();
+    mNotified.store(false);
     AThread::processMessages();
 }
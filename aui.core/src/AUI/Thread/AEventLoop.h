@@ -12,6 +12,7 @@
 #pragma once
 
 
+#include <atomic>
 #include "IEventLoop.h"
 #include "AMutex.h"
 #include "AConditionVariable.h"
@@ -50,6 +51,11 @@ public:
 private:
     AMutex mMutex;
     AConditionVariable mCV;
-    bool mNotified = false;
+    std::atomic_bool mNotified = false;
+
+    /**
+     * @brief Whether the loop is blocked on mCV. Lets notifyProcessMessages skip the mutex when the loop is awake.
+     */
+    std::atomic_bool mSleeping = false;
     bool mRunning = false;
 };
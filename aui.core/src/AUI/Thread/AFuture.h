@@ -24,6 +24,7 @@
 #include <AUI/Common/AException.h>
 #include <AUI/Common/SharedPtrTypes.h>
 #include <AUI/Common/AString.h>
+#include <AUI/Common/AVector.h>
 #include <AUI/Common/AException.h>
 #include <AUI/Logging/ALogger.h>
 #include <AUI/Thread/AConditionVariable.h>
@@ -33,6 +34,7 @@
 #include <AUI/Thread/AFutureWait.h>
 #include <AUI/Traits/concepts.h>
 #include <AUI/Util/ABitField.h>
+#include <AUI/Util/SmallFunction.h>
 
 class AThreadPool;
 
@@ -90,7 +92,7 @@ namespace aui::impl::future {
 
     template<typename T>
     struct OnSuccessCallback {
-        using type = std::function<void(const T& value)>;
+        using type = aui::small_function<void(const T& value)>;
     };
 
     template<typename T>
@@ -106,16 +108,63 @@ namespace aui::impl::future {
 
     template<>
     struct OnSuccessCallback<void> {
-        using type = std::function<void()>;
+        using type = aui::small_function<void()>;
+    };
+
+    template<typename Value, typename Callback>
+    struct ContinuationResult {
+        using type = std::invoke_result_t<Callback&, const Value&>;
+    };
+
+    template<typename Callback>
+    struct ContinuationResult<void, Callback> {
+        using type = std::invoke_result_t<Callback&>;
+    };
+
+    /**
+     * @brief Flat list of callbacks subscribed to AFuture.
+     * @details
+     * The first callback is stored inline, so a future with a single subscriber does not allocate a list. Callbacks
+     * are invoked iteratively in subscription order.
+     */
+    template<typename Callback>
+    struct CallbackList {
+        Callback first;
+        AVector<Callback> rest;
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return first == nullptr;
+        }
+
+        void add(Callback callback) {
+            if (first == nullptr) {
+                first = std::move(callback);
+                return;
+            }
+            rest.push_back(std::move(callback));
+        }
+
+        template<typename Invoker>
+        void forEach(Invoker&& invoker) {
+            if (first == nullptr) {
+                return;
+            }
+            invoker(first);
+            for (auto& callback : rest) {
+                invoker(callback);
+            }
+        }
     };
     template<typename Value = void>
     class Future
     {
     public:
         static constexpr bool isVoid = std::is_same_v<void, Value>;
-        using TaskCallback = std::function<Value()>;
+        using TaskCallback = aui::small_function<Value()>;
 
         using OnSuccessCallback = typename OnSuccessCallback<Value>::type;
+        using OnErrorCallback = aui::small_function<void(const AException& exception)>;
 
         struct Inner {
             bool interrupted = false;
@@ -131,12 +180,12 @@ namespace aui::impl::future {
             ASpinlockMutex mutex;
             AConditionVariable cv;
             TaskCallback task;
-            OnSuccessCallback onSuccess;
-            std::function<void(const AException& exception)> onError;
+            CallbackList<OnSuccessCallback> onSuccess;
+            CallbackList<OnErrorCallback> onError;
             _<AAbstractThread> thread;
             bool cancelled = false;
 
-            explicit Inner(std::function<Value()> task) noexcept: task(std::move(task)) {
+            explicit Inner(TaskCallback task) noexcept: task(std::move(task)) {
                 if constexpr(isVoid) {
                     value = false;
                 }
@@ -282,21 +331,21 @@ namespace aui::impl::future {
                 std::unique_lock lock(mutex);
                 exception.emplace("exception reported", std::move(causedBy));
                 cv.notify_all();
-                if (!onError) {
+                if (onError.empty()) {
                     return;
                 }
-                auto localOnError = std::move(onError);
+                auto localOnError = std::exchange(onError, {});
                 lock.unlock();
-                localOnError(*exception);
+                localOnError.forEach([&](OnErrorCallback& callback) { callback(*exception); });
             }
 
 
             /**
-             * @brief Calls onSuccess callback.
+             * @brief Calls onSuccess callbacks.
              * @param lock lock of Inner::mutex mutex.
              * @details
-             * lock is expected to be locked. Under the lock, callback is moved to local stack, lock is unlocked, and
-             * only then callback is called. This helps to avoid deadlocks (i.e. retreiving AFuture's value in
+             * lock is expected to be locked. Under the lock, callbacks are moved to local stack, lock is unlocked, and
+             * only then callbacks are called one by one. This helps to avoid deadlocks (i.e. retreiving AFuture's value in
              * onSuccess callback). lock is not locked again. If AFuture does not have value or onSuccess callback,
              * the lock remains untouched.
              */
@@ -305,11 +354,10 @@ namespace aui::impl::future {
                 if (cancelled) {
                     return;
                 }
-                if (value && onSuccess) {
-                    auto localOnSuccess = std::move(onSuccess);
-                    onSuccess = nullptr;
+                if (value && !onSuccess.empty()) {
+                    auto localOnSuccess = std::exchange(onSuccess, {});
                     lock.unlock();
-                    invokeOnSuccessCallback(localOnSuccess);
+                    localOnSuccess.forEach([&](OnSuccessCallback& callback) { invokeOnSuccessCallback(callback); });
                 }
             }
 
@@ -328,42 +376,12 @@ namespace aui::impl::future {
 
             template<typename Callback>
             void addOnSuccessCallback(Callback&& callback) {
-                if constexpr (isVoid) {
-                    if (onSuccess) {
-                        onSuccess = [prev = std::move(onSuccess),
-                                     callback = std::forward<Callback>(callback)]() mutable {
-                            prev();
-                            callback();
-                        };
-                    } else {
-                        onSuccess = [callback = std::forward<Callback>(callback)]() mutable { callback(); };
-                    }
-                } else {
-                    if (onSuccess) {
-                        onSuccess = [prev = std::move(onSuccess),
-                                     callback = std::forward<Callback>(callback)](const Value& v) mutable {
-                            prev(v);
-                            callback(v);
-                        };
-                    } else {
-                        onSuccess = [callback = std::forward<Callback>(callback)](const Value& v) mutable {
-                            callback(v);
-                        };
-                    }
-                }
+                onSuccess.add(OnSuccessCallback(std::forward<Callback>(callback)));
             }
 
             template<typename Callback>
             void addOnErrorCallback(Callback&& callback) {
-                if (onError) {
-                    onError = [prev = std::move(onError),
-                               callback = std::forward<Callback>(callback)](const AException& v) {
-                        prev(v);
-                        callback(v);
-                    };
-                } else {
-                    onError = [callback = std::forward<Callback>(callback)](const AException& v) { callback(v); };
-                }
+                onError.add(OnErrorCallback(std::forward<Callback>(callback)));
             }
         };
 
@@ -480,6 +498,57 @@ namespace aui::impl::future {
             (*mInner)->notifyOnSuccessCallback(lock);
         }
 
+        /**
+         * @brief Creates a continuation AFuture which is resolved with the result of callback.
+         * @param callback continuation. Accepts the value of this AFuture (nothing, if AFuture<void>).
+         * @return AFuture of callback's return type.
+         * @details
+         * The continuation is executed inline, on the thread that resolves this AFuture (or immediately on the
+         * caller thread if the AFuture is already resolved), without rescheduling through AThreadPool.
+         *
+         * If this AFuture fails, or callback throws an exception, the continuation AFuture fails as well.
+         *
+         * ```cpp
+         * AFuture<int> a = AUI_THREADPOOL { return 2; };
+         * AFuture<AString> b = a.then([](int v) { return AString::number(v * 2); });
+         * ```
+         *
+         * As with onSuccess, the continuation does not expand lifespan of this AFuture.
+         */
+        template<typename Callback>
+        auto then(Callback&& callback) const {
+            return thenImpl(nullptr, std::forward<Callback>(callback));
+        }
+
+        /**
+         * @brief Creates a continuation AFuture which is resolved with the result of callback executed on threadPool.
+         * @details
+         * The continuation task is pushed to threadPool directly from the thread that resolves this AFuture. The value
+         * of this AFuture is copied to the task.
+         *
+         * @sa then(Callback&&)
+         */
+        template<typename Callback>
+        auto then(AThreadPool& threadPool, Callback&& callback) const {
+            return thenImpl([&threadPool](AThreadPool::task task) { threadPool.run(std::move(task)); },
+                            std::forward<Callback>(callback));
+        }
+
+        /**
+         * @brief Creates a continuation AFuture which is resolved with the result of callback executed on thread.
+         * @details
+         * The continuation is delivered to thread's message queue directly from the thread that resolves this AFuture
+         * (i.e., `future.then(AThread::main(), ...)` runs the continuation on UI thread). The value of this AFuture is
+         * copied to the message.
+         *
+         * @sa then(Callback&&)
+         */
+        template<typename Callback>
+        auto then(_<AAbstractThread> thread, Callback&& callback) const {
+            return thenImpl([thread = std::move(thread)](ALockFreeMessageQueue<>::Message task) { thread->enqueue(std::move(task)); },
+                            std::forward<Callback>(callback));
+        }
+
         /**
          * @brief Cancels the AFuture's task.
          * @details
@@ -578,6 +647,42 @@ namespace aui::impl::future {
         void checkForSelfWait() const {
             (*mInner)->checkForSelfWait();
         }
+
+        template<typename Result, typename Callback, typename... V>
+        static void runContinuation(const AFuture<Result>& result, Callback& callback, const V&... value) noexcept {
+            try {
+                if constexpr (std::is_void_v<Result>) {
+                    std::invoke(callback, value...);
+                    result.supplyValue();
+                } else {
+                    result.supplyValue(std::invoke(callback, value...));
+                }
+            } catch (...) {
+                result.supplyException();
+            }
+        }
+
+        /**
+         * @param post nullptr to run the continuation inline; otherwise, a callable that schedules the continuation.
+         */
+        template<typename Post, typename Callback>
+        auto thenImpl(Post post, Callback&& callback) const {
+            using Result = typename ContinuationResult<Value, std::decay_t<Callback>>::type;
+            AFuture<Result> result;
+            onSuccess([result, post = std::move(post), callback = std::forward<Callback>(callback)](const auto&... value) mutable {
+                if constexpr (std::is_null_pointer_v<Post>) {
+                    runContinuation(result, callback, value...);
+                } else {
+                    post([result = std::move(result), callback = std::move(callback), ...value = value]() mutable {
+                        runContinuation(result, callback, value...);
+                    });
+                }
+            });
+            onError([result](const AException& e) {
+                result.supplyException(e.causedBy() ? e.causedBy() : std::make_exception_ptr(e));
+            });
+            return result;
+        }
     };
 
 }
@@ -798,21 +903,12 @@ public:
 
     /**
      * @brief Maps this AFuture to another type of AFuture.
+     * @details
+     * Equivalent to then(Callback&&): callback is executed inline on the resolving thread.
      */
     template<aui::invocable<const T&> Callback>
     auto map(Callback&& callback) -> AFuture<decltype(callback(std::declval<T>()))> const {
-        AFuture<decltype(callback(std::declval<T>()))> result;
-        onSuccess([result, callback = std::forward<Callback>(callback)](const T& v) {
-            result.supplyValue(callback(v));
-        });
-        onError([result](const AException& v) {
-            try {
-                throw v;
-            } catch (...) {
-                result.reportException();
-            }
-        });
-        return result;
+        return super::then(std::forward<Callback>(callback));
     }
 };
 
@@ -237,9 +237,10 @@ void AThread::join() {
     mThread->join();
 }
 
-void AAbstractThread::enqueue(AMessageQueue<>::Message f) {
-    mMessageQueue.enqueue(std::move(f));
-    notifyCurrentEventLoop();
+void AAbstractThread::enqueue(ALockFreeMessageQueue<>::Message f) {
+    if (mMessageQueue.enqueue(std::move(f))) {
+        notifyCurrentEventLoop();
+    }
 }
 
 void AAbstractThread::notifyCurrentEventLoop() noexcept {
@@ -297,7 +298,7 @@ void AAbstractThread::updateThreadName() noexcept {
 
 AThread::AThread(std::function<void()> functor) : mFunctor(std::move(functor)) {}
 
-bool AAbstractThread::messageQueueEmpty() noexcept { return mMessageQueue.messages().empty(); }
+bool AAbstractThread::messageQueueEmpty() noexcept { return mMessageQueue.empty(); }
 
 const _<AAbstractThread>& AThread::main() noexcept {
     static auto main = current(); // initialized by AUI_ENTRY.
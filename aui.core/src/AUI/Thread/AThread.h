@@ -20,6 +20,7 @@
 #include <AUI/Platform/AStacktrace.h>
 #include <AUI/Thread/AMutex.h>
 #include <AUI/Util/AMessageQueue.h>
+#include <AUI/Util/ALockFreeMessageQueue.h>
 
 class IEventLoop;
 class AString;
@@ -58,11 +59,14 @@ public:
      * @brief Delivers task for execution (message) to this thread's event queue. Messages are processed by framework
      *        itself using AEventLoop. This behaviour may be overwritten using the <code>AThread::processMessages()
      *        </code> function.
+     * @details
+     * Lock-free; safe to call from any thread. The thread's event loop is notified only when the message queue
+     * transitions from empty to non-empty, so a burst of messages results in a single wake-up.
      */
-    void enqueue(AMessageQueue<>::Message f);
+    void enqueue(ALockFreeMessageQueue<>::Message f);
 
     [[nodiscard]]
-    const AMessageQueue<>& messageQueue() const {
+    const ALockFreeMessageQueue<>& messageQueue() const {
         return mMessageQueue;
     }
 
@@ -107,7 +111,7 @@ public:
      */
     template <class Callable>
     inline void operator<<(Callable fun) {
-        enqueue(fun);
+        enqueue(std::move(fun));
     }
 
     /**
@@ -117,7 +121,7 @@ public:
      */
     template <class Callable>
     inline void operator*(Callable fun) {
-        enqueue(fun);
+        enqueue(std::move(fun));
     }
 
     [[nodiscard]]
@@ -131,6 +135,9 @@ public:
     [[nodiscard]]
     AStacktrace threadStacktrace() const;
 
+    /**
+     * @brief Checks whether this thread has pending messages. Should be called from this thread only.
+     */
     [[nodiscard]]
     bool messageQueueEmpty() noexcept;
 
@@ -142,7 +149,7 @@ protected:
 
     AString mThreadName;
 
-    AMessageQueue<> mMessageQueue;
+    ALockFreeMessageQueue<> mMessageQueue;
 
     AAbstractThread(const id& id) noexcept;
     void updateThreadName() noexcept;
@@ -16,68 +16,86 @@
 #include <thread>
 #include "AUI/Platform/Entry.h"
 
+namespace {
+thread_local AThreadPool::Worker* gCurrentWorker = nullptr;
+}
+
 AThreadPool::Worker::Worker(AThreadPool& tp, size_t index)
   : AThread([&, index]() {
+      gCurrentWorker = this;
       AThread::setName("AThreadPool #" + AString::number(index + 1));
 
-      std::unique_lock tpLock(mTP.mQueueLock);
       while (mEnabled) {
-          iteration(tpLock);
-          wait(tpLock);
+          iteration();
+          mTP.park([&] { return !mEnabled; });
       }
+      gCurrentWorker = nullptr;
   })
-  , mTP(tp) {}
+  , mTP(tp)
+  , mRandomState((std::uint32_t(index) + 1) * 0x9E3779B9u | 1u) {}
 
-void AThreadPool::Worker::iteration(std::unique_lock<std::mutex>& tpLock) {
-    while (!mTP.mQueueHighest.empty() || !mTP.mQueueMedium.empty() || !mTP.mQueueLowest.empty()) {
-        if (processQueue(tpLock, mTP.mQueueHighest))
-            continue;
-        if (processQueue(tpLock, mTP.mQueueMedium))
-            continue;
-        processQueue(tpLock, mTP.mQueueLowest);
+void AThreadPool::Worker::iteration() {
+    while (mEnabled && processTask()) {
     }
 }
 
-void AThreadPool::Worker::wait(std::unique_lock<std::mutex>& tpLock) {
-#if defined(__clang__)
-#pragma clang diagnostic push
-#endif
-#if defined(__CLION_IDE__) || defined(__CLION_IDE_)
-#pragma ide diagnostic ignored "ConstantConditionsOC"
-#endif
-    if (!mEnabled)
-        return;
-#if defined(__clang__)
-#pragma clang diagnostic pop
-#endif
-    mTP.mIdleWorkers += 1;
-    assert(tpLock.owns_lock());
-
-    mTP.mCV.wait(tpLock);
-    mTP.mIdleWorkers -= 1;
-
-}
-
-bool AThreadPool::Worker::processQueue(std::unique_lock<std::mutex>& mutex, AQueue<std::function<void()>>& queue) {
-    if (!queue.empty()) {
-        auto func = std::move(queue.front());
-        queue.pop();
-        mutex.unlock();
-        try {
-            func();
-        } catch (const AException& e) {
-            ALogger::err("uncaught exception in thread pool: " + e.getMessage());
-        } catch (const AThread::Interrupted&) {
-        } catch (const TryLaterException&) {
-            mutex.lock();
-            mTP.mQueueTryLater.push(std::move(func));
-            return true;
-        }
-        resetInterruptFlag();
-        mutex.lock();
+bool AThreadPool::Worker::processTask() {
+    auto func = mTP.takeTask(this);
+    if (!func) {
+        return false;
+    }
+    try {
+        (*func)();
+    } catch (const AException& e) {
+        ALogger::err("uncaught exception in thread pool: " + e.getMessage());
+    } catch (const AThread::Interrupted&) {
+    } catch (const TryLaterException&) {
+        mTP.deferTask(std::move(*func));
         return true;
     }
-    return false;
+    resetInterruptFlag();
+    return true;
+}
+
+void AThreadPool::Worker::pushLocal(task t, Priority priority) {
+    std::unique_lock lock(mLocalLock);
+    mLocalQueues[priority].push_back(std::move(t));
+}
+
+AOptional<AThreadPool::task> AThreadPool::Worker::popLocal(Priority priority) {
+    std::unique_lock lock(mLocalLock);
+    auto& queue = mLocalQueues[priority];
+    if (queue.empty()) {
+        return std::nullopt;
+    }
+    auto result = std::move(queue.back());
+    queue.pop_back();
+    return result;
+}
+
+AOptional<AThreadPool::task> AThreadPool::Worker::stealLocal(Priority priority, bool blocking) {
+    std::unique_lock lock(mLocalLock, std::defer_lock);
+    if (blocking) {
+        lock.lock();
+    } else if (!lock.try_lock()) {
+        // either the owner or another thief is here; try someone else.
+        return std::nullopt;
+    }
+    auto& queue = mLocalQueues[priority];
+    if (queue.empty()) {
+        return std::nullopt;
+    }
+    auto result = std::move(queue.front());
+    queue.pop_front();
+    return result;
+}
+
+std::uint32_t AThreadPool::Worker::nextRandom() noexcept {
+    // xorshift32
+    mRandomState ^= mRandomState << 13;
+    mRandomState ^= mRandomState >> 17;
+    mRandomState ^= mRandomState << 5;
+    return mRandomState;
 }
 
 AThreadPool::Worker::~Worker() {
@@ -89,44 +107,135 @@ AThreadPool::Worker::~Worker() {
 
 void AThreadPool::Worker::aboutToDelete() { mEnabled = false; }
 
-void AThreadPool::run(const std::function<void()>& fun, Priority priority) {
-    std::unique_lock lck(mQueueLock);
+void AThreadPool::run(task fun, Priority priority) {
+    mPendingTaskCount[priority] += 1;
+    if (gCurrentWorker != nullptr && &gCurrentWorker->mTP == this) {
+        gCurrentWorker->pushLocal(std::move(fun), priority);
+    } else {
+        std::unique_lock lck(mInjectionLock);
+        mInjectionQueues[priority].push(std::move(fun));
+        mInjectedTaskCount += 1;
+    }
+    unparkOne();
+}
+
+void AThreadPool::unparkOne() {
+    if (mIdleWorkers.load() == 0) {
+        return;
+    }
+    std::unique_lock lck(mParkLock);
+    mParkCV.notify_one();
+}
+
+AOptional<AThreadPool::task> AThreadPool::takeTask(Worker* worker) {
+    for (size_t i = 0; i < PRIORITY_COUNT; ++i) {
+        auto priority = Priority(i);
+        if (mPendingTaskCount[priority].load(std::memory_order_relaxed) == 0) {
+            continue;
+        }
+        AOptional<task> result;
+        if (worker) {
+            result = worker->popLocal(priority);
+        }
+        if (!result) {
+            result = popInjected(priority);
+        }
+        if (!result) {
+            result = steal(worker, priority, false);
+        }
+        if (!result && mPendingTaskCount[priority].load(std::memory_order_relaxed) != 0) {
+            // the try_lock steal might have missed the task because of contention; falling back to a lower priority
+            // would invert priorities.
+            result = steal(worker, priority, true);
+        }
+        if (result) {
+            mPendingTaskCount[priority] -= 1;
+            return result;
+        }
+    }
+    return std::nullopt;
+}
+
+AOptional<AThreadPool::task> AThreadPool::popInjected(Priority priority) {
+    if (mInjectedTaskCount.load(std::memory_order_relaxed) == 0) {
+        return std::nullopt;
+    }
+    std::unique_lock lck(mInjectionLock);
+    auto& queue = mInjectionQueues[priority];
+    if (queue.empty()) {
+        return std::nullopt;
+    }
+    auto result = std::move(queue.front());
+    queue.pop();
+    mInjectedTaskCount -= 1;
+    return result;
+}
 
-    switch (priority) {
-        case PRIORITY_MEDIUM:
-            mQueueMedium.push(fun);
-            break;
-        case PRIORITY_HIGHEST:
-            mQueueHighest.push(fun);
-            break;
-        case PRIORITY_LOWEST:
-            mQueueLowest.push(fun);
-            break;
+AOptional<AThreadPool::task> AThreadPool::steal(Worker* thief, Priority priority, bool blocking) {
+    std::shared_lock lck(mWorkersLock);
+    const auto count = mWorkers.size();
+    if (count == 0) {
+        return std::nullopt;
     }
-    if (mIdleWorkers > 0) {
-        mCV.notify_one();
+    const size_t start = thief ? thief->nextRandom() % count : 0;
+    for (size_t i = 0; i < count; ++i) {
+        auto& victim = mWorkers[(start + i) % count];
+        if (victim.get() == thief) {
+            continue;
+        }
+        if (auto result = victim->stealLocal(priority, blocking)) {
+            return result;
+        }
     }
+    return std::nullopt;
 }
 
-void AThreadPool::clear() {
-    std::unique_lock lck(mQueueLock);
+void AThreadPool::deferTask(task t) {
+    std::unique_lock lck(mInjectionLock);
+    mQueueTryLater.push(std::move(t));
+}
 
-    while (!mQueueLowest.empty()) mQueueLowest.pop();
-    while (!mQueueMedium.empty()) mQueueMedium.pop();
-    while (!mQueueHighest.empty()) mQueueHighest.pop();
-    while (!mQueueTryLater.empty()) mQueueTryLater.pop();
+void AThreadPool::clear() {
+    std::array<size_t, PRIORITY_COUNT> removed{};
+    {
+        std::unique_lock lck(mInjectionLock);
+        for (size_t i = 0; i < PRIORITY_COUNT; ++i) {
+            auto& queue = mInjectionQueues[i];
+            removed[i] += queue.size();
+            mInjectedTaskCount -= queue.size();
+            while (!queue.empty()) queue.pop();
+        }
+        while (!mQueueTryLater.empty()) mQueueTryLater.pop();
+    }
+    {
+        std::shared_lock lck(mWorkersLock);
+        for (const auto& worker : mWorkers) {
+            std::unique_lock workerLock(worker->mLocalLock);
+            for (size_t i = 0; i < PRIORITY_COUNT; ++i) {
+                removed[i] += worker->mLocalQueues[i].size();
+                worker->mLocalQueues[i].clear();
+            }
+        }
+    }
+    for (size_t i = 0; i < PRIORITY_COUNT; ++i) {
+        mPendingTaskCount[i] -= removed[i];
+    }
 }
 
 void AThreadPool::runLaterTasks() {
-    std::unique_lock lck(mQueueLock);
-    while (!mQueueTryLater.empty()) {
-        mQueueLowest.emplace(std::move(mQueueTryLater.front()));
-        mQueueTryLater.pop();
+    {
+        std::unique_lock lck(mInjectionLock);
+        while (!mQueueTryLater.empty()) {
+            mPendingTaskCount[PRIORITY_LOWEST] += 1;
+            mInjectionQueues[PRIORITY_LOWEST].emplace(std::move(mQueueTryLater.front()));
+            mQueueTryLater.pop();
+            mInjectedTaskCount += 1;
+        }
     }
-    mCV.notify_one();
+    unparkOne();
 }
 
-void AThreadPool::enqueue(const std::function<void()>& fun, Priority priority) { global().run(fun, priority); }
+void AThreadPool::enqueue(task fun, Priority priority) { global().run(std::move(fun), priority); }
 
 AThreadPool& AThreadPool::global() {
     // deadlock fix for mingw
@@ -135,6 +244,7 @@ AThreadPool& AThreadPool::global() {
 }
 
 AThreadPool::AThreadPool(size_t size) {
+    std::unique_lock lck(mWorkersLock);
     mWorkers.reserve(size);
     for (size_t i = 0; i < size; ++i) {
         auto worker = _new<Worker>(*this, i);
@@ -151,14 +261,14 @@ AThreadPool::AThreadPool()
             .valueOr(glm::max(std::thread::hardware_concurrency() - 1, 2u))) {}
 
 AThreadPool::~AThreadPool() {
-    std::unique_lock lck(mQueueLock);
+    std::unique_lock lck(mWorkersLock);
     auto workers = std::move(mWorkers);
+    lck.unlock();
     for (auto& f : workers) {
         f->aboutToDelete();
     }
 
-    mCV.notify_all();
-    lck.unlock();
+    wakeUpAll();
 
     for (auto& f : workers) {
         f->join();
@@ -167,22 +277,47 @@ AThreadPool::~AThreadPool() {
 
 void AThreadPool::setWorkersCount(std::size_t workersCount) {
     AUI_ASSERTX(workersCount >= 2 && workersCount <= 1000, "invalid worker count");
-    std::unique_lock lck(mQueueLock);
+    std::unique_lock lck(mWorkersLock);
     if (mWorkers.size() >= workersCount) {
         while (mWorkers.size() > workersCount) {
-            mCV.notify_all();
-            mWorkers.last()->aboutToDelete();
-            lck.unlock();
+            auto worker = std::move(mWorkers.last());
             mWorkers.pop_back();
+            lck.unlock();
+
+            worker->aboutToDelete();
+            wakeUpAll();
+            worker->join();
+
+            // hand over the tasks the worker had not managed to execute.
+            {
+                std::unique_lock injectionLock(mInjectionLock);
+                std::unique_lock workerLock(worker->mLocalLock);
+                for (size_t i = 0; i < PRIORITY_COUNT; ++i) {
+                    for (auto& t : worker->mLocalQueues[i]) {
+                        mInjectionQueues[i].push(std::move(t));
+                        mInjectedTaskCount += 1;
+                    }
+                    worker->mLocalQueues[i].clear();
+                }
+            }
+            unparkOne();
             lck.lock();
         }
     } else {
         // have to add new workers
         mWorkers.reserve(workersCount);
         while (mWorkers.size() < workersCount) {
-            mWorkers.push_back(std::make_unique<Worker>(*this, mWorkers.size()));
+            auto worker = _new<Worker>(*this, mWorkers.size());
+            worker->start();
+            mWorkers.push_back(std::move(worker));
         }
     }
 }
 
-size_t AThreadPool::getPendingTaskCount() { return mQueueHighest.size() + mQueueLowest.size() + mQueueMedium.size(); }
+size_t AThreadPool::getPendingTaskCount() {
+    size_t result = 0;
+    for (const auto& count : mPendingTaskCount) {
+        result += count.load(std::memory_order_relaxed);
+    }
+    return result;
+}
@@ -12,17 +12,23 @@
 #pragma once
 
 #include <cassert>
+#include <array>
 #include <atomic>
+#include <cstdint>
 #include <utility>
 #include <condition_variable>
 #include <glm/glm.hpp>
 
 #include <AUI/Common/AVector.h>
 #include <AUI/Common/AQueue.h>
+#include <AUI/Common/ADeque.h>
+#include <AUI/Common/AOptional.h>
 #include <AUI/Common/AException.h>
 #include <AUI/Thread/AThread.h>
+#include <AUI/Thread/AMutex.h>
 #include <AUI/Thread/AFutureWait.h>
 #include <AUI/Traits/concepts.h>
+#include <AUI/Util/SmallFunction.h>
 #include <AUI/Core.h>
 
 template <typename T>
@@ -31,17 +37,75 @@ class AFuture;
 /**
  * @brief Thread pool implementation.
  * @see AThreadPool::global()
+ * @details
+ * AThreadPool is a work-stealing scheduler. Each worker owns a set of task deques (one per Priority). Tasks submitted
+ * from a worker of the same pool are pushed to that worker's deques, so the tasks spawned by a running task stay on
+ * the same core without touching any shared lock. Tasks submitted from other threads go to the injection queues. An
+ * idle worker looks up the tasks in the following order:
+ *
+ * 1. own deques, most recently pushed first;
+ * 2. injection queues;
+ * 3. deques of the other workers (stealing), least recently pushed first, starting from a random victim.
+ *
+ * Priorities are respected across all of these sources: a worker does not pick a task of a lower priority while a
+ * task of a higher priority is pending anywhere in the pool.
+ *
+ * Workers that have nothing to do are parked on a condition variable and are unparked only when a task is submitted
+ * while there are parked workers.
  */
 class API_AUI_CORE AThreadPool {
+public:
+    enum Priority {
+        PRIORITY_HIGHEST,
+        PRIORITY_MEDIUM,
+        PRIORITY_LOWEST,
+    };
+
+protected:
+    /**
+     * @brief Task representation. Stores small callables inline, so enqueuing them does not allocate.
+     */
+    using task = aui::small_function<void()>;
+    static constexpr size_t PRIORITY_COUNT = PRIORITY_LOWEST + 1;
+
 public:
     class API_AUI_CORE Worker : public AThread {
+        friend class AThreadPool;
+
     private:
-        bool mEnabled = true;
-        bool processQueue(std::unique_lock<std::mutex>& mutex, AQueue<std::function<void()>>& queue);
+        std::atomic_bool mEnabled = true;
         AThreadPool& mTP;
 
-        void iteration(std::unique_lock<std::mutex>& tpLock);
-        void wait(std::unique_lock<std::mutex>& tpLock);
+        /**
+         * @brief Worker-local task deques, one per priority.
+         * @details
+         * The owner pushes and pops at the back; other workers steal from the front. The lock is contended only when
+         * somebody steals from this worker.
+         */
+        ASpinlockMutex mLocalLock;
+        std::array<ADeque<task>, PRIORITY_COUNT> mLocalQueues;
+
+        /**
+         * @brief State of xorshift generator used to pick a victim to steal from.
+         */
+        std::uint32_t mRandomState;
+
+        /**
+         * @brief Picks a single task and executes it.
+         * @return false, if there was no task to execute.
+         */
+        bool processTask();
+        void iteration();
+
+        void pushLocal(task t, Priority priority);
+        AOptional<task> popLocal(Priority priority);
+
+        /**
+         * @brief Takes the oldest task of the priority.
+         * @param blocking if false, gives up when the queue is locked by its owner or another thief.
+         */
+        AOptional<task> stealLocal(Priority priority, bool blocking);
+        std::uint32_t nextRandom() noexcept;
 
     public:
         Worker(AThreadPool& tp, size_t index);
@@ -50,35 +114,75 @@ public:
 
         template <aui::predicate ShouldContinue>
         void loop(ShouldContinue&& shouldContinue) {
-            std::unique_lock lock(mTP.mQueueLock);
             while (shouldContinue()) {
-                iteration(lock);
-                if (!shouldContinue()) {
-                    return;
+                if (processTask()) {
+                    continue;
                 }
-                wait(lock);
+                mTP.park([&] { return !mEnabled || !shouldContinue(); });
             }
         }
 
         AThreadPool& threadPool() noexcept { return mTP; }
     };
 
-    enum Priority {
-        PRIORITY_HIGHEST,
-        PRIORITY_MEDIUM,
-        PRIORITY_LOWEST,
-    };
-
 protected:
-    typedef std::function<void()> task;
     AVector<_<Worker>> mWorkers;
-    AQueue<task> mQueueHighest;
-    AQueue<task> mQueueMedium;
-    AQueue<task> mQueueLowest;
+
+    /**
+     * @brief Guards mWorkers. Exclusively locked only when the worker set changes; stealing workers hold it shared.
+     */
+    ASharedMutex mWorkersLock;
+
+    /**
+     * @brief Queues for tasks submitted from threads that are not workers of this pool.
+     */
+    std::array<AQueue<task>, PRIORITY_COUNT> mInjectionQueues;
     AQueue<task> mQueueTryLater;
-    std::mutex mQueueLock;
-    std::condition_variable mCV;
-    size_t mIdleWorkers = 0;
+    AMutex mInjectionLock;
+    std::atomic_size_t mInjectedTaskCount = 0;
+
+    /**
+     * @brief Count of tasks ready for execution, per priority, across the injection queues and all worker deques.
+     * @details
+     * Incremented before a task is pushed, so a worker may observe a positive count shortly before the task becomes
+     * reachable; in that case the worker retries instead of parking.
+     */
+    std::array<std::atomic_size_t, PRIORITY_COUNT> mPendingTaskCount{};
+
+    std::mutex mParkLock;
+    std::condition_variable mParkCV;
+    std::atomic_size_t mIdleWorkers = 0;
+
+    [[nodiscard]]
+    bool hasPendingTasks() const noexcept {
+        for (const auto& count : mPendingTaskCount) {
+            if (count.load() > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Parks the calling worker until a task is submitted or wakeUp returns true.
+     * @details
+     * wakeUp is evaluated with mParkLock held, so a state change followed by wakeUpAll() is never missed.
+     */
+    template <aui::predicate WakeUp>
+    void park(WakeUp&& wakeUp) {
+        std::unique_lock lock(mParkLock);
+        mIdleWorkers += 1;
+        while (!hasPendingTasks() && !wakeUp()) {
+            mParkCV.wait(lock);
+        }
+        mIdleWorkers -= 1;
+    }
+
+    void unparkOne();
+    AOptional<task> takeTask(Worker* worker);
+    AOptional<task> popInjected(Priority priority);
+    AOptional<task> steal(Worker* thief, Priority priority, bool blocking);
+    void deferTask(task t);
 
 public:
     /**
@@ -97,16 +201,16 @@ public:
     size_t getTotalTaskCount() {
         return getPendingTaskCount() + getTotalWorkerCount() - getIdleWorkerCount();
     }
-    void run(const std::function<void()>& fun, Priority priority = PRIORITY_MEDIUM);
+    void run(task fun, Priority priority = PRIORITY_MEDIUM);
     void clear();
     void runLaterTasks();
-    static void enqueue(const std::function<void()>& fun, Priority priority = PRIORITY_MEDIUM);
+    static void enqueue(task fun, Priority priority = PRIORITY_MEDIUM);
 
     void setWorkersCount(std::size_t workersCount);
 
     void wakeUpAll() {
-        std::unique_lock lck(mQueueLock);
-        mCV.notify_all();
+        std::unique_lock lck(mParkLock);
+        mParkCV.notify_all();
     }
 
     /**
@@ -120,7 +224,7 @@ public:
     }
 
     size_t getTotalWorkerCount() const { return mWorkers.size(); }
-    size_t getIdleWorkerCount() const { return mIdleWorkers; }
+    size_t getIdleWorkerCount() const { return mIdleWorkers.load(); }
 
     /**
      * Parallels work of some range, grouping tasks per thread (i.e. for 8 items on a 4-core processor each core will
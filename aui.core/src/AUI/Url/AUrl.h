@@ -74,6 +74,13 @@ private:
 };
 
 
+template<>
+struct std::hash<AUrl> {
+    size_t operator()(const AUrl& t) const noexcept {
+        return std::hash<AString>()(t.schema()) * 31 ^ std::hash<AString>()(t.path());
+    }
+};
+
 inline AUrl operator""_url(const char* input, size_t s) {
     return AUrl(AString(input, s));
 }
\ No newline at end of file
@@ -0,0 +1,147 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <AUI/Util/SmallFunction.h>
+
+/**
+ * @brief Lock-free multi-producer single-consumer message (callback) queue.
+ * @ingroup core
+ * @details
+ * Drop-in alternative to AMessageQueue for the cases when many threads post messages to a single consumer thread
+ * (i.e., worker threads posting progress updates to UI thread).
+ *
+ * Producers push intrusive nodes to an atomic LIFO list with a single CAS and never block each other or the consumer.
+ * The consumer grabs the whole list with a single atomic exchange, reverses it to restore FIFO order and then
+ * processes the batch without touching shared state.
+ *
+ * enqueue() reports whether the queue was empty, so the caller can wake the consumer only when it actually needs to
+ * (see AAbstractThread::enqueue).
+ *
+ * The implementation supports enqueueing new messages inside the callbacks.
+ *
+ * Consumer-side methods (pop(), processMessages()) must be called from a single thread at a time.
+ */
+template<typename... Args>
+class ALockFreeMessageQueue {
+public:
+    using Message = aui::small_function<void(Args...)>;
+
+    ALockFreeMessageQueue() = default;
+    ALockFreeMessageQueue(const ALockFreeMessageQueue&) = delete;
+    ALockFreeMessageQueue& operator=(const ALockFreeMessageQueue&) = delete;
+
+    ~ALockFreeMessageQueue() {
+        destroyList(mConsumerList);
+        destroyList(mProducerList.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Add message to the queue to process in processMessages(). Safe to call from any thread.
+     * @return true, if there were no messages waiting for the consumer to grab them, i.e., the consumer should be
+     *         notified. If false is returned, the producer that pushed the oldest ungrabbed message has already got
+     *         true and notified the consumer.
+     */
+    bool enqueue(Message message) {
+        auto node = new Node{ std::move(message), nullptr };
+        mSize.fetch_add(1, std::memory_order_relaxed);
+        auto head = mProducerList.load(std::memory_order_relaxed);
+        do {
+            node->next = head;
+        } while (!mProducerList.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+        // node belongs to the consumer from now on; don't touch it.
+        return head == nullptr;
+    }
+
+    /**
+     * @brief Takes the oldest message out of the queue. Consumer thread only.
+     * @return the message or empty Message if there are no messages.
+     */
+    [[nodiscard]]
+    Message pop() {
+        if (mConsumerList == nullptr) {
+            mConsumerList = reverse(mProducerList.exchange(nullptr, std::memory_order_acquire));
+            if (mConsumerList == nullptr) {
+                return nullptr;
+            }
+        }
+        std::unique_ptr<Node> node(mConsumerList);
+        mConsumerList = node->next;
+        mSize.fetch_sub(1, std::memory_order_relaxed);
+        return std::move(node->message);
+    }
+
+    /**
+     * @brief Process messages submitted by enqueue method. Consumer thread only.
+     * @details
+     * Messages are drained in batches: producer list is grabbed at once, so producers are never blocked by the
+     * consumer. If a message throws, the remaining messages stay in the queue.
+     */
+    void processMessages(Args... args) {
+        while (auto message = pop()) {
+            message(args...);
+        }
+    }
+
+    /**
+     * @brief Approximate count of messages in the queue. Safe to call from any thread.
+     */
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+        return mSize.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Checks whether there are messages to process. Consumer thread only.
+     */
+    [[nodiscard]]
+    bool empty() const noexcept {
+        return mConsumerList == nullptr && mProducerList.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct Node {
+        Message message;
+        Node* next;
+    };
+
+    /**
+     * @brief LIFO list of recently pushed messages. Shared between producers and the consumer.
+     */
+    alignas(64) std::atomic<Node*> mProducerList = nullptr;
+    std::atomic_size_t mSize = 0;
+
+    /**
+     * @brief FIFO list of messages grabbed by the consumer. Accessed by consumer only.
+     */
+    alignas(64) Node* mConsumerList = nullptr;
+
+    static Node* reverse(Node* list) noexcept {
+        Node* result = nullptr;
+        while (list) {
+            auto next = list->next;
+            list->next = result;
+            result = list;
+            list = next;
+        }
+        return result;
+    }
+
+    static void destroyList(Node* list) noexcept {
+        while (list) {
+            delete std::exchange(list, list->next);
+        }
+    }
+};
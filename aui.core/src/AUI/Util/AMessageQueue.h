@@ -18,6 +18,7 @@
 
 #include <AUI/Thread/AMutex.h>
 #include <AUI/Common/ADeque.h>
+#include <AUI/Util/SmallFunction.h>
 
 /**
  * @brief Universal thread-safe message (callback) queue implementation.
@@ -28,7 +29,7 @@
 template<typename Mutex = AMutex, typename... Args>
 class AMessageQueue {
 public:
-    using Message = std::function<void(Args...)>;
+    using Message = aui::small_function<void(Args...)>;
 
     /**
      * @brief Add message to the queue to process in processMessages().
@@ -11,48 +11,280 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <list>
 #include "AUI/Common/AString.h"
 #include "AUI/Common/AMap.h"
 #include "AUI/Common/SharedPtr.h"
 #include "AUI/Thread/AMutex.h"
+#include "AUI/Thread/AFuture.h"
+#include "AUI/Performance/APerformanceSection.h"
 
+/**
+ * @brief Thread-safe bounded cache of shared resources loaded by key.
+ * @tparam T resource type.
+ * @tparam Container derived singleton type providing static `inst()`.
+ * @tparam K key type. Must be less-than comparable and hashable with std::hash.
+ * @details
+ * Once total cost of the entries exceeds capacity, least recently used entries are evicted. Cost of an entry is
+ * defined by cost() (1 by default, so the capacity is the entry count). The capacity is unbounded unless specified in
+ * the constructor or with setCapacity().
+ *
+ * Entries are distributed among shards by key hash; each shard is guarded by its own mutex, so lookups of different
+ * keys from different threads rarely contend.
+ *
+ * Concurrent misses on the same key are coalesced: load() is called once, the other threads wait for its AFuture.
+ */
 template<typename T, typename Container, typename K = AString>
 class Cache {
-private:
-    AMap<K, _<T>> mContainer;
-    AMutex mSync;
-
-protected:
-    virtual _<T> load(const K& key) = 0;
+public:
+    struct Stats {
+        std::size_t hits = 0;
+        std::size_t misses = 0;
 
-    virtual bool isShouldBeCached(const K& key, const _<T>& image) {
-        return true;
-    }
+        /**
+         * @brief Misses that waited for a load() started by another thread instead of calling load().
+         */
+        std::size_t coalescedLoads = 0;
+        std::size_t evictions = 0;
+        std::size_t entries = 0;
+        std::size_t cost = 0;
+    };
 
-public:
+    virtual ~Cache() = default;
 
+    /**
+     * @brief Returns the cached value or loads it with load().
+     * @details
+     * If the value is being loaded by another thread, waits for it.
+     */
     static _<T> get(const K& key) {
-        Cache& i = Container::inst();
+        Cache& self = Container::inst();
+        Shard& shard = self.shardOf(key);
+        AFuture<_<T>> loading;
         {
-            std::unique_lock lock(i.mSync);
-            if (auto i = Container::inst().mContainer.contains(key)) {
-                return i->second;
+            std::unique_lock lock(shard.sync);
+            if (auto it = shard.entries.find(key); it != shard.entries.end()) {
+                it->second.lruPosition->lastUse = now();
+                shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lruPosition);
+                shard.hits++;
+                return it->second.value;
+            }
+            shard.misses++;
+            if (auto it = shard.loading.find(key); it != shard.loading.end()) {
+                shard.coalescedLoads++;
+                auto future = it->second;
+                lock.unlock();
+                return *future;
+            }
+            shard.loading.emplace(key, loading);
+        }
+
+        _<T> value;
+        try {
+#if AUI_PROFILING
+            APerformanceSection section("Cache::load", std::nullopt, self.statsString());
+#endif
+            value = self.load(key);
+        } catch (...) {
+            {
+                std::unique_lock lock(shard.sync);
+                shard.loading.erase(key);
             }
+            loading.supplyException();
+            throw;
         }
-        auto value = i.load(key);
-        if (i.isShouldBeCached(key, value)) {
-            put(key, value);
+
+        {
+            std::unique_lock lock(shard.sync);
+            shard.loading.erase(key);
+            if (self.isShouldBeCached(key, value)) {
+                self.insert(shard, key, value);
+            }
         }
+        loading.supplyValue(value);
+        self.evictIfNeeded();
         return value;
     }
 
     static void put(const K& key, _<T> value) {
-        std::unique_lock lock(Container::inst().mSync);
-        Container::inst().mContainer[key] = value;
+        Cache& self = Container::inst();
+        Shard& shard = self.shardOf(key);
+        {
+            std::unique_lock lock(shard.sync);
+            self.insert(shard, key, std::move(value));
+        }
+        self.evictIfNeeded();
     }
 
+    /**
+     * @brief Removes all entries and resets statistics.
+     */
     static void cleanup() {
-        std::unique_lock lock(Container::inst().mSync);
-        Container::inst().mContainer.clear();
+        Cache& self = Container::inst();
+        for (auto& shard : self.mShards) {
+            AMap<K, Entry> entries;   // values are released outside the lock
+            std::unique_lock lock(shard.sync);
+            for (const auto& [key, entry] : shard.entries) {
+                self.mCost -= entry.cost;
+            }
+            entries = std::move(shard.entries);
+            shard.entries.clear();
+            shard.lru.clear();
+            shard.hits = shard.misses = shard.coalescedLoads = shard.evictions = 0;
+        }
+    }
+
+    /**
+     * @brief Sets maximum total cost of the entries. Evicts entries if needed.
+     */
+    static void setCapacity(std::size_t capacity) {
+        Cache& self = Container::inst();
+        self.mCapacity = capacity;
+        self.evictIfNeeded();
+    }
+
+    [[nodiscard]]
+    static std::size_t capacity() {
+        return Container::inst().mCapacity;
+    }
+
+    [[nodiscard]]
+    static Stats stats() {
+        Cache& self = Container::inst();
+        Stats result;
+        for (auto& shard : self.mShards) {
+            std::unique_lock lock(shard.sync);
+            result.hits += shard.hits;
+            result.misses += shard.misses;
+            result.coalescedLoads += shard.coalescedLoads;
+            result.evictions += shard.evictions;
+            result.entries += shard.entries.size();
+        }
+        result.cost = self.mCost;
+        return result;
+    }
+
+protected:
+    explicit Cache(std::size_t capacity = std::numeric_limits<std::size_t>::max()): mCapacity(capacity) {}
+
+    virtual _<T> load(const K& key) = 0;
+
+    virtual bool isShouldBeCached(const K& key, const _<T>& image) {
+        return true;
+    }
+
+    /**
+     * @brief Cost of the entry in units of capacity (i.e., size in bytes).
+     */
+    virtual std::size_t cost(const K& key, const _<T>& value) {
+        return 1;
+    }
+
+private:
+    static constexpr std::size_t SHARD_COUNT = 8;
+
+    struct LruNode {
+        K key;
+        std::chrono::steady_clock::rep lastUse;
+    };
+
+    struct Entry {
+        _<T> value;
+        std::size_t cost;
+        typename std::list<LruNode>::iterator lruPosition;
+    };
+
+    struct Shard {
+        AMutex sync;
+        AMap<K, Entry> entries;
+
+        /**
+         * @brief Most recently used entries first.
+         */
+        std::list<LruNode> lru;
+        AMap<K, AFuture<_<T>>> loading;
+
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        std::size_t coalescedLoads = 0;
+        std::size_t evictions = 0;
+    };
+
+    std::array<Shard, SHARD_COUNT> mShards;
+    std::atomic_size_t mCapacity;
+    std::atomic_size_t mCost = 0;
+
+    static std::chrono::steady_clock::rep now() noexcept {
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+    }
+
+    Shard& shardOf(const K& key) {
+        return mShards[std::hash<K>()(key) % SHARD_COUNT];
+    }
+
+    /**
+     * @brief Inserts or replaces an entry. shard.sync must be locked.
+     */
+    void insert(Shard& shard, const K& key, _<T> value) {
+        const auto entryCost = cost(key, value);
+        if (auto it = shard.entries.find(key); it != shard.entries.end()) {
+            mCost -= it->second.cost;
+            it->second.value = std::move(value);
+            it->second.cost = entryCost;
+            it->second.lruPosition->lastUse = now();
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lruPosition);
+        } else {
+            shard.lru.push_front({ key, now() });
+            shard.entries.emplace(key, Entry { std::move(value), entryCost, shard.lru.begin() });
+        }
+        mCost += entryCost;
+    }
+
+    /**
+     * @brief Evicts least recently used entries until total cost fits the capacity.
+     * @details
+     * Shards are locked one at a time: the oldest entry among shard tails is found first, then it is evicted from its
+     * shard.
+     */
+    void evictIfNeeded() {
+        while (mCost > mCapacity) {
+            Shard* victim = nullptr;
+            auto oldest = std::numeric_limits<std::chrono::steady_clock::rep>::max();
+            for (auto& shard : mShards) {
+                std::unique_lock lock(shard.sync);
+                if (!shard.lru.empty() && shard.lru.back().lastUse < oldest) {
+                    oldest = shard.lru.back().lastUse;
+                    victim = &shard;
+                }
+            }
+            if (victim == nullptr) {
+                return;
+            }
+
+            _<T> evicted;   // released outside the lock
+            std::unique_lock lock(victim->sync);
+            if (victim->lru.empty()) {
+                continue;
+            }
+            auto it = victim->entries.find(victim->lru.back().key);
+            evicted = std::move(it->second.value);
+            mCost -= it->second.cost;
+            victim->entries.erase(it);
+            victim->lru.pop_back();
+            victim->evictions++;
+            lock.unlock();
+        }
+    }
+
+#if AUI_PROFILING
+    std::string statsString() {
+        auto s = stats();
+        return fmt::format("hits: {}, misses: {}, coalesced: {}, evictions: {}, entries: {}, cost: {}", s.hits,
+                           s.misses, s.coalescedLoads, s.evictions, s.entries, s.cost);
     }
+#endif
 };
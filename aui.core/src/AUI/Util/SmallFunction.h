@@ -0,0 +1,205 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <AUI/Util/Assert.h>
+
+namespace aui {
+
+template <typename Signature, std::size_t StackSize = 64>
+class small_function;
+
+namespace detail {
+template <typename T>
+struct is_nullable_callable : std::bool_constant<std::is_pointer_v<T> || std::is_member_pointer_v<T>> {};
+
+template <typename Signature>
+struct is_nullable_callable<std::function<Signature>> : std::true_type {};
+}   // namespace detail
+
+/**
+ * @brief Move-only type-erased callable with small buffer optimization.
+ * @ingroup useful_templates
+ * @details
+ * `small_function` is a replacement for `std::function` in hot paths such as task queues. Unlike `std::function`, it:
+ *
+ * - is move-only, so it can hold move-only callables (i.e., lambdas capturing `std::unique_ptr` or another
+ *   `small_function`);
+ * - stores the callable inline when it fits to `StackSize` bytes and is nothrow move constructible, avoiding heap
+ *   allocation. `std::function` implementations typically store only up to 16 bytes inline;
+ * - is invoked through a non-const `operator()`, so `mutable` lambdas are allowed.
+ *
+ * Larger callables are heap allocated, just like in `std::function`.
+ *
+ * Moved-from `small_function` is guaranteed to be empty.
+ *
+ * ```cpp
+ * aui::small_function<int(int)> f = [offset = 2](int v) { return v + offset; };
+ * f(1); // 3
+ * ```
+ *
+ * @tparam R return type.
+ * @tparam Args argument types.
+ * @tparam StackSize size of the inline buffer in bytes.
+ */
+template <typename R, typename... Args, std::size_t StackSize>
+class small_function<R(Args...), StackSize> {
+    static_assert(StackSize >= sizeof(void*), "StackSize must be able to hold a pointer");
+
+public:
+    small_function() noexcept = default;
+    small_function(std::nullptr_t) noexcept {}
+
+    template <typename F>
+        requires(!std::is_same_v<std::decay_t<F>, small_function>) &&
+                std::is_invocable_r_v<R, std::decay_t<F>&, Args...>
+    small_function(F&& f) {
+        using T = std::decay_t<F>;
+        if constexpr (detail::is_nullable_callable<T>::value) {
+            if (f == nullptr) {
+                return;
+            }
+        }
+        if constexpr (fits_inline<T>) {
+            new (mBuffer) T(std::forward<F>(f));
+            mVTable = &INLINE_VTABLE<T>;
+        } else {
+            *reinterpret_cast<T**>(mBuffer) = new T(std::forward<F>(f));
+            mVTable = &HEAP_VTABLE<T>;
+        }
+    }
+
+    small_function(small_function&& rhs) noexcept { moveFrom(rhs); }
+
+    small_function(const small_function&) = delete;
+    small_function& operator=(const small_function&) = delete;
+
+    small_function& operator=(small_function&& rhs) noexcept {
+        if (this != &rhs) {
+            reset();
+            moveFrom(rhs);
+        }
+        return *this;
+    }
+
+    small_function& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    template <typename F>
+        requires(!std::is_same_v<std::decay_t<F>, small_function>) &&
+                std::is_invocable_r_v<R, std::decay_t<F>&, Args...>
+    small_function& operator=(F&& f) {
+        return *this = small_function(std::forward<F>(f));
+    }
+
+    ~small_function() { reset(); }
+
+    R operator()(Args... args) {
+        AUI_ASSERTX(mVTable != nullptr, "calling an empty small_function");
+        return mVTable->invoke(mBuffer, std::forward<Args>(args)...);
+    }
+
+    [[nodiscard]]
+    explicit operator bool() const noexcept {
+        return mVTable != nullptr;
+    }
+
+    [[nodiscard]]
+    bool operator==(std::nullptr_t) const noexcept {
+        return mVTable == nullptr;
+    }
+
+    /**
+     * @return true, if the held callable did not fit to the inline buffer and was allocated on the heap.
+     */
+    [[nodiscard]]
+    bool isHeapAllocated() const noexcept {
+        return mVTable != nullptr && mVTable->heapAllocated;
+    }
+
+    /**
+     * @brief Whether callable of type T would be stored without heap allocation.
+     */
+    template <typename T>
+    static constexpr bool fits_inline = sizeof(T) <= StackSize && alignof(T) <= alignof(std::max_align_t) &&
+                                        std::is_nothrow_move_constructible_v<T>;
+
+private:
+    struct VTable {
+        R (*invoke)(void* storage, Args&&... args);
+
+        /**
+         * @brief Moves the callable from src storage to uninitialized dst storage and destroys the source.
+         */
+        void (*relocate)(void* dst, void* src) noexcept;
+        void (*destroy)(void* storage) noexcept;
+        bool heapAllocated;
+    };
+
+    template <typename T>
+    static R invokeImpl(T& callable, Args&&... args) {
+        if constexpr (std::is_void_v<R>) {
+            std::invoke(callable, std::forward<Args>(args)...);
+        } else {
+            return std::invoke(callable, std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename T>
+    static constexpr VTable INLINE_VTABLE = {
+        .invoke = [](void* storage, Args&&... args) -> R {
+            return invokeImpl(*static_cast<T*>(storage), std::forward<Args>(args)...);
+        },
+        .relocate =
+            [](void* dst, void* src) noexcept {
+                new (dst) T(std::move(*static_cast<T*>(src)));
+                static_cast<T*>(src)->~T();
+            },
+        .destroy = [](void* storage) noexcept { static_cast<T*>(storage)->~T(); },
+        .heapAllocated = false,
+    };
+
+    template <typename T>
+    static constexpr VTable HEAP_VTABLE = {
+        .invoke = [](void* storage, Args&&... args) -> R {
+            return invokeImpl(**static_cast<T**>(storage), std::forward<Args>(args)...);
+        },
+        .relocate = [](void* dst, void* src) noexcept { *static_cast<T**>(dst) = *static_cast<T**>(src); },
+        .destroy = [](void* storage) noexcept { delete *static_cast<T**>(storage); },
+        .heapAllocated = true,
+    };
+
+    alignas(std::max_align_t) unsigned char mBuffer[StackSize];
+    const VTable* mVTable = nullptr;
+
+    void reset() noexcept {
+        if (mVTable) {
+            std::exchange(mVTable, nullptr)->destroy(mBuffer);
+        }
+    }
+
+    void moveFrom(small_function& rhs) noexcept {
+        if (rhs.mVTable) {
+            rhs.mVTable->relocate(mBuffer, rhs.mBuffer);
+            mVTable = std::exchange(rhs.mVTable, nullptr);
+        }
+    }
+};
+
+}   // namespace aui
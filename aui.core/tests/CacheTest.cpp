@@ -0,0 +1,97 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "AUI/Util/Cache.h"
+
+using namespace std::chrono_literals;
+
+namespace {
+
+/**
+ * Caches strings of the key's length. Cost is the string length.
+ */
+class StringCache : public Cache<AString, StringCache, int> {
+public:
+    static StringCache& inst() {
+        static StringCache s;
+        return s;
+    }
+
+    std::atomic_int loadCount = 0;
+    std::chrono::milliseconds loadDelay = 0ms;
+
+protected:
+    _<AString> load(const int& key) override {
+        ++loadCount;
+        std::this_thread::sleep_for(loadDelay);
+        return _new<AString>(std::size_t(key), 'x');
+    }
+
+    std::size_t cost(const int& key, const _<AString>& value) override {
+        return value->length();
+    }
+};
+
+}   // namespace
+
+class CacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        StringCache::cleanup();
+        StringCache::setCapacity(std::numeric_limits<std::size_t>::max());
+        StringCache::inst().loadCount = 0;
+        StringCache::inst().loadDelay = 0ms;
+    }
+};
+
+TEST_F(CacheTest, Hit) {
+    auto first = StringCache::get(3);
+    auto second = StringCache::get(3);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(*first, "xxx");
+    EXPECT_EQ(StringCache::inst().loadCount, 1);
+}
+
+TEST_F(CacheTest, EvictsLeastRecentlyUsed) {
+    StringCache::setCapacity(10);
+    StringCache::get(4);
+    std::this_thread::sleep_for(1ms);
+    StringCache::get(5);
+    std::this_thread::sleep_for(1ms);
+    StringCache::get(4);   // 4 is more recently used than 5 now
+    std::this_thread::sleep_for(1ms);
+    StringCache::get(3);   // 4 + 5 + 3 > 10; evicts 5
+
+    EXPECT_EQ(StringCache::stats().cost, 7);
+    EXPECT_EQ(StringCache::stats().evictions, 1);
+    EXPECT_EQ(StringCache::inst().loadCount, 3);
+
+    StringCache::get(4);
+    StringCache::get(3);
+    EXPECT_EQ(StringCache::inst().loadCount, 3);
+    StringCache::get(5);
+    EXPECT_EQ(StringCache::inst().loadCount, 4);
+}
+
+TEST_F(CacheTest, ConcurrentMissesAreCoalesced) {
+    StringCache::inst().loadDelay = 100ms;
+    AVector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads << std::thread([] { EXPECT_EQ(*StringCache::get(8), "xxxxxxxx"); });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(StringCache::inst().loadCount, 1);
+    EXPECT_EQ(StringCache::stats().coalescedLoads, 3);
+}
@@ -0,0 +1,133 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <thread>
+#include "AUI/Logging/ALogger.h"
+
+using namespace std::chrono_literals;
+
+class LoggerTest : public ::testing::Test {
+protected:
+    APath mLogPath = APath::getDefaultPath(APath::TEMP).makeDirs() / "aui.logger_test.log";
+
+    AVector<std::string> readLog() {
+        AVector<std::string> result;
+        std::ifstream fis(mLogPath.toStdString());
+        for (std::string line; std::getline(fis, line);) {
+            result << std::move(line);
+        }
+        return result;
+    }
+};
+
+TEST_F(LoggerTest, AsyncWritesEverythingInThreadOrder) {
+    static constexpr auto THREADS = 4;
+    static constexpr auto ENTRIES = 200;
+    ALogger logger(mLogPath);
+    logger.enableAsync();
+    EXPECT_TRUE(logger.isAsync());
+
+    AVector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads << std::thread([&, t] {
+            for (int i = 0; i < ENTRIES; ++i) {
+                logger.log(ALogger::INFO, "LoggerTest") << "thread " << t << " entry " << i;
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    logger.flush();
+
+    auto lines = readLog();
+    for (int t = 0; t < THREADS; ++t) {
+        auto needle = "thread {} entry "_format(t).toStdString();
+        int expected = 0;
+        for (const auto& line : lines) {
+            auto pos = line.find(needle);
+            if (pos == std::string::npos) {
+                continue;
+            }
+            EXPECT_EQ(line.substr(pos + needle.size()), std::to_string(expected));
+            ++expected;
+        }
+        EXPECT_EQ(expected, ENTRIES);
+    }
+}
+
+TEST_F(LoggerTest, AsyncDropPolicy) {
+    static constexpr auto BUFFER_SIZE = 256;
+    static constexpr auto ENTRIES = 100;
+    static constexpr std::string_view NEEDLE = "drop test entry ";
+    ALogger logger(mLogPath);
+    logger.enableAsync({ .bufferSize = BUFFER_SIZE, .overflowPolicy = ALogger::OverflowPolicy::DROP, .flushInterval = 1h });
+
+    // holding the log file blocks the writer thread on the output, so the staging buffer is never freed and overflow
+    // is guaranteed.
+    logger.doLogFileAccessSafe([&] {
+        for (int i = 0; i < ENTRIES; ++i) {
+            // fixed width so all the entries are of the same length.
+            logger.log(ALogger::INFO, "LoggerTest") << "{}{:03}"_format(NEEDLE, i);
+        }
+    });
+    logger.flush();
+
+    auto lines = readLog();
+    AVector<std::string> written;
+    for (const auto& line : lines) {
+        if (line.find(NEEDLE) != std::string::npos) {
+            written << line;
+        }
+    }
+    ASSERT_FALSE(written.empty());
+    const auto entrySize = written.first().size() + 1;   // + '\n'
+    EXPECT_EQ(written.size(), BUFFER_SIZE / entrySize);
+    EXPECT_EQ(logger.droppedCount(), ENTRIES - written.size());
+
+    // the blocked writer might have already taken a part of the drop count, so the notice can be split.
+    std::size_t reportedDropped = 0;
+    for (const auto& line : lines) {
+        static constexpr std::string_view NOTICE = " entries dropped";
+        if (line.ends_with(NOTICE)) {
+            auto number = line.substr(0, line.size() - NOTICE.size());
+            reportedDropped += std::stoul(number.substr(number.rfind(' ') + 1));
+        }
+    }
+    EXPECT_EQ(reportedDropped, ENTRIES - written.size());
+}
+
+TEST_F(LoggerTest, AsyncDestructionWritesEverything) {
+    static constexpr auto THREADS = 4;
+    static constexpr auto ENTRIES = 200;
+    {
+        ALogger logger(mLogPath);
+        logger.enableAsync({ .bufferSize = 256 });
+        AVector<std::thread> threads;
+        for (int t = 0; t < THREADS; ++t) {
+            threads << std::thread([&, t] {
+                for (int i = 0; i < ENTRIES; ++i) {
+                    logger.log(ALogger::INFO, "LoggerTest") << "thread " << t << " entry " << i;
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        // no flush; the destructor must write the staged entries out.
+    }
+    auto lines = readLog();
+    EXPECT_EQ(std::count_if(lines.begin(), lines.end(),
+                            [](const std::string& line) { return line.find(" entry ") != std::string::npos; }),
+              THREADS * ENTRIES);
+}
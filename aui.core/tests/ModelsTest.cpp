@@ -131,3 +131,163 @@ TEST(Models, FilterInvalidate) {
     AVector<int> expected = { 2, 6, 72, 14, 66, 28 };
     ASSERT_EQ(filteredModel->toVector(), expected);
 }
+
+/**
+ * Inserts and removes items of the source model; the filtered model reports only the rows passing the filter.
+ */
+TEST(Models, FilterSourceInsertRemove) {
+    auto model = testModel();
+    auto filteredModel = AModels::filter(model, [](int i) {
+        return i % 2 == 0;
+    });
+    auto inserted = _new<Receiver>();
+    auto removed = _new<Receiver>();
+    AObject::connect(filteredModel->dataInserted, AUI_SLOT(inserted)::receive);
+    AObject::connect(filteredModel->dataRemoved, AUI_SLOT(removed)::receive);
+
+    testing::InSequence s;
+    EXPECT_CALL(*inserted, receive(filteredModel->range(1, 3)));
+    EXPECT_CALL(*removed, receive(filteredModel->range(0, 2)));
+
+    AVector<int> items = { 3, 4, 6, 9 };
+    model->insert(model->begin() + 3, items.begin(), items.end()); // after 72
+    EXPECT_EQ(filteredModel->toVector(), AVector<int>({ 72, 4, 6, 14, 66, 28 }));
+
+    model->erase(model->begin(), model->begin() + 5); // 1, 5, 72, 3, 4
+    EXPECT_EQ(filteredModel->toVector(), AVector<int>({ 6, 14, 66, 28 }));
+
+    model->insert(model->begin(), 7); // not reported
+    EXPECT_EQ(filteredModel->toVector(), AVector<int>({ 6, 14, 66, 28 }));
+}
+
+/**
+ * Changes items of the source model so they start or stop passing the filter.
+ */
+TEST(Models, FilterSourceChange) {
+    auto model = testModel();
+    auto filteredModel = AModels::filter(model, [](int i) {
+        return i % 2 == 0;
+    });
+    auto changed = _new<Receiver>();
+    auto inserted = _new<Receiver>();
+    auto removed = _new<Receiver>();
+    AObject::connect(filteredModel->dataChanged, AUI_SLOT(changed)::receive);
+    AObject::connect(filteredModel->dataInserted, AUI_SLOT(inserted)::receive);
+    AObject::connect(filteredModel->dataRemoved, AUI_SLOT(removed)::receive);
+
+    testing::InSequence s;
+    EXPECT_CALL(*changed, receive(filteredModel->range(0, 1)));
+    EXPECT_CALL(*removed, receive(filteredModel->range(0, 1)));
+    EXPECT_CALL(*inserted, receive(filteredModel->range(0, 1)));
+
+    model->at(2) = 70;
+    model->invalidate(2);
+    EXPECT_EQ(filteredModel->toVector(), AVector<int>({ 70, 14, 66, 28 }));
+
+    model->at(2) = 71;
+    model->invalidate(2);
+    EXPECT_EQ(filteredModel->toVector(), AVector<int>({ 14, 66, 28 }));
+
+    model->at(0) = 2;
+    model->invalidate(0);
+    EXPECT_EQ(filteredModel->toVector(), AVector<int>({ 2, 14, 66, 28 }));
+}
+
+/**
+ * Changes the filter; invalidate reports the rows that started or stopped passing it only.
+ */
+TEST(Models, FilterInvalidateMinimalRanges) {
+    auto model = testModel(); // 1, 5, 72, 23, 14, 35, 66, 37, 28, 19
+    int threshold = 20;
+    auto filteredModel = AModels::filter(model, [&](int i) {
+        return i >= threshold;
+    });
+    EXPECT_EQ(filteredModel->toVector(), AVector<int>({ 72, 23, 35, 66, 37, 28 }));
+
+    auto changed = _new<Receiver>();
+    auto inserted = _new<Receiver>();
+    auto removed = _new<Receiver>();
+    AObject::connect(filteredModel->dataChanged, AUI_SLOT(changed)::receive);
+    AObject::connect(filteredModel->dataInserted, AUI_SLOT(inserted)::receive);
+    AObject::connect(filteredModel->dataRemoved, AUI_SLOT(removed)::receive);
+
+    testing::InSequence s;
+    EXPECT_CALL(*changed, receive(testing::_)).Times(0);
+    EXPECT_CALL(*removed, receive(filteredModel->range(1, 2)));     // 23
+    EXPECT_CALL(*removed, receive(filteredModel->range(4, 5)));     // 28
+    EXPECT_CALL(*inserted, receive(filteredModel->range(0, 2)));    // 1, 5
+    EXPECT_CALL(*inserted, receive(filteredModel->range(3, 5)));    // 23, 14
+    EXPECT_CALL(*inserted, receive(filteredModel->range(8, 10)));   // 28, 19
+
+    threshold = 30;
+    filteredModel->invalidate();
+    EXPECT_EQ(filteredModel->toVector(), AVector<int>({ 72, 35, 66, 37 }));
+
+    threshold = 0;
+    filteredModel->invalidate();
+    EXPECT_EQ(filteredModel->toVector(), model->toVector());
+}
+
+/**
+ * Changes the filter several times in a row, rescanning the model in parallel; only the last rescan is applied.
+ */
+TEST(Models, FilterInvalidateParallel) {
+    AVector<int> items;
+    for (int i = 0; i < 100'000; ++i) {
+        items << i;
+    }
+    auto model = AListModel<int>::fromVector(items);
+    std::atomic_int divisor = 2;
+    auto filteredModel = AModels::filter(model, [&](int i) {
+        return i % divisor == 0;
+    });
+    EXPECT_EQ(filteredModel->listSize(), 50'000);
+
+    for (int i : { 3, 5, 7 }) {
+        divisor = i;
+        filteredModel->invalidateParallel();
+    }
+    EXPECT_EQ(filteredModel->listSize(), 50'000) << "the previous results are kept until the rescan is done";
+    while (filteredModel->isRescanning()) {
+        AThread::processMessages();
+    }
+
+    AVector<int> expected;
+    for (int i = 0; i < 100'000; i += 7) {
+        expected << i;
+    }
+    EXPECT_EQ(filteredModel->toVector(), expected);
+}
+
+/**
+ * Modifies the source model while it is being rescanned in parallel; the rescan is restarted and its result matches
+ * the modified model.
+ */
+TEST(Models, FilterInvalidateParallelSourceModified) {
+    AVector<int> items;
+    for (int i = 0; i < 100'000; ++i) {
+        items << i;
+    }
+    auto model = AListModel<int>::fromVector(items);
+    std::atomic_int divisor = 2;
+    auto filteredModel = AModels::filter(model, [&](int i) {
+        return i % divisor == 0;
+    });
+
+    divisor = 3;
+    filteredModel->invalidateParallel();
+    model->erase(model->begin(), model->begin() + 90'000);
+    model->insert(model->end(), items.begin(), items.end()); // reallocates the source vector
+    model->push_back(3);
+    while (filteredModel->isRescanning()) {
+        AThread::processMessages();
+    }
+
+    AVector<int> expected;
+    for (int i : model->toVector()) {
+        if (i % 3 == 0) {
+            expected << i;
+        }
+    }
+    EXPECT_EQ(filteredModel->toVector(), expected);
+}
@@ -430,3 +430,59 @@ TEST_F(SignalSlotTest, CopyTest) {
     s ^ s.copyTrapSignal(copyTrap);
     EXPECT_EQ(copyTrap.value, 1);
 }
+
+/**
+ * Emissions on unrelated signals from different threads race with connects and disconnects of another thread.
+ */
+TEST_F(SignalSlotTest, MultithreadEmitConnectDisconnect) {
+    static constexpr auto THREADS = 4;
+    static constexpr auto EMITS = 10000;
+
+    class Receiver : public AObject {
+    public:
+        void receive(const AString&) { called.fetch_add(1, std::memory_order_relaxed); }
+        std::atomic_size_t called = 0;
+    };
+
+    auto receiver = _new<Receiver>();
+    AVector<_<Master>> masters;
+    for (int i = 0; i < THREADS; ++i) {
+        masters << _new<Master>();
+        AObject::connect(masters.last()->message, AUI_SLOT(receiver)::receive);
+    }
+
+    std::atomic_bool stop = false;
+    auto churn = _new<AThread>([&] {
+        while (!stop) {
+            for (const auto& master : masters) {
+                auto temp = _new<Receiver>();
+                AObject::connect(master->message, AUI_SLOT(temp)::receive);
+                auto connection = AObject::connect(master->message, AUI_SLOT(temp)::receive);
+                connection->disconnect();
+                // temp is destroyed with its remaining connection here.
+            }
+        }
+    });
+    churn->start();
+
+    AVector<_<AThread>> emitters;
+    for (const auto& master : masters) {
+        emitters << _new<AThread>([master] {
+            for (int i = 0; i < EMITS; ++i) {
+                master->broadcastMessage("hello");
+            }
+        });
+        emitters.last()->start();
+    }
+    for (const auto& emitter : emitters) {
+        emitter->join();
+    }
+    stop = true;
+    churn->join();
+
+    EXPECT_EQ(receiver->called, THREADS * EMITS);
+    for (const auto& master : masters) {
+        EXPECT_EQ(connections(master->message).size(), 1);
+    }
+    EXPECT_EQ(connections(*receiver).size(), THREADS);
+}
@@ -0,0 +1,64 @@
+// AUI Framework - Declarative UI toolkit for modern C++20
+// Copyright (C) 2020-2025 Alex2772 and Contributors
+//
+// SPDX-License-Identifier: MPL-2.0
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <array>
+#include <memory>
+#include "AUI/Util/SmallFunction.h"
+
+TEST(SmallFunction, Empty) {
+    aui::small_function<void()> f;
+    EXPECT_TRUE(f == nullptr);
+    EXPECT_FALSE(f);
+
+    std::function<void()> emptyStdFunction;
+    aui::small_function<void()> fromEmpty = emptyStdFunction;
+    EXPECT_TRUE(fromEmpty == nullptr);
+}
+
+TEST(SmallFunction, Inline) {
+    aui::small_function<int(int)> f = [offset = 2](int v) { return v + offset; };
+    EXPECT_FALSE(f.isHeapAllocated());
+    EXPECT_EQ(f(1), 3);
+}
+
+TEST(SmallFunction, Heap) {
+    std::array<int, 64> big {};
+    big[10] = 228;
+    aui::small_function<int()> f = [big] { return big[10]; };
+    EXPECT_TRUE(f.isHeapAllocated());
+    EXPECT_EQ(f(), 228);
+
+    auto moved = std::move(f);
+    EXPECT_TRUE(f == nullptr);
+    EXPECT_EQ(moved(), 228);
+}
+
+TEST(SmallFunction, MoveOnlyAndMutable) {
+    aui::small_function<int()> f = [p = std::make_unique<int>(0)]() mutable { return ++*p; };
+    EXPECT_EQ(f(), 1);
+    auto moved = std::move(f);
+    EXPECT_TRUE(f == nullptr);
+    EXPECT_EQ(moved(), 2);
+}
+
+TEST(SmallFunction, Destruction) {
+    auto shared = std::make_shared<int>(0);
+    {
+        aui::small_function<void()> f = [shared] {};
+        EXPECT_EQ(shared.use_count(), 2);
+        auto moved = std::move(f);
+        EXPECT_EQ(shared.use_count(), 2);
+    }
+    EXPECT_EQ(shared.use_count(), 1);
+
+    aui::small_function<void()> f = [shared] {};
+    f = nullptr;
+    EXPECT_EQ(shared.use_count(), 1);
+}
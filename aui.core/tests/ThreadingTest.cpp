@@ -44,6 +44,25 @@ TEST(Threading, Async) {
     ASSERT_EQ(*someInt, 100);
 }
 
+TEST(Threading, TasksSpawnedFromWorkers) {
+    // tasks spawned by a worker land in the worker-local deque; the other workers are expected to steal them.
+    AThreadPool tp(4);
+    std::atomic_int counter = 0;
+    AFutureSet<> f;
+    for (int i = 0; i < 4; ++i) {
+        f << tp * [&] {
+            AFutureSet<> inner;
+            for (int j = 0; j < 100; ++j) {
+                inner << tp * [&] { counter += 1; };
+            }
+            inner.waitForAll();
+        };
+    }
+    f.waitForAll();
+
+    ASSERT_EQ(counter, 400);
+}
+
 TEST(Threading, SleepInterruption) {
     bool called = false;
     auto future = AUI_THREADPOOL_X [&] {
@@ -498,3 +517,107 @@ TEST(Threading, AfterFutureResolvedOnFinallyIsCalled2) {
     });
     EXPECT_TRUE(called);
 }
+
+TEST(Threading, FutureManySubscribers) {
+    // callbacks are stored in a flat list; they must be called in subscription order without deep recursion.
+    AFuture<int> future;
+    AVector<int> calls;
+    for (int i = 0; i < 10000; ++i) {
+        future.onSuccess([&, i](int v) {
+            EXPECT_EQ(v, 228);
+            calls << i;
+        });
+    }
+    future.supplyValue(228);
+    ASSERT_EQ(calls.size(), 10000);
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_EQ(calls[i], i);
+    }
+}
+
+TEST(Threading, FutureThenInline) {
+    AFuture<int> future;
+    auto continuation = future.then([](int v) { return v * 2; });
+    auto voidContinuation = continuation.then([](int) {});
+    bool called = false;
+    auto afterVoid = voidContinuation.then([&] {
+        called = true;
+        return AString("done");
+    });
+    EXPECT_FALSE(continuation.hasResult());
+    future.supplyValue(114);
+    // inline continuations are resolved by supplyValue itself.
+    EXPECT_EQ(*continuation, 228);
+    EXPECT_TRUE(called);
+    EXPECT_EQ(*afterVoid, "done");
+}
+
+TEST(Threading, FutureThenOnThreadPool) {
+    AThreadPool localThreadPool(1);
+    AFuture<int> future;
+    auto callerThreadId = std::this_thread::get_id();
+    auto continuation = future.then(localThreadPool, [&](int v) {
+        EXPECT_NE(std::this_thread::get_id(), callerThreadId);
+        return v + 1;
+    });
+    future.supplyValue(227);
+    EXPECT_EQ(*continuation, 228);
+}
+
+TEST(Threading, FutureThenException) {
+    AFuture<int> future;
+    auto continuation = future.then([](int v) -> int { throw AException("oops!"); });
+    auto next = continuation.then([](int v) {
+        ADD_FAILURE() << "should not be called";
+        return v;
+    });
+    future.supplyValue(1);
+    EXPECT_ANY_THROW(*continuation);
+    EXPECT_ANY_THROW(*next);
+}
+
+TEST(Threading, LockFreeMessageQueue) {
+    ALockFreeMessageQueue<> queue;
+    EXPECT_TRUE(queue.empty());
+
+    // only the first message of a burst requests a wake-up.
+    int value = 0;
+    EXPECT_TRUE(queue.enqueue([&] { value = value * 10 + 1; }));
+    EXPECT_FALSE(queue.enqueue([&] { value = value * 10 + 2; }));
+    EXPECT_EQ(queue.size(), 2);
+    queue.processMessages();
+    EXPECT_EQ(value, 12);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_TRUE(queue.enqueue([] {}));
+    queue.processMessages();
+}
+
+TEST(Threading, LockFreeMessageQueueManyProducers) {
+    static constexpr auto PRODUCERS = 4;
+    static constexpr auto MESSAGES = 10000;
+    ALockFreeMessageQueue<> queue;
+    std::array<int, PRODUCERS> last;
+    last.fill(-1);
+    std::size_t processed = 0;
+    AVector<_<AThread>> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers << _new<AThread>([&, p] {
+            for (int i = 0; i < MESSAGES; ++i) {
+                queue.enqueue([&, p, i] {
+                    // messages of a single producer are delivered in order.
+                    EXPECT_EQ(last[p], i - 1);
+                    last[p] = i;
+                    ++processed;
+                });
+            }
+        });
+        producers.last()->start();
+    }
+    while (processed != PRODUCERS * MESSAGES) {
+        queue.processMessages();
+    }
+    for (const auto& p : producers) {
+        p->join();
+    }
+    EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,40 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <AUI/Common/SharedPtrTypes.h>
+
+/**
+ * @brief Minimal service locator: holds one shared instance per type.
+ * @details
+ * Autumn::put registers an instance, Autumn::get returns it. A module specializes detail::storage in its translation
+ * unit (and exports it) when the instance must be shared across shared libraries, see AUI/Data.h.
+ */
+namespace Autumn {
+    namespace detail {
+        template<typename T>
+        _<T>& storage() {
+            static _<T> t;
+            return t;
+        }
+    }
+
+    template<typename T>
+    _<T> get() {
+        return detail::storage<T>();
+    }
+
+    template<typename T>
+    void put(_<T> obj) {
+        detail::storage<T>() = std::move(obj);
+    }
+}
@@ -0,0 +1,164 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <variant>
+#include <AUI/Common/AString.h>
+
+/**
+ * @brief Type of the value held by AVariant.
+ */
+enum class AVariantType {
+    AV_NULL,
+    AV_INT,
+    AV_UINT,
+    AV_FLOAT,
+    AV_DOUBLE,
+    AV_STRING,
+    AV_BOOL,
+};
+
+/**
+ * @brief Dynamically typed value used to pass query parameters and results between aui.data and sql drivers.
+ * @details
+ * Holds either nothing (null), a 32-bit integer, a floating point number, a bool or a string. The to* accessors
+ * convert the stored value to the requested type; strings are parsed, unparseable strings and null yield zero.
+ */
+class AVariant {
+public:
+    AVariant() = default;
+    AVariant(std::nullptr_t) {}
+    AVariant(bool value): mValue(value) {}
+    AVariant(float value): mValue(value) {}
+    AVariant(double value): mValue(value) {}
+    AVariant(const char* value): mValue(AString(value)) {}
+    AVariant(AString value): mValue(std::move(value)) {}
+    AVariant(const std::string& value): mValue(AString(value)) {}
+
+    template<typename T>
+    requires (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+    AVariant(T value) {
+        if constexpr (std::is_signed_v<T>) {
+            mValue = int(value);
+        } else {
+            mValue = unsigned(value);
+        }
+    }
+
+    [[nodiscard]]
+    AVariantType getType() const noexcept {
+        return AVariantType(mValue.index());
+    }
+
+    [[nodiscard]]
+    bool isNull() const noexcept {
+        return getType() == AVariantType::AV_NULL;
+    }
+
+    [[nodiscard]]
+    int toInt() const {
+        return toNumber<int>([](const AString& s) { return s.toInt().valueOr(0); });
+    }
+
+    [[nodiscard]]
+    unsigned toUInt() const {
+        return toNumber<unsigned>([](const AString& s) { return s.toUInt().valueOr(0); });
+    }
+
+    [[nodiscard]]
+    float toFloat() const {
+        return toNumber<float>([](const AString& s) { return s.toFloat().valueOr(0.f); });
+    }
+
+    [[nodiscard]]
+    double toDouble() const {
+        return toNumber<double>([](const AString& s) { return s.toDouble().valueOr(0.0); });
+    }
+
+    [[nodiscard]]
+    bool toBool() const {
+        return toNumber<bool>([](const AString& s) { return s.toBool(); });
+    }
+
+    [[nodiscard]]
+    AString toString() const {
+        return std::visit([](const auto& v) -> AString {
+            using T = std::decay_t<decltype(v)>;
+            if constexpr (std::is_same_v<T, std::monostate>) {
+                return {};
+            } else if constexpr (std::is_same_v<T, AString>) {
+                return v;
+            } else if constexpr (std::is_same_v<T, bool>) {
+                return v ? "true" : "false";
+            } else {
+                return AString::number(v);
+            }
+        }, mValue);
+    }
+
+    /**
+     * @brief Compares the values rather than their representations: int 1 equals unsigned 1, and a string equals a
+     *        number when it parses to that number (drivers may return numbers stored in text columns as strings).
+     */
+    bool operator==(const AVariant& other) const {
+        if (isNull() || other.isNull()) {
+            return isNull() == other.isNull();
+        }
+        const bool isString = getType() == AVariantType::AV_STRING;
+        const bool otherIsString = other.getType() == AVariantType::AV_STRING;
+        if (isString && otherIsString) {
+            return std::get<AString>(mValue) == std::get<AString>(other.mValue);
+        }
+        if (isString || otherIsString) {
+            const auto& string = std::get<AString>(isString ? mValue : other.mValue);
+            auto parsed = string.toDouble();
+            return parsed && *parsed == (isString ? other : *this).toDouble();
+        }
+        if (isFloatingPoint() || other.isFloatingPoint()) {
+            return toDouble() == other.toDouble();
+        }
+        return toInt64() == other.toInt64();
+    }
+
+private:
+    // order matches AVariantType.
+    std::variant<std::monostate, int, unsigned, float, double, AString, bool> mValue;
+
+    [[nodiscard]]
+    bool isFloatingPoint() const noexcept {
+        return getType() == AVariantType::AV_FLOAT || getType() == AVariantType::AV_DOUBLE;
+    }
+
+    [[nodiscard]]
+    std::int64_t toInt64() const {
+        if (getType() == AVariantType::AV_UINT) {
+            return std::get<unsigned>(mValue);
+        }
+        return toInt();
+    }
+
+    template<typename T, typename Parse>
+    T toNumber(Parse&& parse) const {
+        return std::visit([&](const auto& v) -> T {
+            using V = std::decay_t<decltype(v)>;
+            if constexpr (std::is_same_v<V, std::monostate>) {
+                return T{};
+            } else if constexpr (std::is_same_v<V, AString>) {
+                return parse(v);
+            } else {
+                return static_cast<T>(v);
+            }
+        }, mValue);
+    }
+};
@@ -12,7 +12,7 @@
 #include "Data.h"
 
 template<>
-_<ASqlDatabase>& Autumn::detail::threadLocalStorage()
+_<ASqlDatabase>& Autumn::detail::storage()
 {
 	static _<ASqlDatabase> s;
 	return s;
@@ -12,7 +12,8 @@
 #include "AMigrationManager.h"
 #include "AMeta.h"
 #include "AUI/Common/AException.h"
-#include "AUI/Util/AError.h"
+#include "AUI/Logging/ALogger.h"
+#include "AUI/i18n/AI18n.h"
 
 void AMigrationManager::registerMigration(const AString& description, const std::function<void()>& migrationCode)
 {
@@ -41,7 +42,7 @@ void AMigrationManager::doMigration()
 		}
 	} catch (const AException& e)
 	{
-		AError::handle(e, "Could not finish migration "_i18n + AString::number(index) + " (" + mMigrations.at(index).first + ")");
+		ALogger::err("AMigrationManager") << "Could not finish migration "_i18n + AString::number(index) + " (" + mMigrations.at(index).first + "): " << e;
 	}
 
 	AMeta::set("migration", index);
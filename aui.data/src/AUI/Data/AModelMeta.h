@@ -15,6 +15,33 @@
 #include <AUI/Common/AMap.h>
 #include <AUI/Common/AString.h>
 #include <AUI/Reflect/AField.h>
+#include "ASqlRowReader.h"
+
+/**
+ * @brief Fields of a model, by name.
+ * @details
+ * Besides AField, holds a typed decoder of each field, used to read the fields from query results without boxing the
+ * values into AVariant (see ASqlColumnMapping).
+ */
+template<class T>
+struct AModelFields: AMap<AString, _<AField<T>>> {
+    struct Entry {
+        AString name;
+        _<AField<T>> field;
+        aui::sql::FieldDecoder<T> decoder;
+    };
+
+    AMap<AString, aui::sql::FieldDecoder<T>> decoders;
+
+    AModelFields() = default;
+
+    AModelFields(std::initializer_list<Entry> entries) {
+        for (const auto& entry : entries) {
+            (*this)[entry.name] = entry.field;
+            decoders[entry.name] = entry.decoder;
+        }
+    }
+};
 
 template<class T>
 struct AModelMetaBase {
@@ -50,12 +77,12 @@ struct AModelMetaBase {
  */
 template<class T>
 struct AModelMeta: AModelMetaBase<T> {
-    static AMap<AString, _<AField<T>>> getFields() { AUI_ASSERT(0); return {};}
+    static AModelFields<T> getFields() { AUI_ASSERT(0); return {};}
     static AString getSqlTable() { AUI_ASSERT(0); return {};}
 };
 
 #define A_META(name) template<> struct AModelMeta< name >: AModelMetaBase< name >
-#define A_FIELDS static AMap<AString, _<AField<Model>>> getFields()
-#define A_FIELD(name) { #name, AField<Model>::make(&Model:: name ) },
+#define A_FIELDS static AModelFields<Model> getFields()
+#define A_FIELD(name) { #name, AField<Model>::make(&Model:: name ), &aui::sql::decodeField<Model, &Model:: name > },
 #define A_SQL_TABLE(name) static AString getSqlTable() { return name;}
 
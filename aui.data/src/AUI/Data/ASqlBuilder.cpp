@@ -25,7 +25,7 @@ ASqlBuilder::Insert ASqlBuilder::insert(const AStringVector& columnNames) {
 }
 
 ASqlBuilder::Select ASqlBuilder::select(const AStringVector& columnNames) {
-    return {*this, "SELECT " + (columnNames.empty() ? '*' : columnNames.join(',')) + " FROM " + mTableName};
+    return {*this, "SELECT " + (columnNames.empty() ? AString("*") : columnNames.join(',')) + " FROM " + mTableName};
 }
 
 ASqlBuilder::Update ASqlBuilder::update(const AMap<AString, AVariant>& data) {
@@ -51,22 +51,12 @@ ASqlBuilder::Statement::Statement(ASqlBuilder& builder, const AString& sql):
 ASqlBuilder::Insert::Insert(ASqlBuilder& builder, const AString& sql) : Statement(builder, sql) {}
 
 ASqlBuilder::Insert& ASqlBuilder::Insert::row(const AVector<AVariant>& data) {
-    mData.insertAll(data);
-    if (mSql.last() == ')')
-        mSql += ',';
-    mSql += "(";
-    for (unsigned i = 0; i < data.size(); ++i) {
-        if (i)
-            mSql += ',';
-        mSql += '?';
-    }
-    mSql += ")";
+    mRows << data;
     return *this;
 }
 
 ASqlBuilder::Insert& ASqlBuilder::Insert::rows(const AVector<AVector<AVariant>>& data) {
-    for (const auto& r : data)
-        row(r);
+    mRows.insertAll(data);
     return *this;
 }
 
@@ -76,8 +66,16 @@ ASqlBuilder::Insert::~Insert() {
 }
 
 int ASqlBuilder::Insert::doInsert() {
-    AUI_ASSERT(!mData.empty());
-    int id = Autumn::get<ASqlDatabase>()->execute(mSql, mData);
+    AUI_ASSERT(!mRows.empty());
+    mSql += "(";
+    for (unsigned i = 0; i < mRows.first().size(); ++i) {
+        if (i)
+            mSql += ',';
+        mSql += '?';
+    }
+    mSql += ")";
+    auto db = Autumn::get<ASqlDatabase>();
+    int id = mRows.size() == 1 ? db->execute(mSql, mRows.first()) : db->executeBatch(mSql, mRows);
     mInsertDone = true;
     return id;
 }
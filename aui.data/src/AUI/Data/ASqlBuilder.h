@@ -19,6 +19,7 @@
 #include <AUI/Common/AStringVector.h>
 #include <AUI/Reflect/AField.h>
 #include <AUI/Data/ASqlDatabase.h>
+#include <AUI/Data/ASqlColumnMapping.h>
 #include <AUI/Traits/parameter_pack.h>
 
 template<typename ModelType>
@@ -58,7 +59,12 @@ public:
     class API_AUI_DATA Insert: public Statement {
         friend class ASqlBuilder;
     private:
-        AVector<AVariant> mData;
+        /**
+         * @brief Rows to insert. They are inserted by a single prepared statement executed for each row (see
+         * ASqlDatabase::executeBatch) rather than by a statement with a VALUES entry per row, which would hit the
+         * DBMS's limits of the query length and parameter count on bulk inserts.
+         */
+        AVector<AVector<AVariant>> mRows;
         bool mInsertDone = false;
 
         Insert(ASqlBuilder& builder, const AString& sql);
@@ -169,39 +175,15 @@ public:
          */
         template<class Model>
         AVector<Model> as() {
-            auto idField = AField<ASqlModel<Model>>::make(&ASqlModel<Model>::id);
             AVector<Model> result;
             result.reserve(0x100);
 
             mSql += " ";
             mSql += mWhereExpr;
             auto dbResult = Autumn::get<ASqlDatabase>()->query(mSql, mWhereParams);
-
-            AVector<size_t> sqlColumnToModelFieldIndexMapping;
-            AVector<_<AField<Model>>> fields;
-            fields << AModelMeta<Model>::getFields().valueVector();
-            /*
-            {
-                sqlColumnToModelFieldIndexMapping.resize(dbResult->getColumns().size());
-                AMap<AString, size_t> columnNameToFieldIndexMapping;
-                size_t counter = 0;
-                for (auto& column : dbResult->getColumns()) {
-                    columnNameToFieldIndexMapping[column.name] = counter++;
-                }
-
-                for (std::pair<AString, _<AField<Model>>>& field : AModelMeta<Model>::fields) {
-                    sqlColumnToModelFieldIndexMapping.push_back(columnNameToFieldIndexMapping[field.first]);
-                    fields << field.second;
-                }
-            }*/
-
-            for (auto& row : dbResult) {
-                Model m;
-                idField->set(m, row->getValue(0));
-                for (size_t columnIndex = 1; columnIndex < dbResult->getColumns().size(); ++columnIndex) {
-                    fields[columnIndex - 1]->set(m, row->getValue(columnIndex));
-                }
-                result << std::move(m);
+            const auto& decoders = ASqlColumnMapping<Model>::of(dbResult->getColumns());
+            for (const auto& row : *dbResult) {
+                result << ASqlColumnMapping<Model>::decode(decoders, row);
             }
 
             return result;
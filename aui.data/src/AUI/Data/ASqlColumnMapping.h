@@ -0,0 +1,81 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <AUI/Common/AMap.h>
+#include <AUI/Thread/AMutex.h>
+#include "AModelMeta.h"
+#include "ASqlRowReader.h"
+
+template<typename ModelType>
+struct ASqlModel;
+
+/**
+ * @brief Maps the columns of a query result to the fields of an ORM model.
+ * @tparam Model ORM model (see ASqlModel).
+ * @details
+ * The mapping is computed once per column list and cached, so materializing a model costs a decoder call per column
+ * only.
+ */
+template<typename Model>
+class ASqlColumnMapping {
+public:
+    using Decoders = AVector<aui::sql::FieldDecoder<Model>>;
+
+    /**
+     * @return decoder per column of the result; nullptr for the columns not matching any field.
+     */
+    static const Decoders& of(const AVector<SqlColumn>& columns) {
+        AString key;
+        for (const auto& column : columns) {
+            key += column.name;
+            key += ',';
+        }
+
+        static AMutex sync;
+        static AMap<AString, Decoders> cache;
+        std::unique_lock lock(sync);
+        if (auto it = cache.find(key); it != cache.end()) {
+            return it->second;
+        }
+
+        const auto fields = AModelMeta<Model>::getFields();
+        Decoders decoders;
+        decoders.reserve(columns.size());
+        for (const auto& column : columns) {
+            if (column.name == "id") {
+                decoders << &aui::sql::decodeField<Model, &ASqlModel<Model>::id>;
+            } else if (auto decoder = fields.decoders.contains(column.name)) {
+                decoders << decoder->second;
+            } else {
+                decoders << nullptr;
+            }
+        }
+        // references to std::map values are stable.
+        return cache[key] = std::move(decoders);
+    }
+
+    /**
+     * @brief Decodes the current row of the result to a model.
+     * @param decoders the result of of() for the columns of the result.
+     */
+    static Model decode(const Decoders& decoders, const ASqlQueryResult::Iterator& row) {
+        Model model;
+        for (size_t i = 0; i < decoders.size(); ++i) {
+            if (decoders[i]) {
+                decoders[i](model, row, i);
+            }
+        }
+        return model;
+    }
+};
@@ -13,9 +13,213 @@
 
 #include <AUI/Common/AException.h>
 #include <AUI/Logging/ALogger.h>
+#include <AUI/Thread/AConditionVariable.h>
+#include <AUI/Thread/AMutex.h>
+#include <algorithm>
+#include <cctype>
+#include <thread>
 #include "ISqlDatabase.h"
 #include "AUI/Common/Plugin.h"
 
+namespace {
+	/**
+	 * @brief Query with its string and numeric literals replaced with ?, so the queries differing by the inlined values
+	 * only share an entry in the statistics.
+	 */
+	AString queryTemplate(const AString& query)
+	{
+		const auto& in = query.bytes();
+		std::string out;
+		out.reserve(in.size());
+		auto isIdentifier = [](char c) {
+			const auto u = static_cast<unsigned char>(c);
+			return std::isalnum(u) || c == '_' || c == '$' || u >= 0x80;
+		};
+		for (size_t i = 0; i < in.size();) {
+			if (in[i] == '\'') {
+				// '' is an escaped quote.
+				for (++i; i < in.size(); ++i) {
+					if (in[i] == '\'') {
+						if (i + 1 < in.size() && in[i + 1] == '\'') {
+							++i;
+							continue;
+						}
+						++i;
+						break;
+					}
+				}
+				out += '?';
+				continue;
+			}
+			if (std::isdigit(static_cast<unsigned char>(in[i])) && (i == 0 || !isIdentifier(in[i - 1]))) {
+				for (; i < in.size() && (isIdentifier(in[i]) || in[i] == '.'); ++i) {
+					// exponent sign, i.e. 1e-5
+					if ((in[i] == 'e' || in[i] == 'E') && i + 1 < in.size() && (in[i + 1] == '-' || in[i + 1] == '+')) {
+						++i;
+					}
+				}
+				out += '?';
+				continue;
+			}
+			out += in[i++];
+		}
+		return AString(std::move(out));
+	}
+}
+
+class ASqlDatabase::Pool
+{
+public:
+	struct Connection
+	{
+		_<ISqlDatabase> driver;
+
+		/**
+		 * @brief The thread the connection is checked out by.
+		 */
+		std::thread::id owner;
+
+		/**
+		 * @brief Number of checkouts by the owner; 0 if the connection is idle.
+		 */
+		size_t depth = 0;
+	};
+
+	Connection writer;
+
+	/**
+	 * @brief Connections for the queries with the result. Not resized after creation, since checked out connections
+	 * are referenced by pointers.
+	 */
+	AVector<Connection> readers;
+
+	/**
+	 * @brief Checks out a connection.
+	 * @param write whether the query modifies the database.
+	 * @return the driver interface; the connection is released when the last copy of the pointer is destroyed.
+	 */
+	static _<ISqlDatabase> acquire(const _<Pool>& self, bool write)
+	{
+		const auto thisThread = std::this_thread::get_id();
+		std::unique_lock lock(self->mSync);
+		Connection* connection = nullptr;
+
+		// the calling thread holds a connection already; otherwise, a nested query would wait for itself.
+		if (self->writer.depth > 0 && self->writer.owner == thisThread) {
+			connection = &self->writer;
+		} else if (!write) {
+			for (auto& reader : self->readers) {
+				if (reader.depth > 0 && reader.owner == thisThread) {
+					connection = &reader;
+					break;
+				}
+			}
+		}
+
+		if (!connection) {
+			auto findIdle = [&]() -> Connection* {
+				if (write || self->readers.empty()) {
+					return self->writer.depth == 0 ? &self->writer : nullptr;
+				}
+				for (auto& reader : self->readers) {
+					if (reader.depth == 0) {
+						return &reader;
+					}
+				}
+				return nullptr;
+			};
+			connection = findIdle();
+			if (!connection) {
+				const auto begin = std::chrono::steady_clock::now();
+				self->mReleased.wait(lock, [&] {
+					connection = findIdle();
+					return connection != nullptr;
+				});
+				self->mStatistics.connectionWaits++;
+				self->mStatistics.connectionWaitTime += std::chrono::steady_clock::now() - begin;
+			}
+			connection->owner = thisThread;
+		}
+		connection->depth++;
+
+		return _<ISqlDatabase>(connection->driver.get(), [self, connection](ISqlDatabase*) {
+			self->release(*connection);
+		});
+	}
+
+	/**
+	 * @brief Calls the callable, recording its time to the statistics of the query.
+	 */
+	template<typename Callable>
+	auto timed(const AString& query, Callable&& callable)
+	{
+		const auto begin = std::chrono::steady_clock::now();
+		auto result = callable();
+		record(query, std::chrono::steady_clock::now() - begin);
+		return result;
+	}
+
+	void record(const AString& query, std::chrono::nanoseconds time)
+	{
+		auto key = queryTemplate(query);
+		std::unique_lock lock(mSync);
+		auto it = mStatistics.queries.find(key);
+		if (it == mStatistics.queries.end()) {
+			if (mStatistics.queries.size() >= Statistics::MAX_QUERIES) {
+				evictLeastRecentlyUsed();
+			}
+			it = mStatistics.queries.emplace(std::move(key), Statistics::Query{}).first;
+		}
+		auto& entry = it->second;
+		entry.lastUsed = ++mUseCounter;
+		entry.count++;
+		entry.totalTime += time;
+		entry.maxTime = (std::max)(entry.maxTime, time);
+	}
+
+	Statistics statistics()
+	{
+		std::unique_lock lock(mSync);
+		return mStatistics;
+	}
+
+	void resetStatistics()
+	{
+		std::unique_lock lock(mSync);
+		mStatistics = {};
+	}
+
+private:
+	AMutex mSync;
+	AConditionVariable mReleased;
+	Statistics mStatistics;
+	size_t mUseCounter = 0;
+
+	/**
+	 * @brief Evicts the query executed least recently. Linear, but only runs when a new query template is seen with
+	 * the statistics full.
+	 */
+	void evictLeastRecentlyUsed()
+	{
+		auto victim = std::min_element(mStatistics.queries.begin(), mStatistics.queries.end(),
+		                               [](const auto& l, const auto& r) {
+			return l.second.lastUsed < r.second.lastUsed;
+		});
+		mStatistics.queries.erase(victim);
+		mStatistics.evictedQueries++;
+	}
+
+	void release(Connection& connection)
+	{
+		std::unique_lock lock(mSync);
+		AUI_ASSERT(connection.depth > 0);
+		if (--connection.depth == 0) {
+			connection.owner = {};
+			mReleased.notify_all();
+		}
+	}
+};
+
 
 AMap<AString, _<ISqlDriver>>& ASqlDatabase::getDrivers()
 {
@@ -23,25 +227,44 @@ AMap<AString, _<ISqlDriver>>& ASqlDatabase::getDrivers()
 	return drivers;
 }
 
+ASqlDatabase::ASqlDatabase(_<Pool> pool) : mPool(std::move(pool))
+{
+}
+
 ASqlDatabase::~ASqlDatabase() = default;
 
 _<ASqlQueryResult> ASqlDatabase::query(const AString& query, const AVector<AVariant>& params)
 {
-	return aui::ptr::manage_shared(new ASqlQueryResult(mDriverInterface->query(query, params)));
+	auto connection = Pool::acquire(mPool, false);
+	auto result = mPool->timed(query, [&] {
+		return connection->query(query, params);
+	});
+	return aui::ptr::manage_shared(new ASqlQueryResult(std::move(result), std::move(connection)));
 }
 
 int ASqlDatabase::execute(const AString& query, const AVector<AVariant>& params)
 {
-	return mDriverInterface->execute(query, params);
+	auto connection = Pool::acquire(mPool, true);
+	return mPool->timed(query, [&] {
+		return connection->execute(query, params);
+	});
 }
 
-_<ASqlDatabase> ASqlDatabase::connect(const AString& driverName, const AString& address, uint16_t port,
+int ASqlDatabase::executeBatch(const AString& query, const AVector<AVector<AVariant>>& paramSets)
+{
+	auto connection = Pool::acquire(mPool, true);
+	return mPool->timed(query, [&] {
+		return connection->executeBatch(query, paramSets);
+	});
+}
+
+_<ISqlDatabase> ASqlDatabase::openConnection(const AString& driverName, const AString& address, uint16_t port,
 	const AString& databaseName, const AString& username, const AString& password)
 {
 	for (int i = 0; i < 2; ++i) {
 		if (auto c = getDrivers().contains(driverName))
 		{
-			return aui::ptr::manage_shared(new ASqlDatabase(c->second->openDriverConnection(address, port, databaseName, username, password), driverName));
+			return c->second->openDriverConnection(address, port, databaseName, username, password);
 		}
 		else if (i == 0)
 		{
@@ -57,11 +280,89 @@ _<ASqlDatabase> ASqlDatabase::connect(const AString& driverName, const AString&
 	throw AException("No such driver: " + driverName);
 }
 
+_<ASqlDatabase> ASqlDatabase::connect(const AString& driverName, const AString& address, uint16_t port,
+	const AString& databaseName, const AString& username, const AString& password)
+{
+	auto pool = _new<Pool>();
+	pool->writer.driver = openConnection(driverName, address, port, databaseName, username, password);
+	return aui::ptr::manage_shared(new ASqlDatabase(std::move(pool)));
+}
+
+_<ASqlDatabase> ASqlDatabase::connectPool(size_t readerCount, const AString& driverName, const AString& address,
+	uint16_t port, const AString& databaseName, const AString& username, const AString& password)
+{
+	auto pool = _new<Pool>();
+	pool->writer.driver = openConnection(driverName, address, port, databaseName, username, password);
+	const bool sqlite = pool->writer.driver->getDriverType() == DT_SQLITE;
+	if (sqlite) {
+		if (address == ":memory:") {
+			// every connection would open its own database.
+			readerCount = 0;
+		} else {
+			pool->writer.driver->execute("PRAGMA journal_mode=WAL", {});
+			pool->writer.driver->execute("PRAGMA busy_timeout=5000", {});
+		}
+	}
+	pool->readers.resize(readerCount);
+	for (auto& reader : pool->readers) {
+		reader.driver = openConnection(driverName, address, port, databaseName, username, password);
+		if (sqlite) {
+			reader.driver->execute("PRAGMA busy_timeout=5000", {});
+			reader.driver->execute("PRAGMA query_only=1", {});
+		}
+	}
+	return aui::ptr::manage_shared(new ASqlDatabase(std::move(pool)));
+}
+
 void ASqlDatabase::registerDriver(_<ISqlDriver> driver)
 {
 	getDrivers()[driver->getDriverName()] = std::move(driver);
 }
 
 SqlDriverType ASqlDatabase::getDriverType() {
-    return mDriverInterface->getDriverType();
+    return mPool->writer.driver->getDriverType();
+}
+
+AThreadPool& ASqlDatabase::executor() {
+	std::call_once(mExecutorCreated, [&] {
+		mExecutor = std::make_unique<AThreadPool>(mPool->readers.size() + 1);
+	});
+	return *mExecutor;
+}
+
+AFuture<AVector<AVector<AVariant>>> ASqlDatabase::queryAsync(const AString& query, const AVector<AVariant>& params)
+{
+	return async([query, params](ASqlDatabase& db) {
+		auto result = db.query(query, params);
+		const auto columnCount = result->getColumns().size();
+		AVector<AVector<AVariant>> rows;
+		for (const auto& row : *result) {
+			rows << row.range(columnCount);
+		}
+		return rows;
+	});
+}
+
+AFuture<int> ASqlDatabase::executeAsync(const AString& query, const AVector<AVariant>& params)
+{
+	return async([query, params](ASqlDatabase& db) {
+		return db.execute(query, params);
+	});
+}
+
+AFuture<int> ASqlDatabase::executeBatchAsync(const AString& query, const AVector<AVector<AVariant>>& paramSets)
+{
+	return async([query, paramSets](ASqlDatabase& db) {
+		return db.executeBatch(query, paramSets);
+	});
+}
+
+ASqlDatabase::Statistics ASqlDatabase::statistics() const
+{
+	return mPool->statistics();
+}
+
+void ASqlDatabase::resetStatistics()
+{
+	mPool->resetStatistics();
 }
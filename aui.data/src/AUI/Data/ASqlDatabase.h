@@ -19,20 +19,93 @@
 #include "AUI/Common/AVariant.h"
 #include "ASqlQueryResult.h"
 #include "ASqlDriverType.h"
+#include <AUI/Thread/AFuture.h>
+#include <AUI/Thread/AThreadPool.h>
+#include <chrono>
+#include <mutex>
+#include <type_traits>
 
 class AString;
 
+/**
+ * @brief Application-to-aui.data interface.
+ * @details
+ * Holds either a single connection (see ASqlDatabase::connect) or a pool of connections (see
+ * ASqlDatabase::connectPool). In both cases, the object can be used from several threads: a connection is checked out
+ * for the duration of a call, or, for query(), until the returned result is destroyed. A thread already holding a
+ * connection reuses it, so nested queries (i.e., executing a query while reading the result of another one) do not
+ * wait for themselves.
+ *
+ * Results are streamed from the connection, so, with a single connection (connect(), or connectPool() of an in-memory
+ * SQLite database), other threads wait while a result is alive. Do not keep a result alive while waiting for them (i.e.,
+ * for an async query of the same database): call ASqlQueryResult::detach() to read the rows into memory and release
+ * the connection, or use queryAsync().
+ *
+ * query(), execute() and executeBatch() run on the caller's thread. Their *Async counterparts run on an executor
+ * dedicated to this database and return AFuture.
+ */
 class API_AUI_DATA ASqlDatabase
 {
+public:
+	/**
+	 * @brief Query timing statistics. See ASqlDatabase::statistics.
+	 */
+	struct Statistics {
+		struct Query {
+			size_t count = 0;
+			std::chrono::nanoseconds totalTime{0};
+			std::chrono::nanoseconds maxTime{0};
+
+			/**
+			 * @brief Sequence number of the last execution; the least recently executed query is evicted first.
+			 */
+			size_t lastUsed = 0;
+		};
+
+		/**
+		 * @brief Maximum number of entries in queries.
+		 */
+		static constexpr size_t MAX_QUERIES = 256;
+
+		/**
+		 * @brief Timing per query template, i.e. the SQL text with its string and numeric literals replaced with ?, so
+		 * queries with the values inlined share an entry. For queries with a result, the time to start the query is
+		 * measured; reading the rows is not included.
+		 */
+		AMap<AString, Query> queries;
+
+		/**
+		 * @brief Number of entries evicted from queries to keep it within MAX_QUERIES.
+		 */
+		size_t evictedQueries = 0;
+
+		/**
+		 * @brief Number of times a thread waited for a connection to be released.
+		 */
+		size_t connectionWaits = 0;
+		std::chrono::nanoseconds connectionWaitTime{0};
+	};
+
 private:
+	class Pool;
+
 	static AMap<AString, _<ISqlDriver>>& getDrivers();
 
-	_<ISqlDatabase> mDriverInterface;
+	_<Pool> mPool;
 
-	explicit ASqlDatabase(const _<ISqlDatabase>& driver_interface, const AString& driverName)
-		: mDriverInterface(driver_interface)
-	{
-	}
+	/**
+	 * @brief Executor of the async queries. Created on the first use; declared last to be destroyed first.
+	 */
+	std::once_flag mExecutorCreated;
+	_unique<AThreadPool> mExecutor;
+
+	explicit ASqlDatabase(_<Pool> pool);
+
+	static _<ISqlDatabase> openConnection(const AString& driverName, const AString& address, uint16_t port,
+	                                      const AString& databaseName, const AString& username,
+	                                      const AString& password);
+
+	AThreadPool& executor();
 
 public:
 	~ASqlDatabase();
@@ -42,7 +115,7 @@ public:
      *
      * @param query the SQL query
      * @param params query arguments
-     * @return query result
+     * @return query result; keeps the connection checked out until destroyed or detached.
      * \throws SQLException when any error occurs
      */
 	_<ASqlQueryResult> query(const AString& query, const AVector<AVariant>& params = {});
@@ -57,6 +130,19 @@ public:
 	 */
 	int execute(const AString& query, const AVector<AVariant>& params = {});
 
+	/**
+	 * @brief Execute a query with no result for each of the parameter sets (bulk INSERT, UPDATE, etc.)
+     *
+     * @param query the SQL query
+     * @param paramSets query arguments, one entry per execution
+     * @return the result of execute for the last parameter set
+     * \throws SQLException if any error occurs
+     * @details
+     * Depending on the driver, the query is prepared once and all parameter sets are executed in a single
+     * transaction, which is much faster than calling execute for each parameter set.
+	 */
+	int executeBatch(const AString& query, const AVector<AVector<AVariant>>& paramSets);
+
 
 	/**
 	 * @brief Connect to the database using the specified details and driver.
@@ -76,6 +162,58 @@ public:
 	                               const AString& databaseName = {}, const AString& username = {},
 	                               const AString& password = {});
 
+	/**
+	 * @brief Connect to the database with a pool of connections.
+	 * @param readerCount number of connections for the queries with the result (SELECT), in addition to the
+	 *        connection for the queries with no result. With readerCount = 0, equivalent to connect.
+	 * @details
+	 * The other parameters are the same as for connect.
+	 *
+	 * For SQLite, the database is switched to WAL mode, so the readers do not block on the writer. In-memory SQLite
+	 * databases are not shared between connections; the readers are not created for them.
+	 * \throws SQLException when any error occurs
+	 */
+	static _<ASqlDatabase> connectPool(size_t readerCount, const AString& driverName, const AString& address,
+	                                   uint16_t port = 0, const AString& databaseName = {},
+	                                   const AString& username = {}, const AString& password = {});
+
+	/**
+	 * @brief Calls the callback with this database on the executor.
+	 * @details
+	 * Use it to do several queries (i.e., ORM operations) in a row without blocking the caller's thread. The executor
+	 * has a thread per connection, so independent async queries run in parallel.
+	 */
+	template<typename Callback>
+	auto async(Callback&& callback) -> AFuture<std::invoke_result_t<Callback, ASqlDatabase&>> {
+		return executor() * [this, callback = std::forward<Callback>(callback)]() mutable {
+			return callback(*this);
+		};
+	}
+
+	/**
+	 * @brief Executes query on the executor.
+	 * @return future of the query result rows. The rows are read on the executor, so the connection is released
+	 *         before the future is fulfilled.
+	 */
+	AFuture<AVector<AVector<AVariant>>> queryAsync(const AString& query, const AVector<AVariant>& params = {});
+
+	/**
+	 * @brief Executes execute on the executor.
+	 */
+	AFuture<int> executeAsync(const AString& query, const AVector<AVariant>& params = {});
+
+	/**
+	 * @brief Executes executeBatch on the executor.
+	 */
+	AFuture<int> executeBatchAsync(const AString& query, const AVector<AVector<AVariant>>& paramSets);
+
+	/**
+	 * @return snapshot of the query timing statistics gathered since the connection or resetStatistics.
+	 */
+	Statistics statistics() const;
+
+	void resetStatistics();
+
 	/**
 	 * @brief the type of the driver. Required to correct queries in the database due to driver differences.
      * @return type of driver
@@ -13,6 +13,7 @@
 
 #include "AModelMeta.h"
 #include <AUI/Data/ASqlBuilder.h>
+#include <AUI/Data/ASqlColumnMapping.h>
 
 #include <utility>
 
@@ -91,32 +92,33 @@ struct ASqlModel {
             return *this;
         }
 
+        /**
+         * @brief Does the query and passes each row in ORM to the callback as soon as it is read.
+         * @param callback callable accepting Model.
+         * @details
+         * Unlike get(), does not keep the whole result in memory.
+         */
+        template<typename Callback>
+        void forEach(Callback&& callback) {
+            mSql += " ";
+            mSql += mWhereExpr;
+            auto dbResult = Autumn::get<ASqlDatabase>()->query(mSql, mWhereParams);
+            const auto& decoders = ASqlColumnMapping<Model>::of(dbResult->getColumns());
+            for (const auto& row : *dbResult) {
+                callback(ASqlColumnMapping<Model>::decode(decoders, row));
+            }
+        }
+
         /**
          * @brief Get query result in ORM.
          * @return query result in ORM
          */
         AVector<Model> get() {
-            auto idField = AField<ASqlModel<Model>>::make(&ASqlModel<Model>::id);
             AVector<Model> result;
             result.reserve(0x100);
-
-            mSql += " ";
-            mSql += mWhereExpr;
-            auto dbResult = Autumn::get<ASqlDatabase>()->query(mSql, mWhereParams);
-
-            AVector<size_t> sqlColumnToModelFieldIndexMapping;
-            AVector<_<AField<Model>>> fields;
-            fields << AModelMeta<Model>::getFields().valueVector();
-
-            for (auto& row : dbResult) {
-                Model m;
-                idField->set(m, row->getValue(0));
-                for (size_t columnIndex = 1; columnIndex < dbResult->getColumns().size(); ++columnIndex) {
-                    fields[columnIndex - 1]->set(m, row->getValue(columnIndex));
-                }
+            forEach([&](Model&& m) {
                 result << std::move(m);
-            }
-
+            });
             return result;
         }
 
@@ -139,7 +141,7 @@ struct ASqlModel {
         AStringVector columnNames;
         columnNames << "id";
         columnNames << Meta::getFields().keyVector();
-        return aui::ptr::manage_shared(new IncompleteSelectRequest("SELECT " + (columnNames.empty() ? '*'
+        return aui::ptr::manage_shared(new IncompleteSelectRequest("SELECT " + (columnNames.empty() ? AString("*")
             : columnNames.join(',')) + " FROM " + AModelMeta<Model>::getSqlTable(), expression));
     }
 
@@ -166,7 +168,7 @@ struct ASqlModel {
         AStringVector columnNames;
         columnNames << "id";
         columnNames << Meta::getFields().keyVector();
-        return aui::ptr::manage_shared(new IncompleteSelectRequest("SELECT " + (columnNames.empty() ? '*'
+        return aui::ptr::manage_shared(new IncompleteSelectRequest("SELECT " + (columnNames.empty() ? AString("*")
             : columnNames.join(',')) + " FROM " + AModelMeta<Model>::getSqlTable(), {}));
     }
 
@@ -11,6 +11,121 @@
 
 #include "ASqlQueryResult.h"
 
+namespace {
+class MaterializedRow: public ISqlDriverRow
+{
+public:
+	explicit MaterializedRow(const AVector<AVariant>& cells): mCells(cells) {}
+
+	/**
+	 * @brief Index of the first cell of the row.
+	 */
+	size_t offset = 0;
+
+	AVariant getValue(size_t index) override
+	{
+		return cell(index);
+	}
+
+	bool isNull(size_t index) override
+	{
+		return cell(index).isNull();
+	}
+
+	std::int64_t getInt64(size_t index) override
+	{
+		const auto& value = cell(index);
+		switch (value.getType()) {
+			case AVariantType::AV_UINT:
+				return value.toUInt();
+			case AVariantType::AV_STRING:
+				// drivers box integers which do not fit AVariant into strings.
+				return value.toString().toLong().valueOr(0);
+			default:
+				return value.toInt();
+		}
+	}
+
+	double getDouble(size_t index) override
+	{
+		return cell(index).toDouble();
+	}
+
+	AString getString(size_t index) override
+	{
+		return cell(index).toString();
+	}
+
+private:
+	const AVector<AVariant>& mCells;
+
+	const AVariant& cell(size_t index) const
+	{
+		return mCells[offset + index];
+	}
+};
+
+/**
+ * @brief Rows of a driver result read into memory, so the connection can be released before the result is read.
+ */
+class MaterializedResult: public ISqlDriverResult
+{
+public:
+	explicit MaterializedResult(ISqlDriverResult& source):
+		mColumns(source.getColumns()),
+		mRow(_new<MaterializedRow>(mCells))
+	{
+		for (auto row = source.begin(); row; row = source.next(row)) {
+			for (size_t i = 0; i < mColumns.size(); ++i) {
+				mCells << row->getValue(i);
+			}
+			++mRowCount;
+		}
+	}
+
+	const AVector<SqlColumn>& getColumns() override
+	{
+		return mColumns;
+	}
+
+	size_t rowCount() override
+	{
+		return mRowCount;
+	}
+
+	_<ISqlDriverRow> begin() override
+	{
+		mRowIndex = 0;
+		return current();
+	}
+
+	_<ISqlDriverRow> next(const _<ISqlDriverRow>& previous) override
+	{
+		++mRowIndex;
+		return current();
+	}
+
+private:
+	AVector<SqlColumn> mColumns;
+	AVector<AVariant> mCells;
+	size_t mRowCount = 0;
+	size_t mRowIndex = 0;
+
+	/*
+	 * The same row object is returned for every row, as drivers do.
+	 */
+	_<MaterializedRow> mRow;
+
+	_<ISqlDriverRow> current()
+	{
+		if (mRowIndex >= mRowCount) {
+			return nullptr;
+		}
+		mRow->offset = mRowIndex * mColumns.size();
+		return mRow;
+	}
+};
+}
 
 ASqlQueryResult::Iterator::Iterator(const _<ISqlDriverResult>& sql): mResult(sql)
 {
@@ -39,3 +154,13 @@ const AVector<SqlColumn>& ASqlQueryResult::getColumns() const
 {
 	return mDriverInterface->getColumns();
 }
+
+void ASqlQueryResult::detach()
+{
+	if (!mConnection) {
+		return;
+	}
+	// the driver result is destroyed before the connection is released.
+	mDriverInterface = _new<MaterializedResult>(*mDriverInterface);
+	mConnection = nullptr;
+}
@@ -18,15 +18,22 @@
 #include "ISqlDriverResult.h"
 #include "AUI/Common/AVariant.h"
 
+class ISqlDatabase;
+
 class API_AUI_DATA ASqlQueryResult
 {
 	friend class ASqlDatabase;
 private:
 	_<ISqlDriverResult> mDriverInterface;
 
+	/*
+	 * Keeps the connection the result is read from checked out while the result is alive.
+	 */
+	_<ISqlDatabase> mConnection;
+
 
-	explicit ASqlQueryResult(const _<ISqlDriverResult>& sql_driver_result)
-		: mDriverInterface(sql_driver_result)
+	explicit ASqlQueryResult(const _<ISqlDriverResult>& sql_driver_result, _<ISqlDatabase> connection = nullptr)
+		: mDriverInterface(sql_driver_result), mConnection(std::move(connection))
 	{
 	}
 
@@ -75,6 +82,26 @@ public:
 			return mRow->getValue(index);
 		}
 
+		bool isNull(size_t index) const
+		{
+			return mRow->isNull(index);
+		}
+
+		std::int64_t getInt64(size_t index) const
+		{
+			return mRow->getInt64(index);
+		}
+
+		double getDouble(size_t index) const
+		{
+			return mRow->getDouble(index);
+		}
+
+		AString getString(size_t index) const
+		{
+			return mRow->getString(index);
+		}
+
         AVector<AVariant> range(size_t count) const {
             AVector<AVariant> v;
             for (size_t i = 0; i < count; ++i) {
@@ -89,4 +116,13 @@ public:
 
 	size_t getRowCount() const;
 	const AVector<SqlColumn>& getColumns() const;
+
+	/**
+	 * @brief Reads the rows into memory and releases the connection the result is read from.
+	 * @details
+	 * Call it before iterating, when the result is kept alive while other threads use the same database: with a
+	 * single connection, they wait until the result is destroyed or detached. Typed accessors of a detached result read
+	 * the values from AVariant.
+	 */
+	void detach();
 };
@@ -0,0 +1,72 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <type_traits>
+#include <AUI/Common/AOptional.h>
+#include <AUI/Reflect/members.h>
+#include "ASqlQueryResult.h"
+
+namespace aui::sql {
+
+namespace detail {
+template<typename T>
+struct is_optional: std::false_type {};
+
+template<typename T>
+struct is_optional<AOptional<T>>: std::true_type {
+    using value_type = T;
+};
+}
+
+/**
+ * @brief Reads a column of the current row as T using the typed accessors of the driver, without boxing the value
+ *        into AVariant.
+ * @details
+ * Supports integral, enum, floating point, string-constructible types and AOptional of them (NULL is an empty
+ * AOptional).
+ */
+template<typename T>
+T read(const ASqlQueryResult::Iterator& row, size_t column) {
+    if constexpr (detail::is_optional<T>::value) {
+        if (row.isNull(column)) {
+            return std::nullopt;
+        }
+        return read<typename detail::is_optional<T>::value_type>(row, column);
+    } else if constexpr (std::is_same_v<T, bool>) {
+        return row.getInt64(column) != 0;
+    } else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+        return static_cast<T>(row.getInt64(column));
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return static_cast<T>(row.getDouble(column));
+    } else {
+        static_assert(std::is_constructible_v<T, AString>, "unsupported model field type");
+        return T(row.getString(column));
+    }
+}
+
+/**
+ * @brief Assigns a column of the current row to a field of the model.
+ */
+template<typename Model>
+using FieldDecoder = void(*)(Model& model, const ASqlQueryResult::Iterator& row, size_t column);
+
+/**
+ * @brief FieldDecoder for the specified field.
+ * @tparam field pointer to the field of Model or of its base.
+ */
+template<typename Model, auto field>
+void decodeField(Model& model, const ASqlQueryResult::Iterator& row, size_t column) {
+    model.*field = read<typename aui::reflect::member<decltype(field)>::type>(row, column);
+}
+
+}
@@ -10,3 +10,11 @@
  */
 
 #include "ISqlDatabase.h"
+
+int ISqlDatabase::executeBatch(const AString& query, const AVector<AVector<AVariant>>& paramSets) {
+    int result = 0;
+    for (const auto& params : paramSets) {
+        result = execute(query, params);
+    }
+    return result;
+}
@@ -10,6 +10,7 @@
  */
 
 #pragma once
+#include <AUI/Data.h>
 #include "AUI/Common/SharedPtrTypes.h"
 #include "ISqlDriverResult.h"
 #include "AUI/Common/AVariant.h"
@@ -19,12 +20,21 @@
 /*
  * @brief Driver-to-aui.data interface. See ASqlDatabase for Application-to-aui.data interface
  */
-class ISqlDatabase
+class API_AUI_DATA ISqlDatabase
 {
 public:
 	virtual ~ISqlDatabase() = default;
 	virtual _<ISqlDriverResult> query(const AString& query, const AVector<AVariant>& params) = 0;
 	virtual int execute(const AString& query, const AVector<AVariant>& params) = 0;
 
+	/*
+	 * @brief Executes the same query for each parameter set.
+	 * @return the result of execute for the last parameter set
+	 * @details
+	 * The default implementation calls execute for each parameter set. Drivers are encouraged to override it in order
+	 * to prepare the query once and to run all parameter sets in a single transaction.
+	 */
+	virtual int executeBatch(const AString& query, const AVector<AVector<AVariant>>& paramSets);
+
 	virtual SqlDriverType getDriverType() = 0;
 };
@@ -20,4 +20,25 @@ public:
 	virtual ~ISqlDriverRow() = default;
 
 	virtual AVariant getValue(size_t index) = 0;
+
+	/*
+	 * Typed accessors. Drivers are encouraged to override them to read the values directly, without boxing them into
+	 * AVariant.
+	 */
+
+	virtual bool isNull(size_t index) {
+		return getValue(index).getType() == AVariantType::AV_NULL;
+	}
+
+	virtual std::int64_t getInt64(size_t index) {
+		return getValue(index).toInt();
+	}
+
+	virtual double getDouble(size_t index) {
+		return getValue(index).toDouble();
+	}
+
+	virtual AString getString(size_t index) {
+		return getValue(index).toString();
+	}
 };
@@ -0,0 +1,102 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <type_traits>
+#include <AUI/Common/SharedPtrTypes.h>
+#include <AUI/Common/AOptional.h>
+#include <AUI/Common/AVariant.h>
+
+/**
+ * @brief Type-erased accessor of a data member of T, reading and writing it as AVariant.
+ * @details
+ * Created with AField<T>::make(&T::member), see A_FIELD.
+ */
+template<class T>
+class AField {
+public:
+    virtual ~AField() = default;
+
+    virtual AVariant get(const T& object) const = 0;
+    virtual void set(T& object, const AVariant& value) const = 0;
+
+    template<typename F, typename C>
+    static _<AField<T>> make(F C::* member);
+};
+
+namespace aui::detail {
+    template<typename F>
+    struct is_field_optional: std::false_type {};
+
+    template<typename F>
+    struct is_field_optional<AOptional<F>>: std::true_type {
+        using value_type = F;
+    };
+
+    template<typename F>
+    AVariant toVariant(const F& value) {
+        if constexpr (is_field_optional<F>::value) {
+            if (!value) {
+                return nullptr;
+            }
+            return toVariant(*value);
+        } else {
+            return value;
+        }
+    }
+
+    template<typename F>
+    F fromVariant(const AVariant& value) {
+        if constexpr (is_field_optional<F>::value) {
+            if (value.isNull()) {
+                return std::nullopt;
+            }
+            return fromVariant<typename is_field_optional<F>::value_type>(value);
+        } else if constexpr (std::is_same_v<F, bool>) {
+            return value.toBool();
+        } else if constexpr (std::is_integral_v<F> && std::is_signed_v<F>) {
+            return F(value.toInt());
+        } else if constexpr (std::is_integral_v<F>) {
+            return F(value.toUInt());
+        } else if constexpr (std::is_same_v<F, float>) {
+            return value.toFloat();
+        } else if constexpr (std::is_floating_point_v<F>) {
+            return F(value.toDouble());
+        } else {
+            return F(value.toString());
+        }
+    }
+
+    template<typename T, typename F, typename C>
+    class AFieldImpl: public AField<T> {
+    public:
+        explicit AFieldImpl(F C::* member): mMember(member) {}
+
+        AVariant get(const T& object) const override {
+            return toVariant(object.*mMember);
+        }
+
+        void set(T& object, const AVariant& value) const override {
+            object.*mMember = fromVariant<F>(value);
+        }
+
+    private:
+        F C::* mMember;
+    };
+}
+
+template<class T>
+template<typename F, typename C>
+_<AField<T>> AField<T>::make(F C::* member) {
+    static_assert(std::is_base_of_v<C, T>, "member should belong to T or its base");
+    return _new<aui::detail::AFieldImpl<T, F, C>>(member);
+}
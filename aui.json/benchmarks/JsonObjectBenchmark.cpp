@@ -0,0 +1,42 @@
+#include <benchmark/benchmark.h>
+#include "AUI/Json/AJson.h"
+
+static AJson::Object wideObject(int keys) {
+    AJson::Object object;
+    for (int i = 0; i < keys; ++i) {
+        object["field{}"_format(i)] = i;
+    }
+    return object;
+}
+
+// Deserialization-like access pattern: every field of a const object is looked up by name.
+static void JsonObjectLookup(benchmark::State& state) {
+    const auto keys = int(state.range(0));
+    const auto object = wideObject(keys);
+    AVector<AString> names;
+    for (int i = 0; i < keys; ++i) {
+        names << "field{}"_format(i);
+    }
+    for (auto _ : state) {
+        int sum = 0;
+        for (const auto& name : names) {
+            sum += object.at(name).asInt();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * keys);
+}
+
+BENCHMARK(JsonObjectLookup)->Arg(4)->Arg(16)->Arg(64)->Arg(512);
+
+// Serialization-like access pattern: object is filled by operator[], which looks up each key before inserting.
+static void JsonObjectBuild(benchmark::State& state) {
+    const auto keys = int(state.range(0));
+    for (auto _ : state) {
+        auto object = wideObject(keys);
+        benchmark::DoNotOptimize(object);
+    }
+    state.SetItemsProcessed(state.iterations() * keys);
+}
+
+BENCHMARK(JsonObjectBuild)->Arg(4)->Arg(16)->Arg(64)->Arg(512);
@@ -1,11 +1,19 @@
 #include <benchmark/benchmark.h>
 #include <AUI/Curl/ACurl.h>
 #include <AUI/Platform/AProcess.h>
+#include <AUI/IO/AByteBufferInputStream.h>
 #include "AUI/Json/AJson.h"
+#include "AUI/Json/AJsonReader.h"
 #include "AUI/Thread/AThread.h"
 
+static const AByteBuffer& rawJson() {
+    static auto buffer = ACurl::Builder("https://raw.githubusercontent.com/json-iterator/test-data/master/large-file.json").runBlocking().body;
+    return buffer;
+}
+
+// AJson::fromBuffer: buffer-based parser.
 static void JsonParse(benchmark::State& state) {
-    auto rawJson = ACurl::Builder("https://raw.githubusercontent.com/json-iterator/test-data/master/large-file.json").runBlocking().body;
+    const auto& rawJson = ::rawJson();
     using namespace std::chrono_literals;
 
     auto beforeTest = AProcess::self()->processMemory();
@@ -18,6 +26,35 @@ static void JsonParse(benchmark::State& state) {
     }
 
     state.counters["ProcessMemory"] = memUsage;
+    state.SetBytesProcessed(state.iterations() * rawJson.size());
+}
+
+BENCHMARK(JsonParse)->Iterations(10);
+
+// AJson::fromStream: ATokenizer-based parser, used for streams of unknown size. Baseline for JsonParse.
+static void JsonParseStream(benchmark::State& state) {
+    const auto& rawJson = ::rawJson();
+    for (auto _ : state) {
+        auto json = AJson::fromStream(AByteBufferInputStream(rawJson));
+        benchmark::DoNotOptimize(json);
+    }
+    state.SetBytesProcessed(state.iterations() * rawJson.size());
+}
+
+BENCHMARK(JsonParseStream)->Iterations(10);
+
+// AJsonReader: streaming tokenizer, no tree is built.
+static void JsonReaderTokens(benchmark::State& state) {
+    const auto& rawJson = ::rawJson();
+    for (auto _ : state) {
+        AJsonReader reader(_new<AByteBufferInputStream>(rawJson));
+        std::size_t tokens = 0;
+        while (reader.next() != AJsonReader::Token::END) {
+            ++tokens;
+        }
+        benchmark::DoNotOptimize(tokens);
+    }
+    state.SetBytesProcessed(state.iterations() * rawJson.size());
 }
 
-BENCHMARK(JsonParse)->Iterations(10);
\ No newline at end of file
+BENCHMARK(JsonReaderTokens)->Iterations(10);
@@ -11,9 +11,8 @@
 
 #include "AJson.h"
 #include <range/v3/algorithm/find.hpp>
-#include "AUI/IO/AStringStream.h"
 #include "AUI/Common/AByteBuffer.h"
-#include "AUI/IO/AByteBufferInputStream.h"
+#include "detail/BufferParser.h"
 
 AString AJson::toString(const AJson& json) {
     AByteBuffer buffer;
@@ -22,13 +21,12 @@ AString AJson::toString(const AJson& json) {
 }
 
 AJson AJson::fromString(const AString& json) {
-    AStringStream sis(json);
-    return aui::deserialize<AJson>(sis);
+    return aui::impl::json::parseBuffer(json.toStdString());
 }
 
 AJson AJson::fromBuffer(AByteBufferView buffer) {
     try {
-        return aui::deserialize<AJson>(AByteBufferInputStream(buffer));
+        return aui::impl::json::parseBuffer({ buffer.data(), buffer.size() });
     } catch (...) {
         throw AJsonException("While parsing:\n" + AString::fromUtf8(buffer), std::current_exception());
     }
@@ -46,18 +44,98 @@ AJson AJson::mergedWith(const AJson &other) {
 }
 
 std::pair<AString, AJson>* aui::impl::JsonObject::contains(const AString& key) noexcept {
-    if (auto it = ranges::find(*this, key, &std::pair<AString, AJson>::first); it != end()) {
-        return &(*it);
+    if (!isIndexUpToDate() && super::size() > INDEX_THRESHOLD) {
+        rebuildIndex();
     }
-    return nullptr;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    return const_cast<value_type*>(find(key));
 }
 
 AJson& aui::impl::JsonObject::operator[](const AString& key) {
     if (auto v = contains(key)) {
         return v->second;
     }
-    emplace_back(key, AJson{});
-    return back().second;
+    return emplace_back(key, AJson{}).second;
+}
+
+const std::pair<AString, AJson>* aui::impl::JsonObject::find(const AString& key) const noexcept {
+    if (!isIndexUpToDate()) {
+        if (auto it = ranges::find(*this, key, &value_type::first); it != end()) {
+            return &(*it);
+        }
+        return nullptr;
+    }
+    const auto mask = mIndex.size() - 1;
+    for (auto slot = std::hash<std::string_view>{}(key) & mask;; slot = (slot + 1) & mask) {
+        auto position = mIndex[slot];
+        if (position == 0) {
+            return nullptr;
+        }
+        const auto& element = super::operator[](position - 1);
+        if (element.first == key) {
+            return &element;
+        }
+    }
+}
+
+void aui::impl::JsonObject::rebuildIndex() {
+    std::size_t slots = 16;
+    while (slots < super::size() * 2) {
+        slots *= 2;
+    }
+    mIndex.clear();
+    mIndex.resize(slots, 0);
+    for (std::size_t i = 0; i < super::size(); ++i) {
+        indexInsert(i);
+    }
+    mIndexUpToDate = true;
+}
+
+void aui::impl::JsonObject::indexInsert(std::size_t position) noexcept {
+    const auto& key = super::operator[](position).first;
+    const auto mask = mIndex.size() - 1;
+    for (auto slot = std::hash<std::string_view>{}(key) & mask;; slot = (slot + 1) & mask) {
+        auto& s = mIndex[slot];
+        if (s == 0) {
+            s = std::uint32_t(position + 1);
+            return;
+        }
+        if (super::operator[](s - 1).first == key) {
+            // duplicate key; lookups return the first occurrence, as linear search does.
+            return;
+        }
+    }
+}
+
+void aui::impl::JsonObject::onAppended() {
+    if (super::size() <= INDEX_THRESHOLD) {
+        return;
+    }
+    if (!mIndexUpToDate || super::size() * 2 > mIndex.size()) {
+        rebuildIndex();
+        return;
+    }
+    indexInsert(super::size() - 1);
+}
+
+void aui::impl::JsonObject::push_back(const value_type& value) {
+    super::push_back(value);
+    onAppended();
+}
+
+void aui::impl::JsonObject::push_back(value_type&& value) {
+    super::push_back(std::move(value));
+    onAppended();
+}
+
+void aui::impl::JsonObject::pop_back() {
+    invalidateIndex();
+    super::pop_back();
+}
+
+void aui::impl::JsonObject::clear() noexcept {
+    invalidateIndex();
+    super::clear();
 }
 
 AJson& aui::impl::JsonObject::at(const AString& key) {
@@ -66,3 +144,10 @@ AJson& aui::impl::JsonObject::at(const AString& key) {
     }
     throw AException("no such key: {}"_format(key));
 }
+
+const AJson& aui::impl::JsonObject::at(const AString& key) const {
+    if (auto v = contains(key)) {
+        return v->second;
+    }
+    throw AException("no such key: {}"_format(key));
+}
@@ -30,9 +30,30 @@
 
 class AJson;
 namespace aui::impl {
+    /**
+     * @brief Json object: an insertion-ordered list of key-value pairs.
+     * @details
+     * Objects with more than INDEX_THRESHOLD keys maintain an auxiliary open-addressing hash index (positions of the
+     * elements), so key lookups do not degrade to linear scans on wide objects. The index is kept up to date by
+     * appending methods and is dropped by every other non-const member that may reorder or modify the pairs (erase,
+     * insert, removeAt, non-const iteration and element access, etc); it is rebuilt lazily by the next non-const
+     * lookup. Const lookups never modify the object: they use the index only if it is up to date and search linearly
+     * otherwise, so concurrent reads of a const object are safe.
+     *
+     * Mutating the pairs through a reference to the base AVector bypasses index maintenance; do not modify the object
+     * that way.
+     */
     struct JsonObject: AVector<std::pair<AString, AJson>> {
+    private:
+        using super = AVector<std::pair<AString, AJson>>;
+
     public:
-        using AVector<std::pair<AString, AJson>>::AVector;
+        /**
+         * @brief Objects with at most this count of keys are searched linearly.
+         */
+        static constexpr std::size_t INDEX_THRESHOLD = 8;
+
+        using super::super;
 
         /**
          * @brief If container contains key, returns pointer to the element. nullptr otherwise.
@@ -45,8 +66,7 @@ namespace aui::impl {
          */
         [[nodiscard]]
         const std::pair<AString, AJson>* contains(const AString& key) const noexcept {
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-            return const_cast<JsonObject&>(*this).contains(key);
+            return find(key);
         }
 
         [[nodiscard]] API_AUI_JSON AJson& operator[](const AString& key);
@@ -65,10 +85,95 @@ namespace aui::impl {
          * @brief If container contains key, returns reference to the element.
          * @throws AException if key is not found.
          */
-        [[nodiscard]] const AJson& at(const AString& key) const {
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-            return const_cast<JsonObject&>(*this).at(key);
+        [[nodiscard]] API_AUI_JSON const AJson& at(const AString& key) const;
+
+        template<typename... Args>
+        value_type& emplace_back(Args&&... args);
+        API_AUI_JSON void push_back(const value_type& value);
+        API_AUI_JSON void push_back(value_type&& value);
+        API_AUI_JSON void pop_back();
+        API_AUI_JSON void clear() noexcept;
+
+        template<typename... Args>
+        iterator insert(Args&&... args);
+
+        template<typename... Args>
+        iterator erase(Args&&... args);
+
+        JsonObject& operator<<(value_type value);
+
+        // non-const access allows modification of keys, so it drops the index.
+        iterator begin() noexcept;
+        iterator end() noexcept;
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+        reverse_iterator rbegin() noexcept;
+        reverse_iterator rend() noexcept;
+        const_reverse_iterator rbegin() const noexcept;
+        const_reverse_iterator rend() const noexcept;
+        value_type& front();
+        value_type& back();
+        const value_type& front() const;
+        const value_type& back() const;
+        value_type& first();
+        value_type& last();
+        const value_type& first() const;
+        const value_type& last() const;
+        value_type* data() noexcept;
+        const value_type* data() const noexcept;
+
+        // mutators of the base, which may reorder or modify the pairs, so they drop the index.
+        template<typename... Args>
+        decltype(auto) emplace(Args&&... args);
+        template<typename... Args>
+        decltype(auto) insertAll(Args&&... args);
+        template<typename... Args>
+        decltype(auto) assign(Args&&... args);
+        template<typename... Args>
+        decltype(auto) resize(Args&&... args);
+        template<typename... Args>
+        decltype(auto) removeAt(Args&&... args);
+        template<typename... Args>
+        decltype(auto) removeIf(Args&&... args);
+        template<typename... Args>
+        decltype(auto) removeIfFirst(Args&&... args);
+        template<typename... Args>
+        decltype(auto) removeAll(Args&&... args);
+        template<typename... Args>
+        decltype(auto) removeFirst(Args&&... args);
+        template<typename... Args>
+        decltype(auto) sort(Args&&... args);
+        template<typename... Args>
+        decltype(auto) findIf(Args&&... args);
+        void swap(JsonObject& other) noexcept;
+
+    private:
+        /**
+         * @brief Open-addressing table of element positions + 1; 0 is an empty slot. Size is a power of 2.
+         */
+        AVector<std::uint32_t> mIndex;
+
+        /**
+         * @brief Whether mIndex holds the positions of all elements. Cleared by every member which may reorder or
+         * modify the pairs.
+         */
+        bool mIndexUpToDate = false;
+
+        [[nodiscard]]
+        bool isIndexUpToDate() const noexcept {
+            return mIndexUpToDate;
+        }
+
+        void invalidateIndex() noexcept {
+            mIndex.clear();
+            mIndexUpToDate = false;
         }
+
+        [[nodiscard]]
+        API_AUI_JSON const value_type* find(const AString& key) const noexcept;
+        API_AUI_JSON void rebuildIndex();
+        API_AUI_JSON void indexInsert(std::size_t position) noexcept;
+        API_AUI_JSON void onAppended();
     };
     using JsonArray = AVector<AJson>;
     using JsonVariant = std::variant<std::nullopt_t, std::nullptr_t, int, int64_t, double, bool, AString, aui::impl::JsonArray, aui::impl::JsonObject>;
@@ -381,6 +486,138 @@ public:
 };
 
 
+template<typename... Args>
+std::pair<AString, AJson>& aui::impl::JsonObject::emplace_back(Args&&... args) {
+    super::emplace_back(std::forward<Args>(args)...);
+    onAppended();
+    return super::back();
+}
+
+template<typename... Args>
+aui::impl::JsonObject::iterator aui::impl::JsonObject::insert(Args&&... args) {
+    invalidateIndex();
+    return super::insert(std::forward<Args>(args)...);
+}
+
+template<typename... Args>
+aui::impl::JsonObject::iterator aui::impl::JsonObject::erase(Args&&... args) {
+    invalidateIndex();
+    return super::erase(std::forward<Args>(args)...);
+}
+
+inline aui::impl::JsonObject& aui::impl::JsonObject::operator<<(value_type value) {
+    push_back(std::move(value));
+    return *this;
+}
+
+inline aui::impl::JsonObject::iterator aui::impl::JsonObject::begin() noexcept {
+    invalidateIndex();
+    return super::begin();
+}
+
+inline aui::impl::JsonObject::iterator aui::impl::JsonObject::end() noexcept {
+    invalidateIndex();
+    return super::end();
+}
+
+inline aui::impl::JsonObject::const_iterator aui::impl::JsonObject::begin() const noexcept {
+    return super::begin();
+}
+
+inline aui::impl::JsonObject::const_iterator aui::impl::JsonObject::end() const noexcept {
+    return super::end();
+}
+
+inline aui::impl::JsonObject::reverse_iterator aui::impl::JsonObject::rbegin() noexcept {
+    invalidateIndex();
+    return super::rbegin();
+}
+
+inline aui::impl::JsonObject::reverse_iterator aui::impl::JsonObject::rend() noexcept {
+    invalidateIndex();
+    return super::rend();
+}
+
+inline aui::impl::JsonObject::const_reverse_iterator aui::impl::JsonObject::rbegin() const noexcept {
+    return super::rbegin();
+}
+
+inline aui::impl::JsonObject::const_reverse_iterator aui::impl::JsonObject::rend() const noexcept {
+    return super::rend();
+}
+
+inline std::pair<AString, AJson>& aui::impl::JsonObject::front() {
+    invalidateIndex();
+    return super::front();
+}
+
+inline std::pair<AString, AJson>& aui::impl::JsonObject::back() {
+    invalidateIndex();
+    return super::back();
+}
+
+inline const std::pair<AString, AJson>& aui::impl::JsonObject::front() const {
+    return super::front();
+}
+
+inline const std::pair<AString, AJson>& aui::impl::JsonObject::back() const {
+    return super::back();
+}
+
+inline std::pair<AString, AJson>& aui::impl::JsonObject::first() {
+    invalidateIndex();
+    return super::first();
+}
+
+inline std::pair<AString, AJson>& aui::impl::JsonObject::last() {
+    invalidateIndex();
+    return super::last();
+}
+
+inline const std::pair<AString, AJson>& aui::impl::JsonObject::first() const {
+    return super::first();
+}
+
+inline const std::pair<AString, AJson>& aui::impl::JsonObject::last() const {
+    return super::last();
+}
+
+inline std::pair<AString, AJson>* aui::impl::JsonObject::data() noexcept {
+    invalidateIndex();
+    return super::data();
+}
+
+inline const std::pair<AString, AJson>* aui::impl::JsonObject::data() const noexcept {
+    return super::data();
+}
+
+#define AUI_JSON_OBJECT_INVALIDATING(name)                                          \
+    template<typename... Args>                                                      \
+    decltype(auto) aui::impl::JsonObject::name(Args&&... args) {                    \
+        invalidateIndex();                                                          \
+        return super::name(std::forward<Args>(args)...);                            \
+    }
+
+AUI_JSON_OBJECT_INVALIDATING(emplace)
+AUI_JSON_OBJECT_INVALIDATING(insertAll)
+AUI_JSON_OBJECT_INVALIDATING(assign)
+AUI_JSON_OBJECT_INVALIDATING(resize)
+AUI_JSON_OBJECT_INVALIDATING(removeAt)
+AUI_JSON_OBJECT_INVALIDATING(removeIf)
+AUI_JSON_OBJECT_INVALIDATING(removeIfFirst)
+AUI_JSON_OBJECT_INVALIDATING(removeAll)
+AUI_JSON_OBJECT_INVALIDATING(removeFirst)
+AUI_JSON_OBJECT_INVALIDATING(sort)
+AUI_JSON_OBJECT_INVALIDATING(findIf)
+
+#undef AUI_JSON_OBJECT_INVALIDATING
+
+inline void aui::impl::JsonObject::swap(JsonObject& other) noexcept {
+    super::swap(other);
+    mIndex.swap(other.mIndex);
+    std::swap(mIndexUpToDate, other.mIndexUpToDate);
+}
+
 #include <AUI/Json/Conversion.h>
 #include <AUI/Json/Serialization.h>
 
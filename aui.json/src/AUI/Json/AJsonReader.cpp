@@ -0,0 +1,330 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "AJsonReader.h"
+#include "detail/BufferParser.h"
+
+namespace {
+
+constexpr std::size_t MAX_DEPTH = 1024;
+
+bool isWhitespace(char c) noexcept { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+bool isDigit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+bool isAlnum(char c) noexcept { return isDigit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+
+bool isNumberCharacter(char c) noexcept {
+    return isDigit(c) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+}   // namespace
+
+AJsonReader::AJsonReader(_<IInputStream> stream) : mStream(std::move(stream)) {
+    mBuffer.resize(BUFFER_SIZE);
+    mIt = mEnd = mBuffer.data();
+}
+
+bool AJsonReader::fill() {
+    if (mIt != mEnd) {
+        return true;
+    }
+    if (mEof) {
+        return false;
+    }
+    for (auto it = mBuffer.data(); it != mEnd; ++it) {
+        if (*it == '\n') {
+            ++mRow;
+            mLineBegin = it - mBuffer.data() + 1;
+        }
+    }
+    mLineBegin -= mEnd - mBuffer.data();
+
+    const auto read = mStream->read(mBuffer.data(), mBuffer.size());
+    mIt = mBuffer.data();
+    mEnd = mIt + read;
+    if (read == 0) {
+        mEof = true;
+        return false;
+    }
+    return true;
+}
+
+void AJsonReader::error(const AString& message) const {
+    auto row = mRow;
+    auto lineBegin = mLineBegin;
+    for (auto it = mBuffer.data(); it < mIt; ++it) {
+        if (*it == '\n') {
+            ++row;
+            lineBegin = it - mBuffer.data() + 1;
+        }
+    }
+    throw AJsonParseException("{} at {}:{}"_format(message, row, (mIt - mBuffer.data()) - lineBegin + 1));
+}
+
+void AJsonReader::unexpectedCharacter() const {
+    if (mIt == mEnd) {
+        throw AJsonParseException("unexpected end of json stream");
+    }
+    error("unexpected character {}"_format(*mIt));
+}
+
+char AJsonReader::peekNonWhitespace() {
+    for (;;) {
+        if (!fill()) {
+            unexpectedCharacter();
+        }
+        if (!isWhitespace(*mIt)) {
+            return *mIt;
+        }
+        ++mIt;
+    }
+}
+
+AJsonReader::Token AJsonReader::next() {
+    Token result;
+    if (mPeeked) {
+        result = *mPeeked;
+        mPeeked.reset();
+    } else {
+        result = readToken();
+    }
+    mLastToken = result;
+    return result;
+}
+
+AJsonReader::Token AJsonReader::peek() {
+    if (!mPeeked) {
+        mPeeked = readToken();
+    }
+    return *mPeeked;
+}
+
+void AJsonReader::expect(Token token) {
+    if (next() != token) {
+        error("unexpected json token");
+    }
+}
+
+AJsonReader::Token AJsonReader::readToken() {
+    for (;;) {
+        switch (mState) {
+            case State::AFTER_VALUE: {
+                if (mContainers.empty()) {
+                    return Token::END;
+                }
+                const char c = peekNonWhitespace();
+                const bool inObject = mContainers.back() == '{';
+                if (c == ',') {
+                    ++mIt;
+                    mState = inObject ? State::OBJECT_KEY : State::ARRAY_ELEMENT;
+                    continue;
+                }
+                if (c == (inObject ? '}' : ']')) {
+                    ++mIt;
+                    mContainers.pop_back();
+                    return inObject ? Token::END_OBJECT : Token::END_ARRAY;
+                }
+                unexpectedCharacter();
+            }
+
+            case State::OBJECT_KEY: {
+                const char c = peekNonWhitespace();
+                if (c == '}') {
+                    ++mIt;
+                    mContainers.pop_back();
+                    mState = State::AFTER_VALUE;
+                    return Token::END_OBJECT;
+                }
+                if (c != '"') {
+                    unexpectedCharacter();
+                }
+                ++mIt;
+                mKey = readString();
+                if (peekNonWhitespace() != ':') {
+                    unexpectedCharacter();
+                }
+                ++mIt;
+                mState = State::VALUE;
+                return Token::KEY;
+            }
+
+            case State::ARRAY_ELEMENT:
+                if (peekNonWhitespace() == ']') {
+                    ++mIt;
+                    mContainers.pop_back();
+                    mState = State::AFTER_VALUE;
+                    return Token::END_ARRAY;
+                }
+                mState = State::VALUE;
+                continue;
+
+            case State::VALUE: {
+                const char c = peekNonWhitespace();
+                mState = State::AFTER_VALUE;
+                switch (c) {
+                    case '{':
+                    case '[':
+                        if (mContainers.size() >= MAX_DEPTH) {
+                            error("json is nested too deeply");
+                        }
+                        ++mIt;
+                        mContainers << c;
+                        if (c == '{') {
+                            mState = State::OBJECT_KEY;
+                            return Token::BEGIN_OBJECT;
+                        }
+                        mState = State::ARRAY_ELEMENT;
+                        return Token::BEGIN_ARRAY;
+                    case '"':
+                        ++mIt;
+                        mValue = readString();
+                        return Token::STRING;
+                    case 't':
+                        readLiteral("true");
+                        mValue = true;
+                        return Token::BOOL;
+                    case 'f':
+                        readLiteral("false");
+                        mValue = false;
+                        return Token::BOOL;
+                    case 'n':
+                        readLiteral("null");
+                        mValue = nullptr;
+                        return Token::NULL_VALUE;
+                    default:
+                        if (c == '-' || isDigit(c)) {
+                            mValue = readNumber();
+                            return Token::NUMBER;
+                        }
+                        unexpectedCharacter();
+                }
+            }
+        }
+    }
+}
+
+AString AJsonReader::readString() {
+    // mScratch holds the string literal with its quotes, which is passed to the buffer parser to decode escape
+    // sequences. Strings without escape sequences are copied directly.
+    mScratch = '"';
+    bool escaped = false;
+    for (;;) {
+        if (!fill()) {
+            unexpectedCharacter();
+        }
+        auto special = aui::impl::json::findQuoteOrBackslash(mIt, mEnd);
+        if (special == mEnd) {
+            mScratch.append(mIt, mEnd);
+            mIt = mEnd;
+            continue;
+        }
+        if (*special == '"') {
+            if (mScratch.size() == 1) {
+                AString result(mIt, special);
+                mIt = special + 1;
+                return result;
+            }
+            mScratch.append(mIt, special + 1);
+            mIt = special + 1;
+            break;
+        }
+        // backslash: the escaped character is copied along with it, so an escaped quote does not end the string.
+        escaped = true;
+        mScratch.append(mIt, special + 1);
+        mIt = special + 1;
+        if (!fill()) {
+            unexpectedCharacter();
+        }
+        mScratch += *mIt++;
+    }
+    if (!escaped) {
+        return AString(mScratch.data() + 1, mScratch.data() + mScratch.size() - 1);
+    }
+    try {
+        auto decoded = aui::impl::json::parseBuffer(mScratch);
+        return std::get<AString>(std::move(static_cast<aui::impl::JsonVariant&>(decoded)));
+    } catch (const AJsonParseException&) {
+        error("invalid escape sequence");
+    }
+}
+
+AJson AJsonReader::readNumber() {
+    mScratch.clear();
+    while (fill() && isNumberCharacter(*mIt)) {
+        mScratch += *mIt++;
+    }
+    try {
+        return aui::impl::json::parseNumber(mScratch);
+    } catch (const AJsonParseException&) {
+        error("invalid number {}"_format(mScratch));
+    }
+}
+
+void AJsonReader::readLiteral(std::string_view literal) {
+    for (char expected : literal) {
+        if (!fill() || *mIt != expected) {
+            unexpectedCharacter();
+        }
+        ++mIt;
+    }
+    if (fill() && isAlnum(*mIt)) {
+        unexpectedCharacter();
+    }
+}
+
+void AJsonReader::skip() {
+    if (mLastToken != Token::BEGIN_OBJECT && mLastToken != Token::BEGIN_ARRAY) {
+        return;
+    }
+    for (std::size_t depth = 1; depth > 0;) {
+        switch (next()) {
+            case Token::BEGIN_OBJECT:
+            case Token::BEGIN_ARRAY:
+                ++depth;
+                break;
+            case Token::END_OBJECT:
+            case Token::END_ARRAY:
+                --depth;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+AJson AJsonReader::readValue() {
+    switch (next()) {
+        case Token::BEGIN_ARRAY: {
+            aui::impl::JsonArray result;
+            while (peek() != Token::END_ARRAY) {
+                result << readValue();
+            }
+            next();
+            return result;
+        }
+        case Token::BEGIN_OBJECT: {
+            aui::impl::JsonObject result;
+            while (next() != Token::END_OBJECT) {
+                auto key = std::move(mKey);
+                result.emplace_back(std::move(key), readValue());
+            }
+            return result;
+        }
+        case Token::STRING:
+        case Token::NUMBER:
+        case Token::BOOL:
+        case Token::NULL_VALUE:
+            return std::move(mValue);
+        default:
+            error("unexpected json token");
+    }
+}
@@ -0,0 +1,187 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <string>
+#include <AUI/Common/SharedPtr.h>
+#include <AUI/IO/IInputStream.h>
+#include "AJson.h"
+
+/**
+ * @brief Streaming (pull) json reader.
+ * @ingroup json
+ * @details
+ * Reads json from an IInputStream token by token without building an AJson tree, so documents of any size can be
+ * processed with constant memory. The stream is read in chunks of BUFFER_SIZE.
+ *
+ * ```cpp
+ * AJsonReader reader(_new<AFileInputStream>("export.json"));
+ * reader.readArray<LogEntry>([&](LogEntry entry) {
+ *     process(entry);
+ * });
+ * ```
+ *
+ * Lower level access is provided by next(): it returns the next token; values of KEY, STRING, NUMBER and BOOL tokens
+ * are available via key() and value(). A subtree can be materialized with readValue() or skipped with skip().
+ *
+ * As AJson::fromString, the reader accepts trailing commas and ignores data after the first json value.
+ */
+class API_AUI_JSON AJsonReader {
+public:
+    static constexpr std::size_t BUFFER_SIZE = 64 * 1024;
+
+    enum class Token {
+        BEGIN_OBJECT,
+        END_OBJECT,
+        BEGIN_ARRAY,
+        END_ARRAY,
+        KEY,
+        STRING,
+        NUMBER,
+        BOOL,
+        NULL_VALUE,
+
+        /**
+         * @brief The root value is read completely.
+         */
+        END,
+    };
+
+    explicit AJsonReader(_<IInputStream> stream);
+
+    /**
+     * @brief Reads the next token.
+     * @throws AJsonParseException
+     */
+    Token next();
+
+    /**
+     * @brief Returns the token next() would return without consuming it.
+     * @throws AJsonParseException
+     */
+    Token peek();
+
+    /**
+     * @brief Object key read by the last KEY token.
+     */
+    [[nodiscard]]
+    const AString& key() const noexcept {
+        return mKey;
+    }
+
+    /**
+     * @brief Value of the last STRING, NUMBER, BOOL or NULL_VALUE token.
+     */
+    [[nodiscard]]
+    const AJson& value() const noexcept {
+        return mValue;
+    }
+
+    /**
+     * @brief Skips the value whose first token was returned by the last next() call. For BEGIN_OBJECT and
+     * BEGIN_ARRAY, skips everything until the matching end token (including). Does nothing for other tokens.
+     */
+    void skip();
+
+    /**
+     * @brief Reads the next value completely.
+     * @throws AJsonParseException
+     */
+    AJson readValue();
+
+    /**
+     * @brief Reads the next value as T, using AJsonConv.
+     */
+    template<typename T>
+    T read() {
+        return aui::from_json<T>(readValue());
+    }
+
+    /**
+     * @brief Reads the next value which is expected to be an array, converting one element at a time.
+     * @param callback called with each element converted to T.
+     */
+    template<typename T, typename Callback>
+    void readArray(Callback&& callback) {
+        expect(Token::BEGIN_ARRAY);
+        while (peek() != Token::END_ARRAY) {
+            callback(read<T>());
+        }
+        next();
+    }
+
+    /**
+     * @brief Reads the next value which is expected to be an object, calling callback for each key. The callback
+     * must consume the key's value, i.e. with readValue(), read<T>() or next() followed by skip().
+     */
+    template<typename Callback>
+    void readObject(Callback&& callback) {
+        expect(Token::BEGIN_OBJECT);
+        while (next() != Token::END_OBJECT) {
+            callback(key());
+        }
+    }
+
+private:
+    enum class State {
+        VALUE,
+        ARRAY_ELEMENT,
+        OBJECT_KEY,
+        AFTER_VALUE,
+    };
+
+    _<IInputStream> mStream;
+    std::string mBuffer;
+    const char* mIt = nullptr;
+    const char* mEnd = nullptr;
+    bool mEof = false;
+
+    /**
+     * @brief Row and the offset of the beginning of current line relative to mBuffer, for error messages. Updated on
+     * each refill.
+     */
+    std::size_t mRow = 1;
+    std::ptrdiff_t mLineBegin = 0;
+
+    AVector<char> mContainers;
+    State mState = State::VALUE;
+    AOptional<Token> mPeeked;
+    Token mLastToken = Token::END;
+
+    AString mKey;
+    AJson mValue;
+    std::string mScratch;
+
+    void expect(Token token);
+    Token readToken();
+
+    /**
+     * @brief Ensures there's at least one character to read.
+     * @return false on end of stream.
+     */
+    bool fill();
+
+    /**
+     * @brief Skips whitespace and returns the next character without consuming it.
+     * @throws AJsonParseException on end of stream.
+     */
+    char peekNonWhitespace();
+
+    AString readString();
+    AJson readNumber();
+    void readLiteral(std::string_view literal);
+
+    [[noreturn]]
+    void error(const AString& message) const;
+    [[noreturn]]
+    void unexpectedCharacter() const;
+};
@@ -0,0 +1,234 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "AJsonWriter.h"
+#include <array>
+#include <charconv>
+#include "AUI/Traits/callables.h"
+
+namespace {
+
+/**
+ * @brief Characters that can be written to a json string literal as is.
+ */
+constexpr auto VERBATIM = [] {
+    std::array<bool, 256> result {};
+    for (int c = 0x20; c < 256; ++c) {
+        result[c] = c != '"' && c != '\\';
+    }
+    return result;
+}();
+
+template<typename Integer>
+void appendInteger(std::string& dst, Integer value) {
+    char buffer[24];
+    auto result = std::to_chars(std::begin(buffer), std::end(buffer), value);
+    dst.append(buffer, result.ptr);
+}
+
+}   // namespace
+
+AJsonWriter::AJsonWriter(_<IOutputStream> stream) : mStream(std::move(stream)) {
+    // the buffer grows on demand: small documents (i.e., AJson::toString) should not pay for a BUFFER_SIZE
+    // allocation. Once flushed, the buffer keeps its capacity for the rest of the stream.
+}
+
+AJsonWriter::~AJsonWriter() {
+    try {
+        flush();
+    } catch (...) {
+        // the stream failed; nothing to report to from a destructor.
+    }
+}
+
+void AJsonWriter::flush() {
+    if (mBuffer.empty()) {
+        return;
+    }
+    mStream->write(mBuffer.data(), mBuffer.size());
+    mBuffer.clear();
+}
+
+void AJsonWriter::flushIfFull() {
+    if (mBuffer.size() >= BUFFER_SIZE) {
+        flush();
+    }
+}
+
+void AJsonWriter::beforeValue() {
+    if (mAfterKey) {
+        mAfterKey = false;
+        return;
+    }
+    if (mHasElements.empty()) {
+        return;
+    }
+    if (mHasElements.back()) {
+        mBuffer += ',';
+    }
+    mHasElements.back() = true;
+}
+
+AJsonWriter& AJsonWriter::beginObject() {
+    beforeValue();
+    mBuffer += '{';
+    mHasElements << false;
+    return *this;
+}
+
+AJsonWriter& AJsonWriter::endObject() {
+    AUI_ASSERTX(!mHasElements.empty() && !mAfterKey, "endObject() does not match beginObject()");
+    mHasElements.pop_back();
+    mBuffer += '}';
+    flushIfFull();
+    return *this;
+}
+
+AJsonWriter& AJsonWriter::beginArray() {
+    beforeValue();
+    mBuffer += '[';
+    mHasElements << false;
+    return *this;
+}
+
+AJsonWriter& AJsonWriter::endArray() {
+    AUI_ASSERTX(!mHasElements.empty() && !mAfterKey, "endArray() does not match beginArray()");
+    mHasElements.pop_back();
+    mBuffer += ']';
+    flushIfFull();
+    return *this;
+}
+
+AJsonWriter& AJsonWriter::key(std::string_view key) {
+    AUI_ASSERTX(!mHasElements.empty() && !mAfterKey, "key() is allowed in objects only");
+    beforeValue();
+    appendEscaped(mBuffer, key);
+    mBuffer += ':';
+    mAfterKey = true;
+    return *this;
+}
+
+AJsonWriter& AJsonWriter::value(std::nullptr_t) {
+    beforeValue();
+    mBuffer += "null";
+    flushIfFull();
+    return *this;
+}
+
+AJsonWriter& AJsonWriter::value(bool value) {
+    beforeValue();
+    mBuffer += value ? "true" : "false";
+    flushIfFull();
+    return *this;
+}
+
+AJsonWriter& AJsonWriter::value(int value) {
+    beforeValue();
+    appendInteger(mBuffer, value);
+    flushIfFull();
+    return *this;
+}
+
+AJsonWriter& AJsonWriter::value(std::int64_t value) {
+    beforeValue();
+    appendInteger(mBuffer, value);
+    flushIfFull();
+    return *this;
+}
+
+AJsonWriter& AJsonWriter::value(double value) {
+    beforeValue();
+    // same representation as AJson::toString had before
+    mBuffer += AString::number(value);
+    flushIfFull();
+    return *this;
+}
+
+AJsonWriter& AJsonWriter::value(std::string_view value) {
+    beforeValue();
+    appendEscaped(mBuffer, value);
+    flushIfFull();
+    return *this;
+}
+
+AJsonWriter& AJsonWriter::value(const AJson& value) {
+    std::visit(aui::lambda_overloaded {
+        [&](const auto& v) {
+            this->value(v);
+        },
+        [&](const aui::impl::JsonArray& v) {
+            beginArray();
+            for (const auto& element : v) {
+                this->value(element);
+            }
+            endArray();
+        },
+        [&](const aui::impl::JsonObject& v) {
+            beginObject();
+            for (const auto& [k, element] : v) {
+                key(k);
+                this->value(element);
+            }
+            endObject();
+        },
+        [&](std::nullopt_t) {
+            // empty value
+        },
+    }, static_cast<const aui::impl::JsonVariant&>(value));
+    return *this;
+}
+
+void AJsonWriter::appendEscaped(std::string& dst, std::string_view str) {
+    dst += '"';
+    auto it = str.begin();
+    const auto end = str.end();
+    while (it != end) {
+        auto verbatimEnd = it;
+        while (verbatimEnd != end && VERBATIM[static_cast<std::uint8_t>(*verbatimEnd)]) {
+            ++verbatimEnd;
+        }
+        dst.append(it, verbatimEnd);
+        if (verbatimEnd == end) {
+            break;
+        }
+        switch (const char c = *verbatimEnd) {
+            case '"':
+                dst += "\\\"";
+                break;
+            case '\\':
+                dst += "\\\\";
+                break;
+            case '\n':
+                dst += "\\n";
+                break;
+            case '\r':
+                dst += "\\r";
+                break;
+            case '\t':
+                dst += "\\t";
+                break;
+            case '\b':
+                dst += "\\b";
+                break;
+            case '\f':
+                dst += "\\f";
+                break;
+            default: {
+                constexpr char HEX[] = "0123456789abcdef";
+                dst += "\\u00";
+                dst += HEX[(c >> 4) & 0xF];
+                dst += HEX[c & 0xF];
+            }
+        }
+        it = verbatimEnd + 1;
+    }
+    dst += '"';
+}
@@ -0,0 +1,117 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <AUI/Common/SharedPtr.h>
+#include <AUI/IO/IOutputStream.h>
+#include "AJson.h"
+
+/**
+ * @brief Streaming json writer.
+ * @ingroup json
+ * @details
+ * Writes json tokens straight to an IOutputStream without building an AJson tree. Commas between elements are placed
+ * automatically; strings are escaped in a single pass into an internal buffer which is flushed to the stream once it
+ * grows past BUFFER_SIZE, in flush() and in the destructor.
+ *
+ * ```cpp
+ * AJsonWriter writer(_new<AFileOutputStream>("export.json"));
+ * writer.beginArray();
+ * for (const auto& entry : entries) {
+ *     writer.write(entry); // any type with AJsonConv
+ * }
+ * writer.endArray();
+ * ```
+ *
+ * Reflected values passed to write() are converted with aui::to_json one at a time, so memory usage does not depend
+ * on the count of values written.
+ */
+class API_AUI_JSON AJsonWriter {
+public:
+    static constexpr std::size_t BUFFER_SIZE = 64 * 1024;
+
+    explicit AJsonWriter(_<IOutputStream> stream);
+    ~AJsonWriter();
+
+    AJsonWriter(const AJsonWriter&) = delete;
+    AJsonWriter& operator=(const AJsonWriter&) = delete;
+
+    AJsonWriter& beginObject();
+    AJsonWriter& endObject();
+    AJsonWriter& beginArray();
+    AJsonWriter& endArray();
+
+    /**
+     * @brief Writes object key. Must be followed by a value.
+     */
+    AJsonWriter& key(std::string_view key);
+
+    AJsonWriter& value(std::nullptr_t);
+    AJsonWriter& value(bool value);
+    AJsonWriter& value(int value);
+    AJsonWriter& value(std::int64_t value);
+    AJsonWriter& value(double value);
+    AJsonWriter& value(std::string_view value);
+    AJsonWriter& value(const char* value) { return this->value(std::string_view(value)); }
+    AJsonWriter& value(const AString& value) { return this->value(std::string_view(value)); }
+
+    /**
+     * @brief Writes json tree.
+     */
+    AJsonWriter& value(const AJson& value);
+
+    /**
+     * @brief Writes a value of any type having AJsonConv.
+     */
+    template<typename T>
+    AJsonWriter& write(const T& value) {
+        static_assert(aui::has_json_converter<T>, "this type does not implement AJsonConv<T> trait");
+        return this->value(aui::to_json(value));
+    }
+
+    /**
+     * @brief Writes a range as json array, converting one element at a time.
+     */
+    template<typename Range>
+    AJsonWriter& writeArray(const Range& range) {
+        beginArray();
+        for (const auto& element : range) {
+            write(element);
+        }
+        return endArray();
+    }
+
+    /**
+     * @brief Passes the buffered output to the stream.
+     */
+    void flush();
+
+    /**
+     * @brief Appends json string literal of str (including quotes) to dst.
+     */
+    static void appendEscaped(std::string& dst, std::string_view str);
+
+private:
+    _<IOutputStream> mStream;
+    std::string mBuffer;
+
+    /**
+     * @brief For each open container, whether an element has been written to it already.
+     */
+    AVector<bool> mHasElements;
+    bool mAfterKey = false;
+
+    void beforeValue();
+    void flushIfFull();
+};
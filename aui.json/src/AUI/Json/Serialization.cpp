@@ -14,7 +14,7 @@
 #include "AUI/Util/ATokenizer.h"
 #include "AJson.h"
 #include "Serialization.h"
-#include "AUI/Traits/callables.h"
+#include "AJsonWriter.h"
 
 
 static AJson read(ATokenizer& t) {
@@ -154,53 +154,7 @@ static AJson read(ATokenizer& t) {
 
 
 void ASerializable<AJson>::write(IOutputStream& os, const AJson& value) {
-    std::visit(aui::lambda_overloaded {
-        [&](int v) {
-            os << AString::number(v);
-        },
-        [&](int64_t v) {
-            os << AString::number(v);
-        },
-        [&](double v) {
-            os << AString::number(v);
-        },
-        [&](bool v) {
-            os << (v ? "true" : "false");
-        },
-        [&](const AString& v) {
-            os << '"' << v.replacedAll("\\", "\\\\")
-                .replacedAll("\"", "\\\"")
-                .replacedAll("\r\n", "\\n")
-                .replacedAll("\n", "\\n")
-                .replacedAll("\t", "\\t") << '"';
-        },
-        [&](std::nullptr_t) {
-            os << "null";
-        },
-        [&](const aui::impl::JsonArray& v) {
-            os << '[';
-            for (auto it = v.begin(); it != v.end(); ++it) {
-                if (it != v.begin()) {
-                    os << ',';
-                }
-                os << *it;
-            }
-            os << ']';
-        },
-        [&](const aui::impl::JsonObject & v) {
-            os << '{';
-            for (auto it = v.begin(); it != v.end(); ++it) {
-                if (it != v.begin()) {
-                    os << ',';
-                }
-                os << '"' << it->first.replacedAll("\"", "\\\"") << "\":" << it->second;
-            }
-            os << '}';
-        },
-        [&](std::nullopt_t) {
-            // empty value
-        },
-    }, static_cast<const aui::impl::JsonVariant&>(value));
+    AJsonWriter(aui::ptr::fake_shared(&os)).value(value);
 }
 
 void ASerializable<AJson>::read(IInputStream& is, AJson& dst) {
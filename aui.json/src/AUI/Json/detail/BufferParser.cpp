@@ -0,0 +1,500 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "BufferParser.h"
+#include <AUI/Json/AJson.h>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <sstream>
+
+#if AUI_ARCH_X86_64
+#include <emmintrin.h>
+#elif AUI_ARCH_ARM_64
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+using aui::impl::json::findQuoteOrBackslash;
+
+constexpr std::size_t MAX_DEPTH = 1024;
+
+constexpr auto WHITESPACE = [] {
+    std::array<bool, 256> result {};
+    result[' '] = result['\t'] = result['\n'] = result['\r'] = true;
+    return result;
+}();
+
+/**
+ * @brief Powers of 10 exactly representable as double.
+ */
+constexpr double EXACT_POWERS_OF_10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+bool isDigit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+bool isAlnum(char c) noexcept { return isDigit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+
+void appendUtf8(std::string& out, char32_t codepoint) {
+    if (codepoint <= 0x7F) {
+        out += static_cast<char>(codepoint);
+    } else if (codepoint <= 0x7FF) {
+        out += static_cast<char>(0xC0 | (codepoint >> 6));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    } else if (codepoint <= 0xFFFF) {
+        out += static_cast<char>(0xE0 | (codepoint >> 12));
+        out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (codepoint >> 18));
+        out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    }
+}
+
+class Parser {
+public:
+    explicit Parser(std::string_view buffer)
+      : mBegin(buffer.data()), mIt(buffer.data()), mEnd(buffer.data() + buffer.size()) {}
+
+    AJson parse() {
+        skipWhitespace();
+        return parseValue(0);
+    }
+
+    AJson parseWholeNumber() {
+        if (mIt == mEnd) {
+            unexpectedCharacter();
+        }
+        auto result = parseNumber();
+        if (mIt != mEnd) {
+            unexpectedCharacter();
+        }
+        return result;
+    }
+
+private:
+    const char* const mBegin;
+    const char* mIt;
+    const char* const mEnd;
+
+    [[noreturn]]
+    void error(const AString& message) const {
+        std::size_t row = 1;
+        auto lineBegin = mBegin;
+        for (auto it = mBegin; it != mIt; ++it) {
+            if (*it == '\n') {
+                ++row;
+                lineBegin = it + 1;
+            }
+        }
+        throw AJsonParseException("{} at {}:{}"_format(message, row, mIt - lineBegin + 1));
+    }
+
+    [[noreturn]]
+    void unexpectedCharacter() const {
+        if (mIt == mEnd) {
+            throw AJsonParseException("unexpected end of json stream");
+        }
+        error("unexpected character {}"_format(*mIt));
+    }
+
+    void skipWhitespace() noexcept {
+        while (mIt != mEnd && WHITESPACE[static_cast<std::uint8_t>(*mIt)]) {
+            ++mIt;
+        }
+    }
+
+    AJson parseValue(std::size_t depth) {
+        if (mIt == mEnd) {
+            unexpectedCharacter();
+        }
+        switch (*mIt) {
+            case '{':
+                return parseObject(depth + 1);
+            case '[':
+                return parseArray(depth + 1);
+            case '"':
+                ++mIt;
+                return parseString();
+            case 't':
+                return parseLiteral("true", true);
+            case 'f':
+                return parseLiteral("false", false);
+            case 'n':
+                return parseLiteral("null", nullptr);
+            default:
+                if (*mIt == '-' || isDigit(*mIt)) {
+                    return parseNumber();
+                }
+                unexpectedCharacter();
+        }
+    }
+
+    AJson parseLiteral(std::string_view literal, AJson value) {
+        if (std::size_t(mEnd - mIt) >= literal.size() && std::memcmp(mIt, literal.data(), literal.size()) == 0 &&
+            (mIt + literal.size() == mEnd || !isAlnum(mIt[literal.size()]))) {
+            mIt += literal.size();
+            return value;
+        }
+        auto tokenEnd = mIt;
+        while (tokenEnd != mEnd && isAlnum(*tokenEnd)) {
+            ++tokenEnd;
+        }
+        error("unexpected token {}"_format(std::string_view(mIt, tokenEnd - mIt)));
+    }
+
+    void checkDepth(std::size_t depth) const {
+        if (depth > MAX_DEPTH) {
+            error("json is nested too deeply");
+        }
+    }
+
+    AJson parseArray(std::size_t depth) {
+        checkDepth(depth);
+        ++mIt;   // [
+        aui::impl::JsonArray result;
+        skipWhitespace();
+        if (mIt != mEnd && *mIt == ']') {
+            ++mIt;
+            return result;
+        }
+        for (;;) {
+            result << parseValue(depth);
+            skipWhitespace();
+            if (mIt == mEnd) {
+                unexpectedCharacter();
+            }
+            if (*mIt == ',') {
+                ++mIt;
+                skipWhitespace();
+                if (mIt != mEnd && *mIt == ']') {
+                    // trailing comma; accepted by the stream parser as well.
+                    ++mIt;
+                    return result;
+                }
+                continue;
+            }
+            if (*mIt == ']') {
+                ++mIt;
+                return result;
+            }
+            unexpectedCharacter();
+        }
+    }
+
+    AJson parseObject(std::size_t depth) {
+        checkDepth(depth);
+        ++mIt;   // {
+        aui::impl::JsonObject result;
+        skipWhitespace();
+        if (mIt != mEnd && *mIt == '}') {
+            ++mIt;
+            return result;
+        }
+        for (;;) {
+            if (mIt == mEnd || *mIt != '"') {
+                unexpectedCharacter();
+            }
+            ++mIt;
+            auto key = parseString();
+            skipWhitespace();
+            if (mIt == mEnd || *mIt != ':') {
+                unexpectedCharacter();
+            }
+            ++mIt;
+            skipWhitespace();
+            result.emplace_back(std::move(key), parseValue(depth));
+            skipWhitespace();
+            if (mIt == mEnd) {
+                unexpectedCharacter();
+            }
+            if (*mIt == ',') {
+                ++mIt;
+                skipWhitespace();
+                if (mIt != mEnd && *mIt == '}') {
+                    // trailing comma; accepted by the stream parser as well.
+                    ++mIt;
+                    return result;
+                }
+                continue;
+            }
+            if (*mIt == '}') {
+                ++mIt;
+                return result;
+            }
+            unexpectedCharacter();
+        }
+    }
+
+    /**
+     * @brief Parses string body; mIt points right after the opening quote.
+     */
+    AString parseString() {
+        auto special = findQuoteOrBackslash(mIt, mEnd);
+        if (special != mEnd && *special == '"') {
+            // no escape sequences: a single copy.
+            AString result(mIt, special);
+            mIt = special + 1;
+            return result;
+        }
+
+        std::string result;
+        result.reserve(special - mIt + 16);
+        for (;;) {
+            result.append(mIt, special);
+            mIt = special;
+            if (mIt == mEnd) {
+                unexpectedCharacter();
+            }
+            if (*mIt == '"') {
+                ++mIt;
+                return AString(std::move(result));
+            }
+            ++mIt;   // backslash
+            if (mIt == mEnd) {
+                unexpectedCharacter();
+            }
+            switch (*mIt++) {
+                case '"':
+                    result += '"';
+                    break;
+                case '\\':
+                    result += '\\';
+                    break;
+                case '/':
+                    result += '/';
+                    break;
+                case 'b':
+                    result += '\b';
+                    break;
+                case 'f':
+                    result += '\f';
+                    break;
+                case 'n':
+                    result += '\n';
+                    break;
+                case 'r':
+                    result += '\r';
+                    break;
+                case 't':
+                    result += '\t';
+                    break;
+                case 'u':
+                    parseUnicodeEscape(result);
+                    break;
+                default:
+                    --mIt;
+                    error("invalid escape sequence");
+            }
+            special = findQuoteOrBackslash(mIt, mEnd);
+        }
+    }
+
+    char32_t parseHex4() {
+        if (mEnd - mIt < 4) {
+            mIt = mEnd;
+            unexpectedCharacter();
+        }
+        char32_t result = 0;
+        for (int i = 0; i < 4; ++i, ++mIt) {
+            const char c = *mIt;
+            int digit;
+            if (c >= '0' && c <= '9') {
+                digit = c - '0';
+            } else if (c >= 'a' && c <= 'f') {
+                digit = c - 'a' + 10;
+            } else if (c >= 'A' && c <= 'F') {
+                digit = c - 'A' + 10;
+            } else {
+                error("invalid unicode escape sequence");
+            }
+            result = (result << 4) | char32_t(digit);
+        }
+        return result;
+    }
+
+    void parseUnicodeEscape(std::string& out) {
+        auto codepoint = parseHex4();
+        if (codepoint >= 0xD800 && codepoint <= 0xDBFF && mEnd - mIt >= 6 && mIt[0] == '\\' && mIt[1] == 'u') {
+            const auto afterHigh = mIt;
+            mIt += 2;
+            const auto low = parseHex4();
+            if (low >= 0xDC00 && low <= 0xDFFF) {
+                codepoint = 0x10000 + ((codepoint & 0x3FF) << 10) + (low & 0x3FF);
+            } else {
+                // not a pair; the second escape is parsed on its own.
+                mIt = afterHigh;
+            }
+        }
+        if (codepoint >= 0xD800 && codepoint <= 0xDFFF) {
+            // lone surrogate
+            codepoint = 0xFFFD;
+        }
+        appendUtf8(out, codepoint);
+    }
+
+    AJson parseNumber() {
+        const auto begin = mIt;
+        const bool negative = *mIt == '-';
+        if (negative) {
+            ++mIt;
+        }
+        if (mIt == mEnd || !isDigit(*mIt)) {
+            unexpectedCharacter();
+        }
+
+        // significant digits are accumulated in mantissa; the value is mantissa * 10^exponent.
+        std::uint64_t mantissa = 0;
+        bool mantissaOverflow = false;
+        std::int64_t exponent = 0;
+        auto accumulate = [&](char c) {
+            if (mantissa > (std::numeric_limits<std::uint64_t>::max() - 9) / 10) {
+                mantissaOverflow = true;
+                return false;
+            }
+            mantissa = mantissa * 10 + std::uint64_t(c - '0');
+            return true;
+        };
+
+        for (; mIt != mEnd && isDigit(*mIt); ++mIt) {
+            if (!accumulate(*mIt)) {
+                ++exponent;
+            }
+        }
+        bool isFloatingPoint = false;
+        if (mIt != mEnd && *mIt == '.') {
+            isFloatingPoint = true;
+            ++mIt;
+            if (mIt == mEnd || !isDigit(*mIt)) {
+                unexpectedCharacter();
+            }
+            for (; mIt != mEnd && isDigit(*mIt); ++mIt) {
+                if (accumulate(*mIt)) {
+                    --exponent;
+                }
+            }
+        }
+        if (mIt != mEnd && (*mIt == 'e' || *mIt == 'E')) {
+            isFloatingPoint = true;
+            ++mIt;
+            bool negativeExponent = false;
+            if (mIt != mEnd && (*mIt == '-' || *mIt == '+')) {
+                negativeExponent = *mIt == '-';
+                ++mIt;
+            }
+            if (mIt == mEnd || !isDigit(*mIt)) {
+                unexpectedCharacter();
+            }
+            std::int64_t explicitExponent = 0;
+            for (; mIt != mEnd && isDigit(*mIt); ++mIt) {
+                if (explicitExponent < 100'000) {
+                    explicitExponent = explicitExponent * 10 + (*mIt - '0');
+                }
+            }
+            exponent += negativeExponent ? -explicitExponent : explicitExponent;
+        }
+
+        if (!isFloatingPoint) {
+            std::int64_t value;
+            if (!mantissaOverflow && mantissa <= std::uint64_t(std::numeric_limits<std::int64_t>::max())) {
+                value = negative ? -std::int64_t(mantissa) : std::int64_t(mantissa);
+            } else if (std::from_chars(begin, mIt, value).ec != std::errc {}) {
+                // does not fit in int64
+                return parseDouble(begin, mIt, exponent > 0);
+            }
+            if (value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max()) {
+                return int(value);
+            }
+            return value;
+        }
+
+        // Clinger's fast path: both mantissa and the power of 10 are exact doubles, so a single multiplication or
+        // division is correctly rounded.
+        if (!mantissaOverflow && mantissa <= (std::uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+            auto value = double(mantissa);
+            value = exponent < 0 ? value / EXACT_POWERS_OF_10[-exponent] : value * EXACT_POWERS_OF_10[exponent];
+            return negative ? -value : value;
+        }
+        return parseDouble(begin, mIt, exponent > 0);
+    }
+
+    /**
+     * @brief Correctly rounded conversion of a number literal that does not fit the fast path.
+     */
+    static double parseDouble(const char* begin, const char* end, bool positiveExponent) {
+        const bool negative = *begin == '-';
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        double value = 0.0;
+        if (std::from_chars(begin, end, value).ec == std::errc::result_out_of_range) {
+            value = positiveExponent ? std::numeric_limits<double>::infinity() : 0.0;
+            return negative ? -value : value;
+        }
+        return value;
+#else
+        // floating point std::from_chars is unavailable; stringstream is slower but locale independent too.
+        std::istringstream stream(std::string(begin, end));
+        stream.imbue(std::locale::classic());
+        double value = 0.0;
+        stream >> value;
+        return value;
+#endif
+    }
+};
+
+}   // namespace
+
+const char* aui::impl::json::findQuoteOrBackslash(const char* begin, const char* end) noexcept {
+    auto it = begin;
+#if AUI_ARCH_X86_64
+    const auto quote = _mm_set1_epi8('"');
+    const auto backslash = _mm_set1_epi8('\\');
+    for (; end - it >= 16; it += 16) {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        const auto mask = unsigned(
+            _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash))));
+        if (mask != 0) {
+            return it + std::countr_zero(mask);
+        }
+    }
+#elif AUI_ARCH_ARM_64
+    const auto quote = vdupq_n_u8('"');
+    const auto backslash = vdupq_n_u8('\\');
+    for (; end - it >= 16; it += 16) {
+        const auto chunk = vld1q_u8(reinterpret_cast<const std::uint8_t*>(it));
+        if (vmaxvq_u8(vorrq_u8(vceqq_u8(chunk, quote), vceqq_u8(chunk, backslash))) != 0) {
+            // the exact position is found by the loop below.
+            break;
+        }
+    }
+#endif
+    for (; it != end; ++it) {
+        if (*it == '"' || *it == '\\') {
+            return it;
+        }
+    }
+    return end;
+}
+
+AJson aui::impl::json::parseBuffer(std::string_view buffer) {
+    return Parser(buffer).parse();
+}
+
+AJson aui::impl::json::parseNumber(std::string_view literal) {
+    return Parser(literal).parseWholeNumber();
+}
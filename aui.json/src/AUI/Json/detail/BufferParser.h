@@ -0,0 +1,46 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <string_view>
+
+class AJson;
+
+namespace aui::impl::json {
+
+/**
+ * @brief Parses json from a contiguous UTF-8 buffer.
+ * @details
+ * Fast path of AJson::fromBuffer and AJson::fromString. Unlike the ATokenizer-based parser used for streams, it works
+ * on the whole buffer at once: strings are scanned with SIMD and copied in bulk, numbers are parsed without precision
+ * loss.
+ *
+ * Data after the first json value is ignored.
+ *
+ * @throws AJsonParseException
+ */
+AJson parseBuffer(std::string_view buffer);
+
+/**
+ * @brief Parses a json number literal occupying the whole string.
+ * @return int, int64_t or double json value.
+ * @throws AJsonParseException
+ */
+AJson parseNumber(std::string_view literal);
+
+/**
+ * @brief Finds the first `"` or `\` in [begin, end), 16 bytes at a time.
+ * @return pointer to the character found or end.
+ */
+const char* findQuoteOrBackslash(const char* begin, const char* end) noexcept;
+
+}   // namespace aui::impl::json
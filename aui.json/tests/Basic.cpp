@@ -16,6 +16,9 @@
 #include <gtest/gtest.h>
 #include <AUI/Common/AString.h>
 #include <AUI/Json/AJson.h>
+#include <AUI/IO/AByteBufferInputStream.h>
+#include <atomic>
+#include <thread>
 #include <AUI/Json/AJson.h>
 
 
@@ -201,3 +204,140 @@ TEST(Json, Utf8Sequence2)
     EXPECT_EQ(v.asArray()[0].asString(), "🤡");
 }
 
+
+TEST(Json, DoublePrecision)
+{
+    auto v = AJson::fromString(R"([0.1, 2.2250738585072014e-308, 1.7976931348623157e308, 123456789012345678901234567890, 9007199254740993.0])");
+    EXPECT_EQ(v[0].asNumber(), 0.1);
+    EXPECT_EQ(v[1].asNumber(), 2.2250738585072014e-308);
+    EXPECT_EQ(v[2].asNumber(), 1.7976931348623157e308);
+    EXPECT_EQ(v[3].asNumber(), 123456789012345678901234567890.0);
+    EXPECT_EQ(v[4].asNumber(), 9007199254740993.0);
+}
+
+TEST(Json, IntegerTypes)
+{
+    auto v = AJson::fromString(R"([2147483647, 2147483648, -9223372036854775808, 9223372036854775808])");
+    EXPECT_TRUE(v[0].isInt());
+    EXPECT_EQ(v[1].asLongInt(), 2147483648);
+    EXPECT_EQ(v[2].asLongInt(), std::numeric_limits<int64_t>::min());
+    EXPECT_EQ(v[3].asNumber(), 9223372036854775808.0);
+}
+
+TEST(Json, StringEscapes)
+{
+    auto v = AJson::fromString(R"(["a\"b\\c\/d\n\t\r\b\f", "a long string without any escape sequences at all", "é\ud800x"])");
+    EXPECT_EQ(v[0].asString(), "a\"b\\c/d\n\t\r\b\f");
+    EXPECT_EQ(v[1].asString(), "a long string without any escape sequences at all");
+    EXPECT_EQ(v[2].asString(), "é\xEF\xBF\xBDx");
+}
+
+TEST(Json, BufferAndStreamParsersAgree)
+{
+    std::string_view str = R"({"a" : [1, -2.5e3, "x\ty", {"b": null, "c": [true, false]}], "d": {}, "e": []})";
+    auto fromBuffer = AJson::fromBuffer(AByteBufferView(str));
+    auto fromStream = AJson::fromStream(AByteBufferInputStream(AByteBufferView(str)));
+    EXPECT_EQ(AJson::toString(fromBuffer), AJson::toString(fromStream));
+}
+
+TEST(Json, TooDeep)
+{
+    EXPECT_THROW(AJson::fromString(AString(100000, '[')), AJsonParseException);
+}
+
+TEST(Json, WideObjectLookup)
+{
+    AJson::Object object;
+    for (int i = 0; i < 100; ++i) {
+        object["key{}"_format(i)] = i;
+    }
+    object.emplace_back("key0", AJson(-1));   // duplicate: lookup returns the first occurrence
+    const auto& constObject = object;
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_NE(constObject.contains("key{}"_format(i)), nullptr);
+        EXPECT_EQ(constObject.at("key{}"_format(i)).asInt(), i);
+    }
+    EXPECT_EQ(constObject.contains("missing"), nullptr);
+    EXPECT_EQ((constObject.begin() + 42)->first, "key42");   // insertion order is kept
+
+    object.erase(object.begin() + 10);
+    object.insert(object.begin(), std::make_pair(AString("front"), AJson(true)));
+    EXPECT_EQ(object.contains("key10"), nullptr);
+    EXPECT_EQ(object.at("key11").asInt(), 11);
+    EXPECT_TRUE(object.at("front").asBool());
+    EXPECT_EQ(constObject.at("key99").asInt(), 99);
+
+    for (auto& [key, value] : object) {
+        if (key == "key50") {
+            key = "renamed";
+        }
+    }
+    EXPECT_EQ(object.contains("key50"), nullptr);
+    EXPECT_EQ(object.at("renamed").asInt(), 50);
+}
+
+TEST(Json, WideObjectParsed)
+{
+    AString str = "{";
+    for (int i = 0; i < 100; ++i) {
+        str += "\"key{}\": {},"_format(i, i);
+    }
+    str += "\"key0\": -1}";
+    const auto json = AJson::fromString(str);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(json["key{}"_format(i)].asInt(), i);
+    }
+}
+
+TEST(Json, WideObjectSameSizeMutation)
+{
+    AJson::Object object;
+    for (int i = 0; i < 100; ++i) {
+        object["key{}"_format(i)] = i;
+    }
+    EXPECT_EQ(object.at("key20").asInt(), 20);   // builds the index
+
+    // size is unchanged by each of the mutations below; the index must be dropped anyway.
+    object.removeAt(10);
+    object.push_back({ "added", AJson(-1) });
+    EXPECT_EQ(object.contains("key10"), nullptr);
+    EXPECT_EQ(object.at("key20").asInt(), 20);
+    EXPECT_EQ(object.at("added").asInt(), -1);
+
+    object.sort([](const auto& l, const auto& r) { return l.first > r.first; });
+    for (int i = 11; i < 100; ++i) {
+        EXPECT_EQ(object.at("key{}"_format(i)).asInt(), i);
+    }
+
+    object.first().first = "renamed";
+    EXPECT_EQ(object.at("renamed").asInt(), 99);   // "key99" is the greatest key
+    EXPECT_EQ(object.contains("key99"), nullptr);
+}
+
+TEST(Json, WideObjectConcurrentConstLookups)
+{
+    AJson::Object object;
+    for (int i = 0; i < 200; ++i) {
+        object["key{}"_format(i)] = i;
+    }
+    for (auto& [key, value] : object) {}   // drops the index, so the readers find it stale
+
+    const auto& constObject = object;
+    std::atomic_int mismatches = 0;
+    AVector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers << std::thread([&] {
+            for (int pass = 0; pass < 10; ++pass) {
+                for (int i = 0; i < 200; ++i) {
+                    if (constObject.at("key{}"_format(i)).asInt() != i) {
+                        ++mismatches;
+                    }
+                }
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(mismatches, 0);
+}
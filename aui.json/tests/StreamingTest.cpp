@@ -0,0 +1,150 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+#include <AUI/Common/AByteBuffer.h>
+#include <AUI/IO/AByteBufferInputStream.h>
+#include <AUI/Json/AJson.h>
+#include <AUI/Json/AJsonReader.h>
+#include <AUI/Json/AJsonWriter.h>
+
+namespace {
+
+/**
+ * Returns one byte per read() call, so every token crosses a buffer boundary.
+ */
+class ByteByByteInputStream : public IInputStream {
+public:
+    explicit ByteByByteInputStream(std::string data) : mData(std::move(data)) {}
+
+    size_t read(char* dst, size_t size) override {
+        if (mPosition == mData.size() || size == 0) {
+            return 0;
+        }
+        *dst = mData[mPosition++];
+        return 1;
+    }
+
+private:
+    std::string mData;
+    std::size_t mPosition = 0;
+};
+
+struct Entry {
+    int id;
+    AString message;
+
+    bool operator==(const Entry&) const = default;
+};
+
+}   // namespace
+
+AJSON_FIELDS(Entry,
+        (id, "id")
+        (message, "message")
+)
+
+TEST(JsonStreaming, Tokens)
+{
+    using Token = AJsonReader::Token;
+    AJsonReader reader(_new<ByteByByteInputStream>(R"( {"a": [1, -2.5e3, "x\ty", true, null], "b\"": {}, "c": [],} )"));
+    EXPECT_EQ(reader.next(), Token::BEGIN_OBJECT);
+    EXPECT_EQ(reader.next(), Token::KEY);
+    EXPECT_EQ(reader.key(), "a");
+    EXPECT_EQ(reader.next(), Token::BEGIN_ARRAY);
+    EXPECT_EQ(reader.next(), Token::NUMBER);
+    EXPECT_EQ(reader.value().asInt(), 1);
+    EXPECT_EQ(reader.next(), Token::NUMBER);
+    EXPECT_EQ(reader.value().asNumber(), -2500.0);
+    EXPECT_EQ(reader.next(), Token::STRING);
+    EXPECT_EQ(reader.value().asString(), "x\ty");
+    EXPECT_EQ(reader.next(), Token::BOOL);
+    EXPECT_TRUE(reader.value().asBool());
+    EXPECT_EQ(reader.next(), Token::NULL_VALUE);
+    EXPECT_EQ(reader.next(), Token::END_ARRAY);
+    EXPECT_EQ(reader.next(), Token::KEY);
+    EXPECT_EQ(reader.key(), "b\"");
+    EXPECT_EQ(reader.next(), Token::BEGIN_OBJECT);
+    EXPECT_EQ(reader.next(), Token::END_OBJECT);
+    EXPECT_EQ(reader.next(), Token::KEY);
+    EXPECT_EQ(reader.peek(), Token::BEGIN_ARRAY);
+    EXPECT_EQ(reader.next(), Token::BEGIN_ARRAY);
+    EXPECT_EQ(reader.next(), Token::END_ARRAY);
+    EXPECT_EQ(reader.next(), Token::END_OBJECT);
+    EXPECT_EQ(reader.next(), Token::END);
+}
+
+TEST(JsonStreaming, ReadValueAndSkip)
+{
+    std::string_view str = R"({"skipped": {"a": [1, [2, {"b": 3}]]}, "kept": {"x": [1, 2, "3"]}})";
+    AJsonReader reader(_new<ByteByByteInputStream>(std::string(str)));
+    AVector<AString> keys;
+    AJson kept;
+    reader.readObject([&](const AString& key) {
+        keys << key;
+        if (key == "kept") {
+            kept = reader.readValue();
+        } else {
+            reader.next();
+            reader.skip();
+        }
+    });
+    EXPECT_EQ(keys, (AVector<AString>{ "skipped", "kept" }));
+    EXPECT_EQ(AJson::toString(kept), R"({"x":[1,2,"3"]})");
+}
+
+TEST(JsonStreaming, Errors)
+{
+    EXPECT_THROW(AJsonReader(_new<ByteByByteInputStream>("[1, 2")).readValue(), AJsonParseException);
+    EXPECT_THROW(AJsonReader(_new<ByteByByteInputStream>("[1 2]")).readValue(), AJsonParseException);
+    EXPECT_THROW(AJsonReader(_new<ByteByByteInputStream>("{\"a\" 1}")).readValue(), AJsonParseException);
+    EXPECT_THROW(AJsonReader(_new<ByteByByteInputStream>("[1.]")).readValue(), AJsonParseException);
+    EXPECT_THROW(AJsonReader(_new<ByteByByteInputStream>("[truex]")).readValue(), AJsonParseException);
+    EXPECT_THROW(AJsonReader(_new<ByteByByteInputStream>(std::string(100000, '['))).readValue(), AJsonParseException);
+    try {
+        AJsonReader(_new<ByteByByteInputStream>("[\n  1,\n  x]")).readValue();
+        FAIL();
+    } catch (const AJsonParseException& e) {
+        EXPECT_EQ(e.getMessage(), "unexpected character x at 3:3");
+    }
+}
+
+TEST(JsonStreaming, WriterEscapes)
+{
+    AByteBuffer buffer;
+    {
+        AJsonWriter writer(aui::ptr::fake_shared(&buffer));
+        writer.beginObject();
+        writer.key("k\"ey").value("a\"b\\c\r\n\t\x01");
+        writer.key("list").beginArray().value(1).value(std::int64_t(1) << 40).value(0.5).value(true).value(nullptr).endArray();
+        writer.key("empty").beginObject().endObject();
+        writer.endObject();
+    }
+    auto str = AString::fromUtf8(buffer);
+    EXPECT_EQ(str, R"({"k\"ey":"a\"b\\c\r\n\t\u0001","list":[1,1099511627776,0.5,true,null],"empty":{}})");
+    EXPECT_EQ(AJson::fromString(str)["k\"ey"].asString(), "a\"b\\c\r\n\t\x01");
+}
+
+TEST(JsonStreaming, ReflectedArrayRoundTrip)
+{
+    AVector<Entry> entries;
+    for (int i = 0; i < 1000; ++i) {
+        entries << Entry{ i, "entry \"{}\"\n"_format(i) };
+    }
+    AByteBuffer buffer;
+    AJsonWriter(aui::ptr::fake_shared(&buffer)).writeArray(entries);
+
+    AVector<Entry> read;
+    AJsonReader reader(_new<AByteBufferInputStream>(buffer));
+    reader.readArray<Entry>([&](Entry entry) { read << std::move(entry); });
+    EXPECT_EQ(read, entries);
+    EXPECT_EQ(reader.next(), AJsonReader::Token::END);
+}
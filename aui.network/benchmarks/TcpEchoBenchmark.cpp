@@ -0,0 +1,190 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+#include <AUI/Network/ATcpServerSocket.h>
+#include <AUI/Network/ATcpSocket.h>
+#include <AUI/Thread/AAsyncHolder.h>
+#include <AUI/Thread/AEventLoop.h>
+
+// Loopback echo over asynchronous sockets: connections/sec, throughput of a single connection and round trips/sec of
+// many concurrent connections (up to 10k) served by a single IO thread.
+//
+// Run:
+// Benchmarks --benchmark_filter=TcpEcho.*
+
+#if AUI_PLATFORM_LINUX && AUI_COROUTINES
+
+#include <sys/resource.h>
+
+namespace {
+AFuture<> echo(_<ATcpSocket> socket) {
+    for (;;) {
+        auto data = co_await socket->readAsync();
+        if (data.empty()) {
+            co_return;
+        }
+        co_await socket->writeAsync(std::move(data));
+    }
+}
+
+AFuture<> readExactly(_<ATcpSocket> socket, size_t size) {
+    while (size > 0) {
+        auto data = co_await socket->readAsync(size);
+        if (data.empty()) {
+            throw AIOException("unexpected end of stream");
+        }
+        size -= data.size();
+    }
+}
+
+/**
+ * @brief Opens count connections at once.
+ */
+AFuture<AVector<_<ATcpSocket>>> connectAll(AInet4Address address, size_t count) {
+    AVector<AFuture<_<ATcpSocket>>> connections;
+    connections.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        connections << ATcpSocket::connectAsync(address);
+    }
+    AVector<_<ATcpSocket>> result;
+    result.reserve(count);
+    for (auto& connection : connections) {
+        result << co_await connection;
+    }
+    co_return result;
+}
+
+template<typename T>
+T run(AFuture<T> future) {
+    AEventLoop loop;
+    IEventLoop::Handle h(&loop);
+    future.onFinally([thread = AThread::current()] { thread->notifyCurrentEventLoop(); });
+    while (!future.hasResult()) {
+        loop.iteration();
+    }
+    return *future;
+}
+
+class EchoServer {
+public:
+    EchoServer(): mServer(_new<ATcpServerSocket>(0)) {
+        mAsync << [](_<ATcpServerSocket> server, AAsyncHolder& async) -> AFuture<> {
+            for (;;) {
+                _<ATcpSocket> socket;
+                try {
+                    socket = co_await server->acceptAsync();
+                } catch (const AException&) {
+                    co_return; // the server is closed
+                }
+                async << echo(std::move(socket));
+            }
+        }(mServer, mAsync);
+    }
+
+    ~EchoServer() {
+        mServer->close();
+        AThread::processMessages();
+    }
+
+    AInet4Address address() const {
+        return AInet4Address::fromString("127.0.0.1", mServer->getAddress().getPort());
+    }
+
+private:
+    _<ATcpServerSocket> mServer;
+    AAsyncHolder mAsync;
+};
+
+/**
+ * @brief Both sides of connections are in this process, so 2 file descriptors are needed per connection.
+ */
+bool ensureFileDescriptors(benchmark::State& state, size_t connections) {
+    rlimit limit;
+    getrlimit(RLIMIT_NOFILE, &limit);
+    const rlim_t required = connections * 2 + 64;
+    if (limit.rlim_cur < required) {
+        limit.rlim_cur = std::min(required, limit.rlim_max);
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+    if (limit.rlim_cur < required) {
+        state.SkipWithError("not enough file descriptors; raise the limit with ulimit -n");
+        return false;
+    }
+    return true;
+}
+}   // namespace
+
+static void TcpEchoConnect(benchmark::State& state) {
+    const size_t count = state.range(0);
+    if (!ensureFileDescriptors(state, count)) {
+        return;
+    }
+    EchoServer server;
+    for (auto _ : state) {
+        // the connections are closed when the result is dropped
+        run(connectAll(server.address(), count));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(TcpEchoConnect)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+static void TcpEchoThroughput(benchmark::State& state) {
+    static constexpr size_t TOTAL = 64 * 1024 * 1024;
+    const size_t chunk = state.range(0);
+    EchoServer server;
+    auto client = run(ATcpSocket::connectAsync(server.address()));
+    for (auto _ : state) {
+        run([&]() -> AFuture<> {
+            auto received = readExactly(client, TOTAL);
+            AByteBuffer data;
+            data.resize(chunk);
+            for (size_t sent = 0; sent < TOTAL; sent += chunk) {
+                co_await client->writeAsync(data);
+            }
+            co_await received;
+        }());
+    }
+    state.SetBytesProcessed(state.iterations() * TOTAL);
+}
+BENCHMARK(TcpEchoThroughput)->Arg(4 * 1024)->Arg(64 * 1024)->Unit(benchmark::kMillisecond);
+
+static void TcpEchoConcurrent(benchmark::State& state) {
+    static constexpr size_t MESSAGE = 1024;
+    const size_t count = state.range(0);
+    if (!ensureFileDescriptors(state, count)) {
+        return;
+    }
+    EchoServer server;
+    auto clients = run(connectAll(server.address(), count));
+
+    // each connection makes a round trip per iteration; all of them are in flight at once.
+    AByteBuffer message;
+    message.resize(MESSAGE);
+    for (auto _ : state) {
+        run([&]() -> AFuture<> {
+            AVector<AFuture<>> replies;
+            replies.reserve(clients.size());
+            for (const auto& client : clients) {
+                client->writeAsync(message);
+                replies << readExactly(client, MESSAGE);
+            }
+            for (auto& reply : replies) {
+                co_await reply;
+            }
+        }());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    state.SetBytesProcessed(state.iterations() * count * MESSAGE * 2);
+}
+BENCHMARK(TcpEchoConcurrent)->Arg(100)->Arg(1000)->Arg(10'000)->Unit(benchmark::kMillisecond);
+
+#endif
@@ -52,6 +52,7 @@ void aui_wsa_init()
 #include <netinet/in.h>
 #include <cstring>
 #include <netdb.h>
+#include <unistd.h>
 #include <AUI/Logging/ALogger.h>
 
 #endif
@@ -130,6 +131,14 @@ void AAbstractSocket::bind(uint16_t bindingPort)
             break;
         }
     }
+    if (bindingPort == 0) {
+        // the port is chosen by the system
+        sockaddr_in boundAddr;
+        socklen_t length = sizeof(boundAddr);
+        if (getsockname(getHandle(), reinterpret_cast<sockaddr*>(&boundAddr), &length) == 0) {
+            mSelfAddress = AInet4Address(boundAddr);
+        }
+    }
 }
 
 AAbstractSocket::AAbstractSocket()
@@ -150,6 +159,7 @@ void AAbstractSocket::close()
 		closesocket(mHandle);
 #else
 		shutdown(mHandle, 2);
+		::close(mHandle);
 #endif
 		mHandle = 0;
 	}
@@ -56,7 +56,7 @@ public:
 
     virtual ~AAbstractSocket();
 
-    void close();
+    virtual void close();
     void setTimeout(int secs);
 
     const AInet4Address& getAddress() const { return mSelfAddress; }
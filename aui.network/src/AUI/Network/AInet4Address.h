@@ -39,6 +39,11 @@ public:
 	static AInet4Address fromString(const AString& addr, uint16_t port = -1);
 	
 	sockaddr_in addr() const;
+
+	uint16_t getPort() const noexcept {
+		return mPort;
+	}
+
 	bool operator>(const AInet4Address& r) const;
 	bool operator<(const AInet4Address& r) const;
 	bool operator==(const AInet4Address& o) const;
@@ -17,9 +17,113 @@
 
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <poll.h>
 
 #endif
 
+#if AUI_PLATFORM_LINUX
+#include <fcntl.h>
+#include "AUI/Common/ADeque.h"
+#include "Platform/linux/SocketIoState.h"
+
+/**
+ * @brief Pending asynchronous accepts of ATcpServerSocket.
+ */
+class ATcpServerSocket::Async : public aui::impl::network::SocketIoState {
+public:
+	using SocketIoState::SocketIoState;
+
+	AFuture<_<ATcpSocket>> accept() {
+		Completions completions;
+		AFuture<_<ATcpSocket>> result;
+		{
+			std::unique_lock lock(mSync);
+			if (mFailure) {
+				result.supplyException(mFailure);
+				return result;
+			}
+			mAccepts.push_back(result);
+			if (mAccepts.size() == 1) {
+				acceptPending(completions);
+			}
+		}
+		callAll(completions);
+		return result;
+	}
+
+protected:
+	void onEvent(ABitField<UnixPollEvent> events, Completions& completions) override {
+		acceptPending(completions);
+	}
+
+	void failPending(Completions& completions) override {
+		for (auto& accept : mAccepts) {
+			completions << [accept, failure = mFailure] { accept.supplyException(failure); };
+		}
+		mAccepts.clear();
+	}
+
+private:
+	ADeque<AFuture<_<ATcpSocket>>> mAccepts;
+
+	void acceptPending(Completions& completions) {
+		while (!mAccepts.empty() && !mFailure) {
+			sockaddr_in addr;
+			socklen_t addrlen = sizeof(addr);
+			int handle = ::accept4(mFd, reinterpret_cast<sockaddr*>(&addr), &addrlen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+			if (handle < 0) {
+				switch (errno) {
+					case EINTR:
+					case ECONNABORTED: // the connection is closed by the client before it's accepted
+						continue;
+					case EAGAIN:
+#if EAGAIN != EWOULDBLOCK
+					case EWOULDBLOCK:
+#endif
+						return;
+					default:
+						// i.e., out of file descriptors. Fail the single accept; the server is still usable.
+						completions << [result = std::move(mAccepts.front()), e = makeException("socket accept error", errno)] {
+							result.supplyException(e);
+						};
+						mAccepts.pop_front();
+						return;
+				}
+			}
+			// the socket is set up after mSync is unlocked: registering it in IO thread under our lock is not needed,
+			// and a failure must reject this accept instead of escaping from the IO thread's callback.
+			completions << [result = std::move(mAccepts.front()), handle, addr] {
+				try {
+					result.supplyValue(makeAsyncSocket(handle, addr));
+				} catch (...) {
+					result.supplyException();
+				}
+			};
+			mAccepts.pop_front();
+		}
+	}
+};
+
+_<ATcpSocket> ATcpServerSocket::makeAsyncSocket(int handle, const AInet4Address& address) {
+	auto socket = aui::ptr::manage_shared(new ATcpSocket(handle, address));
+	socket->async();
+	return socket;
+}
+
+AFuture<_<ATcpSocket>> ATcpServerSocket::acceptAsync() {
+	std::call_once(mAsyncCreated, [&] {
+		listen();
+		int flags = fcntl(getHandle(), F_GETFL, 0);
+		if (flags < 0 || fcntl(getHandle(), F_SETFL, flags | O_NONBLOCK) < 0) {
+			throw AIOException("failed to make socket non-blocking: " + getErrorString());
+		}
+		mAsync = _new<Async>(getHandle());
+		mAsync->start();
+	});
+	return mAsync->accept();
+}
+
+#endif
 
 int ATcpServerSocket::createSocket()
 {
@@ -28,19 +132,51 @@ int ATcpServerSocket::createSocket()
 
 ATcpServerSocket::~ATcpServerSocket()
 {
+	close();
 }
 
-_<ATcpSocket> ATcpServerSocket::accept()
+void ATcpServerSocket::listen()
 {
-	int res = listen(getHandle(), SOMAXCONN);
+	if (mListening) {
+		return;
+	}
+	int res = ::listen(getHandle(), SOMAXCONN);
 	if (res < 0)
 		handleError("socket listen error", res);
+	mListening = true;
+}
+
+_<ATcpSocket> ATcpServerSocket::accept()
+{
+	listen();
 
 	sockaddr_in addr;
 	socklen_t addrlen = sizeof(addr);
-	int s = ::accept(getHandle(), reinterpret_cast<sockaddr*>(&addr), &addrlen);
+	for (;;) {
+		int s = ::accept(getHandle(), reinterpret_cast<sockaddr*>(&addr), &addrlen);
+#if !AUI_PLATFORM_WIN
+		if (s < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+			// the socket was made non-blocking by acceptAsync
+			pollfd fd { .fd = getHandle(), .events = POLLIN, .revents = 0 };
+			poll(&fd, 1, -1);
+			continue;
+		}
+#endif
+		if (s < 0) {
+			handleError("socket accept error", s);
+		}
+		return aui::ptr::manage_shared(new ATcpSocket(s, addr));
+	}
+}
 
-	return aui::ptr::manage_shared(new ATcpSocket(s, addr));
+void ATcpServerSocket::close()
+{
+#if AUI_PLATFORM_LINUX
+	if (mAsync) {
+		mAsync->stop();
+	}
+#endif
+	AAbstractSocket::close();
 }
 
 ATcpServerSocket::ATcpServerSocket(uint16_t serverPort)
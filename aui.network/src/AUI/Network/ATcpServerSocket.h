@@ -13,6 +13,11 @@
 #include "AAbstractSocket.h"
 #include "ATcpSocket.h"
 
+#if AUI_PLATFORM_LINUX
+#include <mutex>
+#include "AUI/Thread/AFuture.h"
+#endif
+
 
 /**
  * @brief TCP server socket.
@@ -31,4 +36,33 @@ public:
      * @return new connection
      */
 	_<ATcpSocket> accept();
+
+    void close() override;
+
+#if AUI_PLATFORM_LINUX
+    /**
+     * @brief Accepts the next connection without blocking the calling thread.
+     * @return future with the new connection, which can be used asynchronously right away.
+     * @details
+     * Concurrent accepts are fulfilled in the order they were requested. Connections are accepted on UnixIoThread.
+     */
+    [[nodiscard]]
+    AFuture<_<ATcpSocket>> acceptAsync();
+#endif
+
+private:
+    bool mListening = false;
+
+    void listen();
+
+#if AUI_PLATFORM_LINUX
+    class Async;
+    _<Async> mAsync;
+    std::once_flag mAsyncCreated;
+
+    /**
+     * @brief Wraps an accepted non-blocking connection to ATcpSocket, ready for asynchronous operations.
+     */
+    static _<ATcpSocket> makeAsyncSocket(int handle, const AInet4Address& address);
+#endif
 };
@@ -20,9 +20,344 @@
 
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <poll.h>
 
 #endif
 
+#if AUI_PLATFORM_LINUX
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <variant>
+#include "AUI/Common/ADeque.h"
+#include "AUI/Common/AOptional.h"
+#include "Platform/linux/SocketIoState.h"
+
+/**
+ * @brief Pending asynchronous operations of ATcpSocket.
+ */
+class ATcpSocket::Async : public aui::impl::network::SocketIoState {
+public:
+	using SocketIoState::SocketIoState;
+
+	AFuture<> connect(const sockaddr_in& address) {
+		std::unique_lock lock(mSync);
+		AFuture<> result;
+		int res = ::connect(mFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+		if (res == 0) {
+			result.supplyValue();
+		} else if (errno == EINPROGRESS) {
+			mConnecting = result;
+		} else {
+			result.supplyException(makeException("connection failed", errno));
+		}
+		return result;
+	}
+
+	template<typename T>
+	AFuture<T> read(AVector<iovec> buffers, size_t maxSize) {
+		Completions completions;
+		AFuture<T> result;
+		{
+			std::unique_lock lock(mSync);
+			if (mFailure) {
+				result.supplyException(mFailure);
+				return result;
+			}
+			mReads.push_back({ .buffers = std::move(buffers), .maxSize = maxSize, .result = result });
+			if (mReads.size() == 1) {
+				readPending(completions);
+			}
+		}
+		callAll(completions);
+		return result;
+	}
+
+	AFuture<> write(AByteBuffer data) {
+		Completions completions;
+		AFuture<> result;
+		{
+			std::unique_lock lock(mSync);
+			if (mFailure) {
+				result.supplyException(mFailure);
+				return result;
+			}
+			mBytesQueued += data.size();
+			mWrites.push_back({ .data = std::move(data), .end = mBytesQueued, .result = result });
+			if (mWrites.size() == 1) {
+				writePending(completions);
+			} else {
+				// the socket is full; no need to try.
+				resolveWrites(completions);
+			}
+		}
+		callAll(completions);
+		return result;
+	}
+
+	size_t writeQueueSize() {
+		std::unique_lock lock(mSync);
+		return mBytesQueued - mBytesSent;
+	}
+
+	void setWriteQueueLimit(size_t bytes) {
+		Completions completions;
+		{
+			std::unique_lock lock(mSync);
+			mWriteQueueLimit = bytes;
+			resolveWrites(completions);
+		}
+		callAll(completions);
+	}
+
+protected:
+	void onEvent(ABitField<UnixPollEvent> events, Completions& completions) override {
+		if (mConnecting && events.testAny(UnixPollEvent::OUT | UnixPollEvent::ERR | UnixPollEvent::HUP)) {
+			int error = 0;
+			socklen_t length = sizeof(error);
+			if (getsockopt(mFd, SOL_SOCKET, SO_ERROR, &error, &length) < 0) {
+				error = errno;
+			}
+			if (error != 0) {
+				fail(makeException("connection failed", error), completions);
+				return;
+			}
+			// the socket is watched since before ::connect(), and a socket that is not connected yet reports OUT|HUP
+			// as well. Such an event might be delivered after ::connect(); the connection is still in progress then.
+			sockaddr_storage peer {};
+			socklen_t peerLength = sizeof(peer);
+			if (getpeername(mFd, reinterpret_cast<sockaddr*>(&peer), &peerLength) == 0) {
+				completions << [result = std::move(*mConnecting)] { result.supplyValue(); };
+				mConnecting.reset();
+			} else if (errno != ENOTCONN) {
+				fail(makeException("connection failed", errno), completions);
+				return;
+			}
+		}
+		if (events.testAny(UnixPollEvent::IN | UnixPollEvent::ERR | UnixPollEvent::HUP)) {
+			readPending(completions);
+		}
+		if (events.testAny(UnixPollEvent::OUT | UnixPollEvent::ERR | UnixPollEvent::HUP)) {
+			writePending(completions);
+		}
+	}
+
+	void failPending(Completions& completions) override {
+		auto failWith = [&](const auto& result) {
+			completions << [result, failure = mFailure] { result.supplyException(failure); };
+		};
+		if (mConnecting) {
+			failWith(*mConnecting);
+			mConnecting.reset();
+		}
+		for (auto& read : mReads) {
+			std::visit(failWith, read.result);
+		}
+		mReads.clear();
+		for (auto& write : mWrites) {
+			if (write.result) {
+				failWith(*write.result);
+			}
+		}
+		mWrites.clear();
+		mWritesResolved = 0;
+		mBytesSent = mBytesQueued;
+	}
+
+private:
+	struct PendingRead {
+		/**
+		 * @brief Caller's buffers to scatter the data to. If empty, the data is returned as a new AByteBuffer of up to
+		 * maxSize bytes.
+		 */
+		AVector<iovec> buffers;
+		size_t maxSize;
+		std::variant<AFuture<size_t>, AFuture<AByteBuffer>> result;
+	};
+
+	struct PendingWrite {
+		AByteBuffer data;
+
+		/**
+		 * @brief Value of mBytesQueued including this write.
+		 */
+		std::uint64_t end;
+
+		/**
+		 * @brief Empty if already fulfilled.
+		 */
+		AOptional<AFuture<>> result;
+	};
+
+	/**
+	 * @brief Limits the count of buffers passed to a single gather write.
+	 */
+	static constexpr size_t MAX_IOV = std::min(64, IOV_MAX);
+
+	AOptional<AFuture<>> mConnecting;
+	ADeque<PendingRead> mReads;
+	ADeque<PendingWrite> mWrites;
+
+	/**
+	 * @brief Sent bytes of mWrites.front().
+	 */
+	size_t mWriteOffset = 0;
+
+	/**
+	 * @brief Count of mWrites at the front whose futures are already fulfilled.
+	 */
+	size_t mWritesResolved = 0;
+	std::uint64_t mBytesQueued = 0;
+	std::uint64_t mBytesSent = 0;
+	size_t mWriteQueueLimit = DEFAULT_WRITE_QUEUE_LIMIT;
+
+	void readPending(Completions& completions) {
+		while (!mReads.empty() && !mFailure) {
+			auto& read = mReads.front();
+			ssize_t res;
+			if (read.buffers.empty()) {
+				// reading to a scratch buffer first, so idle connections do not hold allocated buffers.
+				thread_local AByteBuffer scratch;
+				scratch.resize(std::max(scratch.size(), read.maxSize));
+				res = ::recv(mFd, scratch.data(), read.maxSize, 0);
+				if (res >= 0) {
+					AByteBuffer data;
+					data.resize(res);
+					std::memcpy(data.data(), scratch.data(), res);
+					completions << [result = std::get<AFuture<AByteBuffer>>(read.result), data = std::move(data)]() mutable {
+						result.supplyValue(std::move(data));
+					};
+				}
+			} else {
+				res = ::readv(mFd, read.buffers.data(), glm::min(read.buffers.size(), MAX_IOV));
+				if (res >= 0) {
+					completions << [result = std::get<AFuture<size_t>>(read.result), res] {
+						result.supplyValue(res);
+					};
+				}
+			}
+			if (res < 0) {
+				if (errno == EINTR) {
+					continue;
+				}
+				if (errno == EAGAIN || errno == EWOULDBLOCK) {
+					return;
+				}
+				fail(makeException("socket read error", errno), completions);
+				return;
+			}
+			mReads.pop_front();
+		}
+	}
+
+	void writePending(Completions& completions) {
+		while (!mWrites.empty() && !mFailure) {
+			iovec buffers[MAX_IOV];
+			size_t count = 0;
+			for (auto it = mWrites.begin(); it != mWrites.end() && count < MAX_IOV; ++it, ++count) {
+				const size_t offset = count == 0 ? mWriteOffset : 0;
+				buffers[count] = { .iov_base = it->data.data() + offset, .iov_len = it->data.size() - offset };
+			}
+			msghdr message {};
+			message.msg_iov = buffers;
+			message.msg_iovlen = count;
+			ssize_t res = ::sendmsg(mFd, &message, MSG_NOSIGNAL);
+			if (res < 0) {
+				if (errno == EINTR) {
+					continue;
+				}
+				if (errno == EAGAIN || errno == EWOULDBLOCK) {
+					break;
+				}
+				fail(makeException("socket write error", errno), completions);
+				return;
+			}
+			mBytesSent += res;
+			mWriteOffset += res;
+			while (!mWrites.empty() && mWriteOffset >= mWrites.front().data.size()) {
+				mWriteOffset -= mWrites.front().data.size();
+				if (auto& result = mWrites.front().result) {
+					completions << [result = std::move(*result)] { result.supplyValue(); };
+				}
+				mWrites.pop_front();
+				if (mWritesResolved > 0) {
+					--mWritesResolved;
+				}
+			}
+		}
+		resolveWrites(completions);
+	}
+
+	/**
+	 * @brief Fulfills the futures of the writes that fit in the write queue limit.
+	 */
+	void resolveWrites(Completions& completions) {
+		for (; mWritesResolved < mWrites.size(); ++mWritesResolved) {
+			auto& write = mWrites[mWritesResolved];
+			if (write.end > mBytesSent + mWriteQueueLimit) {
+				break;
+			}
+			completions << [result = std::move(*write.result)] { result.supplyValue(); };
+			write.result.reset();
+		}
+	}
+};
+
+ATcpSocket::Async& ATcpSocket::async() {
+	std::call_once(mAsyncCreated, [&] {
+		if (mAsync) {
+			return;
+		}
+		int flags = fcntl(getHandle(), F_GETFL, 0);
+		if (flags < 0 || fcntl(getHandle(), F_SETFL, flags | O_NONBLOCK) < 0) {
+			throw AIOException("failed to make socket non-blocking: " + getErrorString());
+		}
+		mAsync = _new<Async>(getHandle());
+		mAsync->start();
+	});
+	return *mAsync;
+}
+
+AFuture<_<ATcpSocket>> ATcpSocket::connectAsync(const AInet4Address& destinationAddress) {
+	int handle = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, IPPROTO_TCP);
+	if (handle < 0) {
+		throw AIOException("Failed to create ASocket.");
+	}
+	auto result = aui::ptr::manage_shared(new ATcpSocket(handle, destinationAddress));
+	auto& async = result->async();
+	return async.connect(destinationAddress.addr()).then([result] { return result; });
+}
+
+AFuture<size_t> ATcpSocket::readAsync(AVector<std::span<char>> buffers) {
+	AUI_ASSERTX(!buffers.empty(), "at least one buffer is expected");
+	AVector<iovec> iov;
+	iov.reserve(buffers.size());
+	for (const auto& buffer : buffers) {
+		iov << iovec { .iov_base = buffer.data(), .iov_len = buffer.size() };
+	}
+	return async().read<size_t>(std::move(iov), 0);
+}
+
+AFuture<AByteBuffer> ATcpSocket::readAsync(size_t maxSize) {
+	AUI_ASSERTX(maxSize > 0, "maxSize should be positive");
+	return async().read<AByteBuffer>({}, maxSize);
+}
+
+AFuture<> ATcpSocket::writeAsync(AByteBuffer data) {
+	return async().write(std::move(data));
+}
+
+size_t ATcpSocket::writeQueueSize() const {
+	return mAsync ? mAsync->writeQueueSize() : 0;
+}
+
+void ATcpSocket::setWriteQueueLimit(size_t bytes) {
+	async().setWriteQueueLimit(bytes);
+}
+
+#endif
 
 ATcpSocket::ATcpSocket(const AInet4Address& destinationAddress)
 {
@@ -37,24 +372,64 @@ ATcpSocket::ATcpSocket(const AInet4Address& destinationAddress)
 
 ATcpSocket::~ATcpSocket()
 {
+	close();
+}
+
+#if !AUI_PLATFORM_WIN
+namespace {
+/**
+ * @brief Blocks until the socket, which was made non-blocking by asynchronous operations, is ready.
+ */
+void waitForBlockingOperation(int handle, short events) {
+	pollfd fd { .fd = handle, .events = events, .revents = 0 };
+	while (poll(&fd, 1, -1) < 0 && errno == EINTR);
 }
+}
+#endif
 
 size_t ATcpSocket::read(char* dst, size_t size)
 {
-	int res = recv(getHandle(), dst, size, 0);
-	if (res < 0) {
-		handleError("socket read error", res);
+	for (;;) {
+		int res = recv(getHandle(), dst, size, 0);
+#if !AUI_PLATFORM_WIN
+		if (res < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+			waitForBlockingOperation(getHandle(), POLLIN);
+			continue;
+		}
+#endif
+		if (res < 0) {
+			handleError("socket read error", res);
+		}
+		return res;
 	}
-	return res;
 }
 
 void ATcpSocket::write(const char* buffer, size_t size)
 {
-	int res = send(getHandle(), buffer, size, 0);
-	if (res < 0) {
-		handleError("socket write error", res);
+	while (size > 0) {
+		int res = send(getHandle(), buffer, size, 0);
+#if !AUI_PLATFORM_WIN
+		if (res < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+			waitForBlockingOperation(getHandle(), POLLOUT);
+			continue;
+		}
+#endif
+		if (res < 0) {
+			handleError("socket write error", res);
+		}
+		buffer += res;
+		size -= res;
 	}
-	assert(res == size);
+}
+
+void ATcpSocket::close()
+{
+#if AUI_PLATFORM_LINUX
+	if (mAsync) {
+		mAsync->stop();
+	}
+#endif
+	AAbstractSocket::close();
 }
 
 int ATcpSocket::createSocket()
@@ -19,11 +19,36 @@
 
 #include "AInet4Address.h"
 
+#if AUI_PLATFORM_LINUX
+#include <mutex>
+#include <span>
+#include "AUI/Common/AByteBuffer.h"
+#include "AUI/Thread/AFuture.h"
+#endif
+
 class AByteBuffer;
 
 /**
  * @brief A bidirectional TCP connection (either a client connection or returned by ATcpServerSocket).
  * @ingroup network
+ * @details
+ * read() and write() block the calling thread.
+ *
+ * On Linux, the socket can be also used asynchronously with readAsync() and writeAsync() (and created with
+ * connectAsync() or ATcpServerSocket::acceptAsync()). Asynchronous operations are driven by UnixIoThread with
+ * edge-triggered epoll notifications, so a single thread serves any count of connections. The returned futures can be
+ * co_await-ed:
+ * ```cpp
+ * AFuture<> echo(_<ATcpSocket> socket) {
+ *     for (;;) {
+ *         auto data = co_await socket->readAsync();
+ *         if (data.empty()) {
+ *             co_return; // the connection is closed by the other side
+ *         }
+ *         co_await socket->writeAsync(std::move(data));
+ *     }
+ * }
+ * ```
  */
 class API_AUI_NETWORK ATcpSocket : public AAbstractSocket, public IInputStream, public IOutputStream {
     friend class ATcpServerSocket;
@@ -36,8 +61,84 @@ public:
     size_t read(char* dst, size_t size) override;
     void write(const char* buffer, size_t size) override;
 
+    void close() override;
+
+#if AUI_PLATFORM_LINUX
+    /**
+     * @brief Default write queue limit, in bytes.
+     * @sa setWriteQueueLimit
+     */
+    static constexpr size_t DEFAULT_WRITE_QUEUE_LIMIT = 256 * 1024;
+
+    /**
+     * @brief Connects to destinationAddress without blocking the calling thread.
+     * @return future with the connected socket.
+     */
+    [[nodiscard]]
+    static AFuture<_<ATcpSocket>> connectAsync(const AInet4Address& destinationAddress);
+
+    /**
+     * @brief Reads the available data to buffers (scatter read), waiting for it if there's no data yet.
+     * @param buffers buffers to fill in order. They must be valid until the returned future is fulfilled.
+     * @return future with the count of read bytes; 0 means the connection is closed by the other side.
+     * @details
+     * Concurrent reads are fulfilled in the order they were requested.
+     */
+    [[nodiscard]]
+    AFuture<size_t> readAsync(AVector<std::span<char>> buffers);
+
+    /**
+     * @brief Reads the available data, waiting for it if there's no data yet.
+     * @param maxSize max size of the returned buffer.
+     * @return future with the read data; an empty buffer means the connection is closed by the other side.
+     */
+    [[nodiscard]]
+    AFuture<AByteBuffer> readAsync(size_t maxSize = 64 * 1024);
+
+    /**
+     * @brief Queues data to be sent.
+     * @param data data to send.
+     * @return future which is fulfilled when the write queue is short enough to accept more data.
+     * @details
+     * Queued buffers are sent with a single syscall as much as the socket accepts (gather write).
+     *
+     * The write queue is not limited by itself; the returned future reflects backpressure instead: it's fulfilled as
+     * soon as the count of queued bytes, up to and including data, is not greater than the write queue limit. Writers
+     * that await the future before producing more data do not queue more than the limit.
+     *
+     * If the connection fails, the future of the write that was not sent completely is fulfilled with an exception.
+     */
+    AFuture<> writeAsync(AByteBuffer data);
+
+    /**
+     * @return count of bytes queued by writeAsync() and not sent yet.
+     */
+    [[nodiscard]]
+    size_t writeQueueSize() const;
+
+    /**
+     * @brief Sets the count of bytes that can be queued by writeAsync() until its future is not fulfilled immediately.
+     * @details
+     * 0 makes each writeAsync() future to be fulfilled when its data is completely sent.
+     * @sa DEFAULT_WRITE_QUEUE_LIMIT
+     */
+    void setWriteQueueLimit(size_t bytes);
+#endif
+
 protected:
     ATcpSocket(int handle, const AInet4Address& selfAddr) : AAbstractSocket(handle, selfAddr) {}
 
     int createSocket() override;
+
+private:
+#if AUI_PLATFORM_LINUX
+    class Async;
+    _<Async> mAsync;
+    std::once_flag mAsyncCreated;
+
+    /**
+     * @brief Switches the socket to non-blocking mode and subscribes to its events, if not yet.
+     */
+    Async& async();
+#endif
 };
@@ -0,0 +1,68 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SocketIoState.h"
+#include <cstring>
+#include <AUI/IO/AEOFException.h>
+#include <AUI/Network/Exceptions.h>
+
+using namespace aui::impl::network;
+
+void SocketIoState::start() {
+    {
+        std::unique_lock lock(mSync);
+        mRegistered = true;
+    }
+    UnixIoThread::inst().registerCallback(
+        mFd, UnixPollEvent::IN | UnixPollEvent::OUT | UnixPollEvent::ERR | UnixPollEvent::HUP | UnixPollEvent::EDGE_TRIGGERED,
+        [self = weak_from_this()](ABitField<UnixPollEvent> events) {
+            auto state = self.lock();
+            if (!state) {
+                return;
+            }
+            Completions completions;
+            {
+                std::unique_lock lock(state->mSync);
+                state->onEvent(events, completions);
+            }
+            callAll(completions);
+        });
+}
+
+void SocketIoState::stop() {
+    {
+        std::unique_lock lock(mSync);
+        if (!std::exchange(mRegistered, false)) {
+            return;
+        }
+    }
+    UnixIoThread::inst().unregisterCallback(mFd);
+    Completions completions;
+    {
+        std::unique_lock lock(mSync);
+        fail(std::make_exception_ptr(SocketException("socket is closed")), completions);
+    }
+    callAll(completions);
+}
+
+void SocketIoState::fail(std::exception_ptr exception, Completions& completions) {
+    if (!mFailure) {
+        mFailure = std::move(exception);
+    }
+    failPending(completions);
+}
+
+std::exception_ptr SocketIoState::makeException(const AString& message, int error) {
+    if (error == ECONNRESET || error == EPIPE) {
+        return std::make_exception_ptr(AEOFException());
+    }
+    return std::make_exception_ptr(SocketException(message + ": " + strerror(error)));
+}
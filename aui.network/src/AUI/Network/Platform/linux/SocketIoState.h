@@ -0,0 +1,94 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <exception>
+#include <functional>
+#include <AUI/Common/AString.h>
+#include <AUI/Common/AVector.h>
+#include <AUI/Platform/unix/UnixIoThread.h>
+#include <AUI/Thread/AMutex.h>
+
+namespace aui::impl::network {
+
+/**
+ * @brief Shared state of a non-blocking socket whose pending operations are driven by UnixIoThread.
+ * @details
+ * The socket is registered in UnixIoThread once, with edge-triggered notifications for both directions; no syscalls are
+ * made to (re)arm it per operation.
+ *
+ * An operation is tried right away, on the caller's thread. If it would block, it's queued and retried on IO thread
+ * when the socket notifies about the state change. Both happen with mSync locked, so a notification is never lost
+ * between a failed try and queueing the operation.
+ *
+ * Futures are fulfilled after mSync is unlocked (see Completions), so their continuations are free to start new
+ * operations on the same socket.
+ */
+class SocketIoState : public std::enable_shared_from_this<SocketIoState> {
+public:
+    /**
+     * @brief Actions to perform after mSync is unlocked (basically, fulfilling the futures).
+     */
+    using Completions = AVector<std::function<void()>>;
+
+    explicit SocketIoState(int fd) noexcept : mFd(fd) {}
+    virtual ~SocketIoState() = default;
+
+    /**
+     * @brief Subscribes to the socket's events.
+     */
+    void start();
+
+    /**
+     * @brief Unsubscribes from the socket's events and fails the pending operations. Should be called before closing
+     * the socket.
+     */
+    void stop();
+
+    static void callAll(Completions& completions) {
+        for (auto& completion : completions) {
+            completion();
+        }
+    }
+
+    /**
+     * @return exception to fail an operation with, created from errno value.
+     */
+    static std::exception_ptr makeException(const AString& message, int error);
+
+protected:
+    AMutex mSync;
+    const int mFd;
+    bool mRegistered = false;
+
+    /**
+     * @brief Exception to fail the operations with. Once set, the socket is not usable anymore.
+     */
+    std::exception_ptr mFailure;
+
+    /**
+     * @brief Retries the pending operations. Called on IO thread with mSync locked.
+     */
+    virtual void onEvent(ABitField<UnixPollEvent> events, Completions& completions) = 0;
+
+    /**
+     * @brief Fails the pending operations with mFailure. Called with mSync locked.
+     */
+    virtual void failPending(Completions& completions) = 0;
+
+    /**
+     * @brief Sets mFailure, if not set yet, and fails the pending operations. Called with mSync locked.
+     */
+    void fail(std::exception_ptr exception, Completions& completions);
+};
+
+}   // namespace aui::impl::network
@@ -0,0 +1,238 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+#include "AUI/Network/ATcpServerSocket.h"
+#include "AUI/Network/ATcpSocket.h"
+#include "AUI/Thread/AAsyncHolder.h"
+#include "AUI/Thread/AEventLoop.h"
+#include "AUI/Util/kAUI.h"
+
+#if AUI_PLATFORM_LINUX && AUI_COROUTINES
+
+namespace {
+AFuture<> echo(_<ATcpSocket> socket) {
+    for (;;) {
+        auto data = co_await socket->readAsync();
+        if (data.empty()) {
+            co_return;
+        }
+        co_await socket->writeAsync(std::move(data));
+    }
+}
+
+AByteBuffer pattern(size_t size, size_t seed = 0) {
+    AByteBuffer result;
+    result.resize(size);
+    for (size_t i = 0; i < size; ++i) {
+        result.data()[i] = char((i + seed) * 31 % 251);
+    }
+    return result;
+}
+
+/**
+ * @brief Reads exactly size bytes.
+ */
+AFuture<AByteBuffer> readExactly(_<ATcpSocket> socket, size_t size) {
+    AByteBuffer result;
+    while (result.size() < size) {
+        auto data = co_await socket->readAsync(size - result.size());
+        if (data.empty()) {
+            throw AIOException("unexpected end of stream");
+        }
+        result.write(data.data(), data.size());
+    }
+    co_return result;
+}
+
+class TcpSocketAsync : public testing::Test {
+protected:
+    _<ATcpServerSocket> mServer;
+    AAsyncHolder mAsync;
+
+    void SetUp() override {
+        mServer = _new<ATcpServerSocket>(0);
+    }
+
+    void TearDown() override {
+        // stops the accept loop
+        mServer->close();
+        AThread::processMessages();
+    }
+
+    AInet4Address serverAddress() const {
+        return AInet4Address::fromString("127.0.0.1", mServer->getAddress().getPort());
+    }
+
+    /**
+     * @brief Accepts connections and echoes them until the server is closed.
+     */
+    void startEchoServer() {
+        mAsync << [](_<ATcpServerSocket> server, AAsyncHolder& async) -> AFuture<> {
+            for (;;) {
+                _<ATcpSocket> socket;
+                try {
+                    socket = co_await server->acceptAsync();
+                } catch (const AException&) {
+                    co_return; // the server is closed
+                }
+                async << echo(std::move(socket));
+            }
+        }(mServer, mAsync);
+    }
+
+    template<typename T>
+    T run(AFuture<T> future) {
+        AEventLoop loop;
+        IEventLoop::Handle h(&loop);
+        // futures of the sockets are fulfilled on IO thread
+        future.onFinally([thread = AThread::current()] { thread->notifyCurrentEventLoop(); });
+        while (!future.hasResult()) {
+            loop.iteration();
+        }
+        return *future;
+    }
+};
+}   // namespace
+
+TEST_F(TcpSocketAsync, Echo) {
+    startEchoServer();
+    auto data = run([&]() -> AFuture<AByteBuffer> {
+        auto client = co_await ATcpSocket::connectAsync(serverAddress());
+        co_await client->writeAsync(pattern(100));
+        co_return co_await readExactly(client, 100);
+    }());
+    EXPECT_EQ(data, pattern(100));
+}
+
+TEST_F(TcpSocketAsync, LargeTransfer) {
+    // more than socket buffers can hold, so both sides have to wait for each other.
+    static constexpr size_t SIZE = 32 * 1024 * 1024;
+    startEchoServer();
+    auto data = run([&]() -> AFuture<AByteBuffer> {
+        auto client = co_await ATcpSocket::connectAsync(serverAddress());
+        auto received = readExactly(client, SIZE);
+        for (size_t i = 0; i < SIZE; i += 1024 * 1024) {
+            co_await client->writeAsync(pattern(1024 * 1024, i));
+        }
+        co_return co_await received;
+    }());
+    ASSERT_EQ(data.size(), SIZE);
+    for (size_t i = 0; i < SIZE; i += 1024 * 1024) {
+        ASSERT_EQ(std::memcmp(data.data() + i, pattern(1024 * 1024, i).data(), 1024 * 1024), 0) << i;
+    }
+}
+
+TEST_F(TcpSocketAsync, ScatterRead) {
+    startEchoServer();
+    auto [first, second] = run([&]() -> AFuture<std::pair<AString, AString>> {
+        auto client = co_await ATcpSocket::connectAsync(serverAddress());
+        client->setWriteQueueLimit(0);
+        co_await client->writeAsync(AByteBuffer::fromString("hello world"));
+        std::array<char, 5> a;
+        std::array<char, 6> b;
+        size_t read = 0;
+        while (read < a.size() + b.size()) {
+            AVector<std::span<char>> buffers;
+            if (read < a.size()) {
+                buffers << std::span(a).subspan(read) << std::span(b);
+            } else {
+                buffers << std::span(b).subspan(read - a.size());
+            }
+            read += co_await client->readAsync(std::move(buffers));
+        }
+        co_return std::pair(AString(a.begin(), a.end()), AString(b.begin(), b.end()));
+    }());
+    EXPECT_EQ(first, "hello");
+    EXPECT_EQ(second, " world");
+}
+
+TEST_F(TcpSocketAsync, Backpressure) {
+    static constexpr size_t LIMIT = 64 * 1024;
+    static constexpr size_t CHUNK = 1024 * 1024;
+    auto accepted = mServer->acceptAsync();
+    auto client = run(ATcpSocket::connectAsync(serverAddress()));
+    auto server = run(accepted);
+    client->setWriteQueueLimit(LIMIT);
+
+    // the server does not read, so the writes are queued after the socket buffers are full.
+    AVector<AFuture<>> writes;
+    for (size_t i = 0; i < 64; ++i) {
+        writes << client->writeAsync(pattern(CHUNK, i));
+    }
+    EXPECT_GT(client->writeQueueSize(), LIMIT);
+    EXPECT_FALSE(writes.last().hasResult());
+
+    // reading on the other side makes the client to send the queued data.
+    auto received = run(readExactly(server, CHUNK * writes.size()));
+    EXPECT_EQ(received.size(), CHUNK * writes.size());
+    for (auto& write : writes) {
+        run(write);
+    }
+    EXPECT_EQ(client->writeQueueSize(), 0);
+}
+
+TEST_F(TcpSocketAsync, EndOfStream) {
+    auto accepted = mServer->acceptAsync();
+    auto client = run(ATcpSocket::connectAsync(serverAddress()));
+    auto server = run(accepted);
+    auto read = server->readAsync();
+    client->close();
+    EXPECT_TRUE(run(read).empty());
+}
+
+TEST_F(TcpSocketAsync, ConnectRefused) {
+    // the server socket is bound but does not listen until acceptAsync.
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_THROW(run(ATcpSocket::connectAsync(serverAddress())), AException);
+    }
+}
+
+TEST_F(TcpSocketAsync, CloseFailsPendingOperations) {
+    auto accepted = mServer->acceptAsync();
+    auto client = run(ATcpSocket::connectAsync(serverAddress()));
+    auto server = run(accepted);
+    auto read = client->readAsync();
+    auto accept = mServer->acceptAsync();
+    client->close();
+    mServer->close();
+    EXPECT_THROW(run(read), AException);
+    EXPECT_THROW(run(accept), AException);
+    EXPECT_THROW(run(client->writeAsync(pattern(10))), AException);
+}
+
+TEST_F(TcpSocketAsync, ManyConnections) {
+    static constexpr size_t COUNT = 300;
+    startEchoServer();
+    auto results = run([&]() -> AFuture<AVector<AByteBuffer>> {
+        AVector<_<ATcpSocket>> clients;
+        for (size_t i = 0; i < COUNT; ++i) {
+            clients << co_await ATcpSocket::connectAsync(serverAddress());
+        }
+        // all the connections are alive at the same time
+        AVector<AFuture<AByteBuffer>> replies;
+        for (size_t i = 0; i < COUNT; ++i) {
+            clients[i]->writeAsync(pattern(1000, i));
+            replies << readExactly(clients[i], 1000);
+        }
+        AVector<AByteBuffer> result;
+        for (auto& reply : replies) {
+            result << co_await reply;
+        }
+        co_return result;
+    }());
+    ASSERT_EQ(results.size(), COUNT);
+    for (size_t i = 0; i < COUNT; ++i) {
+        EXPECT_EQ(results[i], pattern(1000, i)) << i;
+    }
+}
+
+#endif
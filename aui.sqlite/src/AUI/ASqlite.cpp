@@ -11,9 +11,162 @@
 
 #include "ASqlite.h"
 #include <AUI/Data/ISqlDatabase.h>
+#include <AUI/Data/SQLException.h>
 #include "sqlite3.h"
 #include <AUI/Common/AException.h>
+#include <AUI/Util/kAUI.h>
 #include <cassert>
+#include <limits>
+#include <list>
+#include <unordered_map>
+
+namespace {
+
+/**
+ * Prepared statement shared by the statement cache and the result reading it.
+ */
+class SqliteStatement {
+public:
+    explicit SqliteStatement(sqlite3_stmt* stmt) : mStmt(stmt) {}
+
+    ~SqliteStatement() {
+        sqlite3_finalize(mStmt);
+    }
+
+    SqliteStatement(const SqliteStatement&) = delete;
+
+    [[nodiscard]]
+    sqlite3_stmt* get() const noexcept {
+        return mStmt;
+    }
+
+    /**
+     * @brief Makes the statement available for the next query.
+     */
+    void release() noexcept {
+        sqlite3_reset(mStmt);
+        sqlite3_clear_bindings(mStmt);
+        inUse = false;
+    }
+
+    /**
+     * @brief The statement is being executed or its result is being read.
+     */
+    bool inUse = false;
+
+private:
+    sqlite3_stmt* mStmt;
+};
+
+/**
+ * LRU cache of the prepared statements of a connection, keyed by the SQL text.
+ */
+class SqliteStatementCache {
+public:
+    static constexpr size_t CAPACITY = 64;
+
+    explicit SqliteStatementCache(sqlite3* connection) : mConnection(connection) {}
+
+    /**
+     * @brief Returns the prepared statement for the query, marked as in use.
+     * @details
+     * If the cached statement is in use already (i.e., the result of the previous query is still being read), an
+     * uncached statement is prepared.
+     */
+    _<SqliteStatement> acquire(const AString& query) {
+        if (auto it = mIndex.find(query); it != mIndex.end()) {
+            mEntries.splice(mEntries.begin(), mEntries, it->second);
+            auto& statement = it->second->second;
+            if (!statement->inUse) {
+                statement->inUse = true;
+                return statement;
+            }
+            auto result = prepare(query, 0);
+            result->inUse = true;
+            return result;
+        }
+
+        auto statement = prepare(query, SQLITE_PREPARE_PERSISTENT);
+        statement->inUse = true;
+        mEntries.emplace_front(query, statement);
+        mIndex[query] = mEntries.begin();
+        if (mEntries.size() > CAPACITY) {
+            // an evicted statement which is in use is finalized by its result.
+            mIndex.erase(mEntries.back().first);
+            mEntries.pop_back();
+        }
+        return statement;
+    }
+
+private:
+    sqlite3* mConnection;
+
+    /**
+     * @brief Most recently used statements first.
+     */
+    std::list<std::pair<AString, _<SqliteStatement>>> mEntries;
+    std::unordered_map<AString, decltype(mEntries)::iterator> mIndex;
+
+    _<SqliteStatement> prepare(const AString& query, unsigned flags) {
+        sqlite3_stmt* stmt = nullptr;
+        if (sqlite3_prepare_v3(mConnection, query.bytes().data(), int(query.bytes().size()), flags, &stmt,
+                               nullptr) != SQLITE_OK || !stmt) {
+            sqlite3_finalize(stmt);
+            throw SQLException(AString("could not prepare query: ") + sqlite3_errmsg(mConnection));
+        }
+        return _new<SqliteStatement>(stmt);
+    }
+};
+
+void bind(sqlite3_stmt* stmt, const AVector<AVariant>& params) {
+    for (unsigned i = 0; i < params.size(); ++i) {
+        int status = SQLITE_OK;
+        switch (params[i].getType()) {
+            case AVariantType::AV_NULL:
+                status = sqlite3_bind_null(stmt, i + 1);
+                break;
+            case AVariantType::AV_INT:
+                status = sqlite3_bind_int64(stmt, i + 1, params[i].toInt());
+                break;
+            case AVariantType::AV_UINT:
+                status = sqlite3_bind_int64(stmt, i + 1, params[i].toUInt());
+                break;
+            case AVariantType::AV_FLOAT:
+                status = sqlite3_bind_double(stmt, i + 1, params[i].toFloat());
+                break;
+            case AVariantType::AV_DOUBLE:
+                status = sqlite3_bind_double(stmt, i + 1, params[i].toDouble());
+                break;
+            case AVariantType::AV_STRING: {
+                // copied by sqlite; the string is a temporary.
+                auto string = params[i].toString();
+                status = sqlite3_bind_text(stmt, i + 1, string.bytes().data(), int(string.bytes().size()),
+                                           SQLITE_TRANSIENT);
+                break;
+            }
+            case AVariantType::AV_BOOL:
+                status = sqlite3_bind_int(stmt, i + 1, params[i].toBool());
+                break;
+        }
+        if (status != SQLITE_OK) {
+            throw SQLException(AString("could not bind query parameter: ") + sqlite3_errmsg(sqlite3_db_handle(stmt)));
+        }
+    }
+}
+
+/**
+ * @brief Steps a statement which does not return rows.
+ */
+void stepToCompletion(sqlite3_stmt* stmt) {
+    int status;
+    do {
+        status = sqlite3_step(stmt);
+    } while (status == SQLITE_ROW);
+    if (status != SQLITE_DONE) {
+        throw SQLException(AString("could not execute query: ") + sqlite3_errmsg(sqlite3_db_handle(stmt)));
+    }
+}
+}
 
 class SqliteRow: public ISqlDriverRow {
 private:
@@ -28,14 +181,20 @@ public:
 
     AVariant getValue(size_t index) override {
         switch (sqlite3_column_type(mStmt, index)) {
-            case SQLITE_INTEGER:
-                return sqlite3_column_int(mStmt, index);
+            case SQLITE_INTEGER: {
+                auto value = sqlite3_column_int64(mStmt, index);
+                if (value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max()) {
+                    return int(value);
+                }
+                // AVariant has no 64-bit integer type; use getInt64 to read such values.
+                return AString::number(value);
+            }
 
             case SQLITE_FLOAT:
                 return sqlite3_column_double(mStmt, index);
 
             case SQLITE_TEXT:
-                return AString((const char*)sqlite3_column_text(mStmt, index));
+                return getString(index);
 
             case SQLITE_NULL:
                 return nullptr;
@@ -43,32 +202,53 @@ public:
         AUI_ASSERT(0);
         return AVariant();
     }
+
+    bool isNull(size_t index) override {
+        return sqlite3_column_type(mStmt, index) == SQLITE_NULL;
+    }
+
+    std::int64_t getInt64(size_t index) override {
+        return sqlite3_column_int64(mStmt, index);
+    }
+
+    double getDouble(size_t index) override {
+        return sqlite3_column_double(mStmt, index);
+    }
+
+    AString getString(size_t index) override {
+        auto text = reinterpret_cast<const char*>(sqlite3_column_text(mStmt, index));
+        if (!text) {
+            return {};
+        }
+        return AString(text, size_t(sqlite3_column_bytes(mStmt, index)));
+    }
 };
 
 class SqliteResult: public ISqlDriverResult {
-    friend class SqliteDatabase;
 private:
-    sqlite3_stmt* mStmt;
+    _<SqliteStatement> mStatement;
     AVector<SqlColumn> mColumns;
 
     /*
-     * Extends strings' life.
+     * The same row object is returned for every step.
      */
-    AVector<std::string> mTempStrings;
+    _<SqliteRow> mRow;
 
 public:
-    SqliteResult() {}
+    explicit SqliteResult(_<SqliteStatement> statement):
+        mStatement(std::move(statement)),
+        mRow(_new<SqliteRow>(mStatement->get())) {}
 
     ~SqliteResult() override {
-        sqlite3_finalize(mStmt);
+        mStatement->release();
     }
 
     const AVector<SqlColumn>& getColumns() override {
         if (mColumns.empty()) {
-            for (unsigned i = 0; i < sqlite3_column_count(mStmt); ++i) {
+            for (unsigned i = 0; i < sqlite3_column_count(mStatement->get()); ++i) {
                 SqlColumn c;
-                c.name = sqlite3_column_name(mStmt, i);
-                switch (sqlite3_column_type(mStmt, i)) {
+                c.name = sqlite3_column_name(mStatement->get(), i);
+                switch (sqlite3_column_type(mStatement->get(), i)) {
                     case SQLITE_INTEGER:
                         c.type = SqlType::ST_STRING;
                         break;
@@ -85,36 +265,43 @@ public:
     }
 
     _<ISqlDriverRow> begin() override {
-        return next(_new<SqliteRow>(mStmt));
+        return next(mRow);
     }
 
     _<ISqlDriverRow> next(const _<ISqlDriverRow>& previous) override {
-        switch (sqlite3_step(mStmt)) {
+        switch (sqlite3_step(mStatement->get())) {
             case SQLITE_DONE:
                 return nullptr;
             case SQLITE_ROW:
                 return previous;
-            case SQLITE_ERROR:
-                throw AException("could not fetch row");
         }
-        AUI_ASSERT(0);
-        return nullptr;
+        throw SQLException(AString("could not fetch row: ") +
+                           sqlite3_errmsg(sqlite3_db_handle(mStatement->get())));
     }
 };
 
 class SqliteDatabase: public ISqlDatabase {
 private:
     sqlite3* mConnection;
-public:
-    SqliteDatabase(const AString& path) {
-        sqlite3_open(path.toStdString().c_str(), &mConnection);
-        if (!mConnection) {
-            throw AException("could not open database: " + path);
+    SqliteStatementCache mStatements;
+
+    static sqlite3* open(const AString& path) {
+        sqlite3* connection = nullptr;
+        if (sqlite3_open(path.toStdString().c_str(), &connection) != SQLITE_OK) {
+            AString message = connection ? sqlite3_errmsg(connection) : "out of memory";
+            sqlite3_close(connection);
+            throw AException("could not open database: " + path + ": " + message);
         }
+        return connection;
     }
 
+public:
+    SqliteDatabase(const AString& path) : mConnection(open(path)), mStatements(mConnection) {}
+
     ~SqliteDatabase() override {
-        sqlite3_close(mConnection);
+        // the connection is closed once the cached statements and the statements of the results still being read
+        // are finalized.
+        sqlite3_close_v2(mConnection);
     }
 
 	SqlDriverType getDriverType() override {
@@ -122,54 +309,60 @@ public:
     }
 
     _<ISqlDriverResult> query(const AString& query, const AVector<AVariant>& params) override {
-        sqlite3_stmt* stmt;
-
-        auto result = _new<SqliteResult>();
-
-        result->mTempStrings.reserve(params.size() + 1);
-        result->mTempStrings << query.toStdString();
-        sqlite3_prepare_v2(mConnection, result->mTempStrings.back().c_str(), result->mTempStrings.back().length(), &stmt,
-                           nullptr);
-        result->mStmt = stmt;
-
-        for (unsigned i = 0; i < params.size(); ++i) {
-            switch (params[i].getType()) {
-                case AVariantType::AV_NULL:
-                    sqlite3_bind_null(stmt, i + 1);
-                    break;
-                case AVariantType::AV_INT:
-                    sqlite3_bind_int(stmt, i + 1, params[i].toInt());
-                    break;
-                case AVariantType::AV_UINT:
-                    sqlite3_bind_int(stmt, i + 1, params[i].toInt());
-                    break;
-                case AVariantType::AV_FLOAT:
-                    sqlite3_bind_double(stmt, i + 1, params[i].toFloat());
-                    break;
-                case AVariantType::AV_DOUBLE:
-                    sqlite3_bind_double(stmt, i + 1, params[i].toDouble());
-                    break;
-                case AVariantType::AV_STRING:
-                    result->mTempStrings << params[i].toString().toStdString();
-                    sqlite3_bind_text(stmt, i + 1, result->mTempStrings.back().c_str(), result->mTempStrings.back().length(),
-                                      nullptr);
-                    break;
-                case AVariantType::AV_BOOL:
-                    sqlite3_bind_int(stmt, i + 1, params[i].toBool());
-                    break;
-            }
+        auto statement = mStatements.acquire(query);
+        try {
+            bind(statement->get(), params);
+        } catch (...) {
+            statement->release();
+            throw;
         }
-        if (!stmt) {
-            throw AException(AString("could not execute query: ") + sqlite3_errmsg(mConnection));
-        }
-
-        return result;
+        return _new<SqliteResult>(std::move(statement));
     }
 
     int execute(const AString& query, const AVector<AVariant>& params) override {
-        SqliteDatabase::query(query, params)->begin();
+        auto statement = mStatements.acquire(query);
+        AUI_DEFER { statement->release(); };
+        bind(statement->get(), params);
+        stepToCompletion(statement->get());
         return sqlite3_last_insert_rowid(mConnection);
     }
+
+    int executeBatch(const AString& query, const AVector<AVector<AVariant>>& paramSets) override {
+        auto statement = mStatements.acquire(query);
+        AUI_DEFER { statement->release(); };
+
+        // a transaction started by the caller is respected.
+        const bool ownTransaction = sqlite3_get_autocommit(mConnection);
+        if (ownTransaction) {
+            exec("BEGIN");
+        }
+        try {
+            for (const auto& params : paramSets) {
+                bind(statement->get(), params);
+                stepToCompletion(statement->get());
+                sqlite3_reset(statement->get());
+            }
+        } catch (...) {
+            if (ownTransaction) {
+                sqlite3_exec(mConnection, "ROLLBACK", nullptr, nullptr, nullptr);
+            }
+            throw;
+        }
+        if (ownTransaction) {
+            exec("COMMIT");
+        }
+        return sqlite3_last_insert_rowid(mConnection);
+    }
+
+private:
+    void exec(const char* sql) {
+        char* error = nullptr;
+        if (sqlite3_exec(mConnection, sql, nullptr, nullptr, &error) != SQLITE_OK) {
+            AString message = error ? error : sqlite3_errmsg(mConnection);
+            sqlite3_free(error);
+            throw SQLException(AString("could not execute query: ") + message);
+        }
+    }
 };
 
 AString ASqlite::getDriverName() {
@@ -133,3 +133,54 @@ TEST_F(Builder, BuilderDeleteWhere) {
         ASSERT_EQ(result[0][0], "Soso");
         ASSERT_EQ(result[1][0], "Kekos");
 }
+
+TEST_F(Builder, TypedAccess) {
+    Autumn::get<ASqlDatabase>()->execute("CREATE TABLE numbers (value INTEGER, name VARCHAR(32))");
+    Autumn::get<ASqlDatabase>()->execute("INSERT INTO numbers (value, name) VALUES (9007199254740993, 'big'), (NULL, NULL)");
+
+    auto res = Autumn::get<ASqlDatabase>()->query("SELECT value, name FROM numbers");
+    auto it = res->begin();
+    ASSERT_TRUE(it != res->end());
+    EXPECT_EQ(it->getInt64(0), 9007199254740993);
+    EXPECT_EQ(it->getString(1), "big");
+    EXPECT_FALSE(it->isNull(0));
+    ++it;
+    ASSERT_TRUE(it != res->end());
+    EXPECT_TRUE(it->isNull(0));
+    EXPECT_TRUE(it->isNull(1));
+    ++it;
+    EXPECT_TRUE(it == res->end());
+}
+
+TEST_F(Builder, BatchInsert) {
+    AVector<AVector<AVariant>> rows;
+    for (int i = 0; i < 1000; ++i) {
+        rows << AVector<AVariant>{ "user" + AString::number(i) };
+    }
+    id_t lastId = table("users").ins("name").rows(rows).rowId();
+    EXPECT_EQ(lastId, 1000);
+
+    auto result = table("users").sel("id", "name").get();
+    ASSERT_EQ(result.size(), 1000);
+    EXPECT_EQ(result[0][1], "user0");
+    EXPECT_EQ(result[999][1], "user999");
+}
+
+/**
+ * The same query is executed while the result of the previous one is still being read; the cached prepared
+ * statement must not be reused by the second query.
+ */
+TEST_F(Builder, NestedSameQuery) {
+    seedDatabase();
+    size_t count = 0;
+    for (auto outer : Autumn::get<ASqlDatabase>()->query("SELECT name FROM users")) {
+        for (auto inner : Autumn::get<ASqlDatabase>()->query("SELECT name FROM users")) {
+            AUI_NO_OPTIMIZE_OUT(inner);
+            ++count;
+        }
+    }
+    EXPECT_EQ(count, 9);
+
+    // the cached statement is available again
+    EXPECT_EQ(table("users").sel("name").get().size(), 3);
+}
@@ -143,4 +143,93 @@ BOOST_AUTO_TEST_SUITE(ORM)
         }
     }
 
-BOOST_AUTO_TEST_SUITE_END()*/
\ No newline at end of file
+BOOST_AUTO_TEST_SUITE_END()*/
+
+namespace {
+struct Item : ASqlModel<Item> {
+    AString name;
+    int64_t count = 0;
+    AOptional<double> price;
+};
+}
+
+A_META(Item)
+{
+    A_SQL_TABLE("items")
+
+    A_FIELDS {
+        return {
+                A_FIELD(name)
+                A_FIELD(count)
+                A_FIELD(price)
+        };
+    };
+};
+
+class ORM: public ::testing::Test {
+protected:
+    void SetUp() override {
+        Test::SetUp();
+
+        Autumn::put(ASqlDatabase::connect("sqlite", ":memory:"));
+        Autumn::get<ASqlDatabase>()->execute(
+            "CREATE TABLE items (id INTEGER PRIMARY KEY, name VARCHAR(64), count INTEGER, price DOUBLE)");
+        AVector<AVector<AVariant>> rows;
+        for (int i = 0; i < 100; ++i) {
+            rows << AVector<AVariant>{ "item" + AString::number(i), i * 3, i % 2 == 0 ? AVariant(i * 0.5) : AVariant(nullptr) };
+        }
+        Autumn::get<ASqlDatabase>()->executeBatch("INSERT INTO items (name, count, price) VALUES (?, ?, ?)", rows);
+    }
+};
+
+TEST_F(ORM, Get) {
+    auto items = Item::all()->get();
+    ASSERT_EQ(items.size(), 100);
+    for (size_t i = 0; i < items.size(); ++i) {
+        EXPECT_EQ(items[i].id, i + 1);
+        EXPECT_EQ(items[i].name, "item" + AString::number(i));
+        EXPECT_EQ(items[i].count, i * 3);
+        if (i % 2 == 0) {
+            EXPECT_EQ(items[i].price, i * 0.5);
+        } else {
+            EXPECT_FALSE(items[i].price);
+        }
+    }
+}
+
+TEST_F(ORM, ForEach) {
+    int64_t sum = 0;
+    size_t count = 0;
+    Item::where(col("count") >= 150)->forEach([&](Item&& item) {
+        sum += item.count;
+        ++count;
+    });
+    EXPECT_EQ(count, 50);
+    EXPECT_EQ(sum, 3 * (50 + 99) * 50 / 2);
+}
+
+TEST_F(ORM, ById) {
+    auto item = Item::byId(42);
+    EXPECT_EQ(item.name, "item41");
+    EXPECT_EQ(item.count, 123);
+}
+
+TEST_F(ORM, SaveThroughFields) {
+    Item item;
+    item.name = "saved";
+    item.count = 7;
+    item.save();
+    EXPECT_EQ(item.id, 101);
+
+    auto stored = Item::byId(item.id);
+    EXPECT_EQ(stored.name, "saved");
+    EXPECT_EQ(stored.count, 7);
+    EXPECT_FALSE(stored.price);
+
+    stored.price = 2.5;
+    AModelMeta<Item>::getFields()["count"]->set(stored, AVariant(8));
+    stored.save();
+    auto updated = Item::byId(item.id);
+    EXPECT_EQ(updated.count, 8);
+    EXPECT_EQ(updated.price, 2.5);
+}
@@ -0,0 +1,183 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+#include <AUI/Data/ASqlDatabase.h>
+#include <AUI/IO/APath.h>
+#include <thread>
+
+class Pool: public ::testing::Test {
+protected:
+    APath mPath = APath::getDefaultPath(APath::TEMP).makeDirs() / "aui.sqlite.pool_test.db";
+    _<ASqlDatabase> mDatabase;
+
+    void SetUp() override {
+        Test::SetUp();
+        for (const auto& suffix : { "", "-wal", "-shm" }) {
+            if (APath(mPath + suffix).isRegularFileExists()) {
+                APath(mPath + suffix).removeFile();
+            }
+        }
+
+        mDatabase = ASqlDatabase::connectPool(4, "sqlite", mPath);
+        mDatabase->execute("CREATE TABLE items (id INTEGER PRIMARY KEY, value INTEGER)");
+        AVector<AVector<AVariant>> rows;
+        for (int i = 0; i < 1000; ++i) {
+            rows << AVector<AVariant>{ i };
+        }
+        mDatabase->executeBatch("INSERT INTO items (value) VALUES (?)", rows);
+    }
+
+    void TearDown() override {
+        mDatabase = nullptr;
+        Test::TearDown();
+    }
+};
+
+TEST_F(Pool, ConcurrentAsyncQueries) {
+    AVector<AFuture<AVector<AVector<AVariant>>>> futures;
+    for (int i = 0; i < 32; ++i) {
+        futures << mDatabase->queryAsync("SELECT COUNT(*), SUM(value) FROM items WHERE value >= ?", { i });
+    }
+    for (int i = 0; i < 32; ++i) {
+        auto rows = *futures[i];
+        ASSERT_EQ(rows.size(), 1);
+        EXPECT_EQ(rows[0][0].toInt(), 1000 - i);
+    }
+}
+
+/**
+ * Executes a query while reading the result of another one on the same thread; the thread reuses its connection
+ * instead of waiting for itself.
+ */
+TEST_F(Pool, NestedQueries) {
+    size_t count = 0;
+    auto result = mDatabase->query("SELECT id FROM items WHERE value < 10");
+    for (auto row : *result) {
+        mDatabase->execute("UPDATE items SET value = value + 1000 WHERE id = ?", { int(row.getInt64(0)) });
+        ++count;
+    }
+    EXPECT_EQ(count, 10);
+    EXPECT_EQ(mDatabase->query("SELECT COUNT(*) FROM items WHERE value >= 1000")->begin().getInt64(0), 10);
+}
+
+TEST_F(Pool, Async) {
+    auto future = mDatabase->async([](ASqlDatabase& db) {
+        db.execute("DELETE FROM items WHERE value % 2 = 0");
+        return db.query("SELECT COUNT(*) FROM items")->begin().getInt64(0);
+    });
+    EXPECT_EQ(*future, 500);
+}
+
+TEST_F(Pool, Statistics) {
+    mDatabase->resetStatistics();
+    for (int i = 0; i < 10; ++i) {
+        mDatabase->execute("UPDATE items SET value = ? WHERE id = 1", { i });
+    }
+    auto statistics = mDatabase->statistics();
+    ASSERT_TRUE(statistics.queries.contains("UPDATE items SET value = ? WHERE id = ?"));
+    const auto& query = statistics.queries["UPDATE items SET value = ? WHERE id = ?"];
+    EXPECT_EQ(query.count, 10);
+    EXPECT_GE(query.totalTime, query.maxTime);
+}
+
+/**
+ * Queries with the values inlined share an entry.
+ */
+TEST_F(Pool, StatisticsByTemplate) {
+    mDatabase->resetStatistics();
+    for (int i = 0; i < 10; ++i) {
+        mDatabase->execute("UPDATE items SET value = " + AString::number(i * 1.5) + " WHERE id = " + AString::number(i));
+        mDatabase->execute("INSERT INTO items (value) VALUES ('it''s " + AString::number(i) + "')");
+    }
+    auto statistics = mDatabase->statistics();
+    EXPECT_EQ(statistics.queries.size(), 2);
+    EXPECT_EQ(statistics.queries["UPDATE items SET value = ? WHERE id = ?"].count, 10);
+    EXPECT_EQ(statistics.queries["INSERT INTO items (value) VALUES (?)"].count, 10);
+}
+
+TEST_F(Pool, StatisticsCapped) {
+    mDatabase->resetStatistics();
+    constexpr auto MAX = ASqlDatabase::Statistics::MAX_QUERIES;
+    auto queryText = [](size_t i) {
+        return "SELECT value AS v" + AString::number(i) + " FROM items WHERE id = ?";
+    };
+    for (size_t i = 0; i < MAX + 10; ++i) {
+        mDatabase->query(queryText(i), { 1 });
+        if (i == MAX - 1) {
+            // the oldest query is used again and is not evicted.
+            mDatabase->query(queryText(0), { 1 });
+        }
+    }
+    auto statistics = mDatabase->statistics();
+    EXPECT_EQ(statistics.queries.size(), MAX);
+    EXPECT_EQ(statistics.evictedQueries, 10);
+    EXPECT_TRUE(statistics.queries.contains(queryText(0)));
+    EXPECT_FALSE(statistics.queries.contains(queryText(1)));
+    EXPECT_FALSE(statistics.queries.contains(queryText(10)));
+    EXPECT_TRUE(statistics.queries.contains(queryText(11)));
+    EXPECT_TRUE(statistics.queries.contains(queryText(MAX + 9)));
+}
+
+namespace {
+_<ASqlDatabase> makeSingleConnectionDatabase() {
+    auto database = ASqlDatabase::connect("sqlite", ":memory:");
+    database->execute("CREATE TABLE items (id INTEGER PRIMARY KEY, value INTEGER)");
+    AVector<AVector<AVariant>> rows;
+    for (int i = 0; i < 10; ++i) {
+        rows << AVector<AVariant>{ i };
+    }
+    database->executeBatch("INSERT INTO items (value) VALUES (?)", rows);
+    return database;
+}
+
+bool waitFor(const AFuture<int>& future, std::chrono::milliseconds timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (future.isWaitNeeded() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return !future.isWaitNeeded();
+}
+}
+
+/**
+ * With a single connection, a result is streamed: it keeps the connection checked out, other threads wait for it.
+ */
+TEST(PoolSingleConnection, LiveResultKeepsConnection) {
+    auto database = makeSingleConnectionDatabase();
+    auto result = database->query("SELECT value FROM items");
+    auto update = database->executeAsync("UPDATE items SET value = value + 100");
+    EXPECT_FALSE(waitFor(update, std::chrono::milliseconds(100)));
+    result = nullptr;
+    EXPECT_TRUE(waitFor(update, std::chrono::seconds(10)));
+}
+
+/**
+ * A detached result does not block the queries of other threads.
+ */
+TEST(PoolSingleConnection, DetachedResultDoesNotBlock) {
+    auto database = makeSingleConnectionDatabase();
+    auto result = database->query("SELECT value FROM items");
+    result->detach();
+    auto update = database->executeAsync("UPDATE items SET value = value + 100");
+    if (!waitFor(update, std::chrono::seconds(10))) {
+        result = nullptr;
+        FAIL() << "the detached result blocks the connection";
+    }
+
+    // the rows were read before the update.
+    EXPECT_EQ(result->getRowCount(), 10);
+    std::int64_t sum = 0;
+    for (auto row : *result) {
+        sum += row.getInt64(0);
+    }
+    EXPECT_EQ(sum, 45);
+}
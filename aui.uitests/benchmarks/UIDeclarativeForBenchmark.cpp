@@ -0,0 +1,60 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+#include "AUI/UITest.h"
+#include "AUI/Util/UIBuildingHelpers.h"
+#include "AUI/View/AForEachUI.h"
+#include "AUI/View/AScrollArea.h"
+
+static void DeclarativeForSingleItemUpdate(benchmark::State& state) {
+    // Measures a single item update in a large keyed list.
+    //
+    // Views of the list are reconciled by keys, so the cost of an update should not depend on the list length: the
+    // updated item's view is replaced, the rest of the presented views stay in place.
+
+    uitest::setup();
+
+    struct Model {
+        AProperty<AVector<int>> items;
+    };
+    auto model = _new<Model>();
+    {
+        AVector<int> items;
+        for (int i = 0; i < state.range(0); ++i) {
+            items << i;
+        }
+        model->items = std::move(items);
+    }
+
+    auto window = _new<AWindow>();
+    window->setContents(declarative::Centered {
+      AScrollArea::Builder()
+              .withContents(AUI_DECLARATIVE_FOR(i, *model->items, AVerticalLayout) {
+                  return declarative::Label { "{}"_format(i) };
+              } AUI_LET { it->setKeyFunction([](int k) { return std::size_t(k); }); })
+              .build() AUI_OVERRIDE_STYLE { ass::FixedSize { 200_dp, 400_dp } },
+    });
+    window->pack();
+    window->show();
+    uitest::frame();
+
+    int nextValue = state.range(0);
+    std::size_t index = 0;
+    for (auto _2 : state) {
+        // updates one of the presented items
+        (*model->items.writeScope())[index] = nextValue++;
+        index = (index + 1) % 10;
+        uitest::frame();
+    }
+}
+
+BENCHMARK(DeclarativeForSingleItemUpdate)->Arg(1000)->Arg(100000)->Unit(benchmark::kMicrosecond);
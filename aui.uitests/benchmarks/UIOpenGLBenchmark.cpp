@@ -36,11 +36,15 @@ static void OpenGLRendering(benchmark::State& state) {
     window->setContents(declarative::Centered { uiBenchmarkScene() });
     window->pack();
 
-    AUI_ASSERT(dynamic_cast<OpenGLRenderer*>(&AWindow::current()->getRenderingContext()->renderer()));
+    auto renderer = dynamic_cast<OpenGLRenderer*>(&AWindow::current()->getRenderingContext()->renderer());
+    AUI_ASSERT(renderer);
 
     for (auto _ : state) {
         window->redraw();
     }
+    // statistics of the last frame
+    state.counters["batchedRectangles"] = double(renderer->batchStatistics().rectangles);
+    state.counters["batchDrawCalls"] = double(renderer->batchStatistics().drawCalls);
     PngImageLoader::save(AFileOutputStream("benchmark_OpenGLRendering.png"), window->getRenderingContext()->makeScreenshot());
 }
 
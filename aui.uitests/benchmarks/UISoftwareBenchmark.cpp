@@ -0,0 +1,57 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+#include "UIBenchmarkScene.h"
+#include "AUI/Platform/ARenderingContextOptions.h"
+#include "AUI/Platform/SoftwareRenderingContext.h"
+#include "AUI/Image/png/PngImageLoader.h"
+#include "AUI/Software/SoftwareRenderer.h"
+
+/**
+ * @param state range(0) enables tiled rendering.
+ */
+static void SoftwareRendering(benchmark::State& state) {
+    const bool tiled = state.range(0) != 0;
+    ARenderingContextOptions::set({
+      .initializationOrder {
+        ARenderingContextOptions::Software { .tiled = tiled },
+      },
+      .flags = ARenderContextFlags::NO_SMOOTH | ARenderContextFlags::NO_VSYNC,
+    });
+
+    _<AWindow> window;
+    try {
+        window = _new<AWindow>();
+        window->show();
+    } catch (const AException& e) {
+        ALogger::info("SoftwareRendering") << "Display is not available; skipping test\n" << e;
+        return;
+    }
+
+    window->setContents(declarative::Centered { uiBenchmarkScene() });
+    window->pack();
+
+    auto context = dynamic_cast<SoftwareRenderingContext*>(window->getRenderingContext().get());
+    if (!context) {
+        state.SkipWithError("software rendering is not available");
+        return;
+    }
+    AUI_ASSERT(context->isTiledRendering() == tiled);
+
+    for (auto _ : state) {
+        window->redraw();
+    }
+    PngImageLoader::save(AFileOutputStream(tiled ? "benchmark_SoftwareRenderingTiled.png" : "benchmark_SoftwareRendering.png"),
+                         context->makeScreenshot());
+}
+
+BENCHMARK(SoftwareRendering)->Arg(0)->Arg(1);
@@ -13,6 +13,9 @@
 #include "UIBenchmarkScene.h"
 #include "AUI/UITest.h"
 #include "AUI/Util/AStubWindowManager.h"
+#include "AUI/Layout/AHorizontalLayout.h"
+#include "AUI/Layout/AVerticalLayout.h"
+#include "AUI/View/ALabel.h"
 
 namespace {
 
@@ -119,3 +122,45 @@ static void UIStyleLegacy(benchmark::State& state) {
 }
 
 BENCHMARK(UIStyleLegacy);
+
+static void UIStyleInflate(benchmark::State& state) {
+    // Measures style resolution of a freshly inflated view tree against a stylesheet with many rules.
+    //
+    // Rules are looked up by their rightmost simple selector (type, class or universal), and views having the same
+    // types, ASS classes and parents share the resolved rule list, so the cost should be nearly independent of the
+    // rule count.
+
+    uitest::setup();
+
+    AStubWindowManager::setConfig({
+      .renderer = std::make_unique<StubRenderer>(),
+    });
+
+    auto window = _new<AWindow>();
+    auto stylesheet = _new<AStylesheet>(AStylesheet {});
+    for (int i = 0; i < 500; ++i) {
+        stylesheet->addRule({ ass::c(".unused{}"_format(i)), ass::BackgroundSolid { AColor::RED } });
+        stylesheet->addRule({ ass::c(".row") > ass::c(".unused{}"_format(i)), ass::MinSize { 1_dp } });
+    }
+    stylesheet->addRule({ ass::c(".row") > ass::c(".cell"), ass::BackgroundSolid { AColor::GREEN } });
+    window->setExtraStylesheet(std::move(stylesheet));
+    window->show();
+
+    for (auto _2 : state) {
+        auto contents = _new<AViewContainer>();
+        contents->setLayout(std::make_unique<AVerticalLayout>());
+        for (int i = 0; i < state.range(0) / 10; ++i) {
+            auto row = _new<AViewContainer>();
+            row->setLayout(std::make_unique<AHorizontalLayout>());
+            row->addAssName(".row");
+            for (int j = 0; j < 10; ++j) {
+                row->addView(_new<ALabel>("cell") AUI_LET { it->addAssName(".cell"); });
+            }
+            contents->addView(std::move(row));
+        }
+        window->setContents(contents);
+        uitest::frame();
+    }
+}
+
+BENCHMARK(UIStyleInflate)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,101 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include "AUI/UITest.h"
+#include "AUI/Util/UIBuildingHelpers.h"
+#include "AUI/View/AScrollArea.h"
+#include "AUI/View/ATextArea.h"
+
+namespace {
+/**
+ * @brief Log-like document of the specified size in bytes.
+ */
+AString makeDocument(std::size_t size) {
+    AString result;
+    result.reserve(size);
+    for (int line = 0; result.length() < size; ++line) {
+        result += "[{}] lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor\n"_format(line);
+    }
+    return result;
+}
+
+struct TextAreaScene {
+    _<AWindow> window = _new<AWindow>();
+    _<ATextArea> textArea = _new<ATextArea>();
+
+    TextAreaScene() {
+        window->setContents(declarative::Centered {
+          AScrollArea::Builder().withContents(textArea).build() AUI_OVERRIDE_STYLE { ass::FixedSize { 600_dp, 400_dp } },
+        });
+        window->pack();
+        window->show();
+        uitest::frame();
+    }
+};
+}   // namespace
+
+static void TextAreaLoad(benchmark::State& state) {
+    // Measures opening of a multi-MB document: parsing, wrapping of all paragraphs and preparing glyphs of the visible
+    // part of the text.
+    uitest::setup();
+    TextAreaScene scene;
+    const auto document = makeDocument(state.range(0));
+
+    for (auto _2 : state) {
+        scene.textArea->setText(document);
+        uitest::frame();
+    }
+    state.SetBytesProcessed(state.iterations() * document.length());
+}
+
+BENCHMARK(TextAreaLoad)->Arg(1 << 20)->Arg(4 << 20)->Unit(benchmark::kMillisecond);
+
+static void TextAreaAppend(benchmark::State& state) {
+    // Measures appending a line to the end of a multi-MB document. Only the edited paragraph is expected to be
+    // re-wrapped.
+    uitest::setup();
+    TextAreaScene scene;
+    auto document = makeDocument(state.range(0));
+    scene.textArea->setText(document);
+    uitest::frame();
+
+    std::size_t length = document.length();
+    for (auto _2 : state) {
+        scene.textArea->setSelection(int(length));
+        scene.textArea->paste("appended line\n");
+        length += std::string_view("appended line\n").length();
+        uitest::frame();
+    }
+}
+
+BENCHMARK(TextAreaAppend)->Arg(4 << 20)->Unit(benchmark::kMicrosecond);
+
+static void TextAreaRandomInsert(benchmark::State& state) {
+    // Measures typing at random places of a multi-MB document.
+    uitest::setup();
+    TextAreaScene scene;
+    auto document = makeDocument(state.range(0));
+    scene.textArea->setText(document);
+    uitest::frame();
+
+    std::mt19937 random(0);
+    std::size_t length = document.length();
+    for (auto _2 : state) {
+        scene.textArea->setSelection(int(std::uniform_int_distribution<std::size_t>(0, length)(random)));
+        scene.textArea->paste("word ");
+        length += std::string_view("word ").length();
+        uitest::frame();
+    }
+}
+
+BENCHMARK(TextAreaRandomInsert)->Arg(4 << 20)->Unit(benchmark::kMicrosecond);
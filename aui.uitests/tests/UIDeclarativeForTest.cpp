@@ -666,3 +666,149 @@ TEST_F(UIDeclarativeForTest, IntGroupingDynamic1) {
     saveScreenshot("");
     EXPECT_EQ(cache<AForEachUI<int>>().size(), 0);
 }
+
+TEST_F(UIDeclarativeForTest, KeyedReconciliation) {
+    struct State {
+        AProperty<AVector<int>> ints = AVector<int> { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    };
+    auto state = _new<State>();
+    auto testObserver = &mTestObserver;
+    EXPECT_CALL(mTestObserver, onViewCreated(testing::_)).Times(testing::AtLeast(10));
+
+    mWindow->setContents(Vertical {
+      AUI_DECLARATIVE_FOR(i, *state->ints, AVerticalLayout) {
+          testObserver->onViewCreated("{}"_format(i));
+          return Label { "{}"_format(i) };
+      } AUI_LET {
+          it->setKeyFunction([](int k) { return std::size_t(k); });
+      },
+    });
+    uitest::frame();
+
+    auto labels = [] {
+        AMap<AString, _<AView>> result;
+        for (const auto& view : By::type<ALabel>().toVector()) {
+            result[*_cast<ALabel>(view)->text()] = view;
+        }
+        return result;
+    };
+    auto texts = [] {
+        AStringVector result;
+        for (const auto& view : By::type<ALabel>().toVector()) {
+            result << *_cast<ALabel>(view)->text();
+        }
+        return result;
+    };
+    const auto before = labels();
+
+    // insertion, removal and a move at once; only the inserted item is instantiated.
+    testing::Mock::VerifyAndClearExpectations(&mTestObserver);
+    EXPECT_CALL(mTestObserver, onViewCreated(testing::_)).Times(0);
+    EXPECT_CALL(mTestObserver, onViewCreated("42"_as));
+    {
+        auto write = state->ints.writeScope();
+        write->removeAll(3);
+        std::swap((*write)[6], (*write)[7]);
+        write->insert(write->begin(), 42);
+    }
+    uitest::frame();
+
+    EXPECT_EQ(texts(), (AStringVector { "42", "0", "1", "2", "4", "5", "6", "8", "7", "9" }));
+    auto after = labels();
+    for (const auto& [text, view] : before) {
+        if (text == "3") {
+            continue;
+        }
+        EXPECT_EQ(after[text], view) << text;
+    }
+    EXPECT_EQ(before.at("3")->getParent(), nullptr);
+    EXPECT_EQ(cache<AForEachUI<int>>().size(), 0);
+}
+
+TEST_F(UIDeclarativeForTest, KeyedReconciliationWindowed) {
+    struct State {
+        AProperty<AVector<int>> ints = [] {
+            AVector<int> result;
+            for (int i = 0; i < 1000; ++i) {
+                result << i;
+            }
+            return result;
+        }();
+    };
+    auto state = _new<State>();
+    _<AScrollArea> scrollArea;
+
+    mWindow->setContents(Vertical {
+      scrollArea = AScrollArea::Builder()
+              .withContents(
+              AUI_DECLARATIVE_FOR(i, *state->ints, AVerticalLayout) {
+                  return Label { "{}"_format(i) };
+              } AUI_LET {
+                  it->setKeyFunction([](int k) { return std::size_t(k); });
+              })
+              .build() AUI_OVERRIDE_STYLE { FixedSize { 150_dp, 200_dp } },
+    });
+    uitest::frame();
+
+    auto presented = [] {
+        AVector<std::pair<int, _<AView>>> result;
+        for (const auto& view : By::type<ALabel>().toVector()) {
+            result << std::make_pair(_cast<ALabel>(view)->text()->toIntOrException(), view);
+        }
+        return result;
+    };
+
+    // presented views must form a contiguous window of the model, in the model's order.
+    auto validateWindow = [&] {
+        const auto& ints = *state->ints;
+        auto views = presented();
+        ASSERT_FALSE(views.empty());
+        auto first = std::find(ints.begin(), ints.end(), views.first().first);
+        ASSERT_NE(first, ints.end());
+        ASSERT_LE(views.size(), std::size_t(std::distance(first, ints.end())));
+        for (std::size_t i = 0; i < views.size(); ++i) {
+            EXPECT_EQ(views[i].first, *(first + i)) << "at " << i;
+        }
+    };
+
+    int nextValue = 1000;
+    for (int step = 0; step < 10; ++step) {
+        scrollArea->scroll({ 0, 300 });
+        uitest::frame();
+        validateWindow();
+
+        const auto before = presented();
+        ASSERT_GE(before.size(), 3);
+        const auto removed = before[2].first;
+        const auto inserted = nextValue++;
+        {
+            auto write = state->ints.writeScope();
+            // an item before the window is removed, so the window's first index shifts...
+            write->erase(write->begin());
+            // ...and the window itself is changed.
+            write->insert(std::find(write->begin(), write->end(), before[1].first), inserted);
+            write->removeFirst(removed);
+        }
+        uitest::frame();
+        validateWindow();
+
+        AMap<int, _<AView>> after;
+        for (auto& [value, view] : presented()) {
+            after[value] = std::move(view);
+        }
+        // the window follows the presented items instead of jumping to the beginning of the model.
+        EXPECT_TRUE(after.contains(before.first().first)) << "step " << step;
+        EXPECT_TRUE(after.contains(inserted)) << "step " << step;
+        EXPECT_FALSE(after.contains(removed)) << "step " << step;
+        EXPECT_EQ(before[2].second->getParent(), nullptr) << "step " << step;
+        for (const auto& [value, view] : before) {
+            if (auto it = after.contains(value)) {
+                EXPECT_EQ(it->second, view) << "the view of " << value << " is expected to be kept, step " << step;
+            }
+        }
+    }
+
+    // the window has moved away from the beginning of the model.
+    EXPECT_NE(presented().first().first, state->ints->first());
+    EXPECT_EQ(cache<AForEachUI<int>>().size(), 0);
+}
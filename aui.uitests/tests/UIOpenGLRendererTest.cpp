@@ -58,3 +58,61 @@ TEST_F(UIOpenGLRendererTest, CheckRenderer) {
     });
     By::name(".test").check(averageColor(AColor::RED));
 }
+
+TEST_F(UIOpenGLRendererTest, BatchedRectanglesMatchUnbatched) {
+    auto& renderer = dynamic_cast<OpenGLRenderer&>(mWindow->getRenderingContext()->renderer());
+
+    // overlapping, semi-transparent and rounded rectangles; borders between them break the batch, so the draw order
+    // across batches matters as well.
+    _<AViewContainer> rows = Vertical {};
+    for (int row = 0; row < 6; ++row) {
+        _<AViewContainer> cells = Horizontal {};
+        for (int column = 0; column < 8; ++column) {
+            const auto i = row * 8 + column;
+            const AColor color(float(column % 4) / 3.f, float(row % 3) / 2.f, float(i % 5) / 4.f,
+                               i % 3 == 0 ? 0.5f : 1.f);
+            cells->addView(Stacked {
+              _new<AView>() AUI_OVERRIDE_STYLE {
+                FixedSize { 24_dp },
+                BackgroundSolid { color },
+                BorderRadius { 4_dp * float(i % 4) },
+              },
+              _new<AView>() AUI_OVERRIDE_STYLE {
+                FixedSize { 14_dp },
+                BackgroundSolid { AColor(1.f, 1.f, 1.f, 0.5f) },
+                BorderRadius { 7_dp },
+                Border { i % 2 == 0 ? 1_dp : 0_dp, AColor::BLACK },
+              },
+            });
+        }
+        rows->addView(cells);
+    }
+    mWindow->setContents(Centered { rows });
+
+    auto render = [&](bool batching) {
+        renderer.setBatchingEnabled(batching);
+        mWindow->redraw();
+        uitest::frame();
+        return ScreenshotAnalyzer::makeScreenshot().image();
+    };
+    auto batched = render(true);
+    EXPECT_GT(renderer.batchStatistics().rectangles, 0);
+    EXPECT_LT(renderer.batchStatistics().drawCalls, renderer.batchStatistics().rectangles);
+    auto unbatched = render(false);
+    EXPECT_EQ(renderer.batchStatistics().rectangles, 0);
+    renderer.setBatchingEnabled(true);
+
+    ASSERT_EQ(batched.size(), unbatched.size());
+    // positions are transformed on the CPU in the batched path; allow rounding differences only.
+    static constexpr float TOLERANCE = 2.f / 255.f;
+    std::size_t mismatches = 0;
+    for (unsigned y = 0; y < batched.height(); ++y) {
+        for (unsigned x = 0; x < batched.width(); ++x) {
+            const glm::vec4 diff = glm::abs(glm::vec4(batched.get({ x, y })) - glm::vec4(unbatched.get({ x, y })));
+            if (glm::any(glm::greaterThan(diff, glm::vec4(TOLERANCE)))) {
+                ++mismatches;
+            }
+        }
+    }
+    EXPECT_EQ(mismatches, 0);
+}
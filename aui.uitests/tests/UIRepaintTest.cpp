@@ -238,3 +238,65 @@ TEST_F(UIRepaintTest, SurroundingRepaint2) {
         AUI_REPEAT(10) { uitest::frame(); }
     }
 }
+
+namespace {
+    class DamageWindow: public AWindow {
+    public:
+        using AWindow::takeDamage;
+    };
+}
+
+TEST_F(UIRepaintTest, Damage) {
+    auto window = _new<DamageWindow>();
+    auto label = _new<ALabel>("test");
+    mWindow = window;
+    ALayoutInflater::inflate(mWindow, Centered { Vertical { label, Label { "another label" } } });
+    mWindow->show();
+    AUI_REPEAT(10) { uitest::frame(); }
+
+    // damage covers the view that requested redraw but not the whole window
+    label->redraw();
+    auto damage = window->takeDamage(true);
+    ASSERT_TRUE(damage);
+    EXPECT_TRUE(glm::all(glm::lessThanEqual(damage->p1, label->getPositionInWindow())));
+    EXPECT_TRUE(glm::all(glm::greaterThanEqual(damage->p2, label->getPositionInWindow() + label->getSize())));
+    EXPECT_LT(damage->area(), window->getWidth() * window->getHeight());
+
+    // the frame can't be repainted partially without the previous one
+    AUI_REPEAT(10) { uitest::frame(); }
+    label->redraw();
+    EXPECT_FALSE(window->takeDamage(false));
+
+    // layout update
+    AUI_REPEAT(10) { uitest::frame(); }
+    label->text() = "some other text";
+    EXPECT_FALSE(window->takeDamage(true));
+}
+
+TEST_F(UIRepaintTest, HideShow) {
+    auto window = _new<DamageWindow>();
+    auto label = _new<LabelMock>("test");
+    mWindow = window;
+    ALayoutInflater::inflate(mWindow, Centered { Vertical { label, Label { "another label" } } });
+    mWindow->show();
+    AUI_REPEAT(10) { uitest::frame(); }
+
+    label->setVisibility(Visibility::INVISIBLE);
+    AUI_REPEAT(10) { uitest::frame(); }
+
+    // the view was not drawn while hidden; showing it must damage its area again
+    label->setVisibility(Visibility::VISIBLE);
+    auto damage = window->takeDamage(true);
+    ASSERT_TRUE(damage);
+    EXPECT_TRUE(glm::all(glm::lessThanEqual(damage->p1, label->getPositionInWindow())));
+    EXPECT_TRUE(glm::all(glm::greaterThanEqual(damage->p2, label->getPositionInWindow() + label->getSize())));
+    AUI_REPEAT(10) { uitest::frame(); }
+
+    // the view is actually drawn after hide followed by show
+    label->setVisibility(Visibility::INVISIBLE);
+    AUI_REPEAT(10) { uitest::frame(); }
+
+    EXPECT_CALL(*label, renderMock).Times(testing::AtLeast(1));
+    label->setVisibility(Visibility::VISIBLE);
+    AUI_REPEAT(10) { uitest::frame(); }
+}
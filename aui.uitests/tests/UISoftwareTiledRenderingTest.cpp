@@ -0,0 +1,67 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstring>
+#include <AUI/UITest.h>
+#include <AUI/Util/UIBuildingHelpers.h>
+#include <AUI/View/AButton.h>
+#include <AUI/View/AScrollArea.h>
+#include <AUI/Util/AStubWindowManager.h>
+#include <AUI/Platform/SoftwareRenderingContext.h>
+
+using namespace declarative;
+using namespace ass;
+
+/**
+ * Checks that tiled software rendering produces exactly the same frame as the immediate one.
+ */
+class UISoftwareTiledRendering: public testing::UITest {};
+
+TEST_F(UISoftwareTiledRendering, SameAsImmediate) {
+    auto window = _new<AWindow>();
+    // spans several tiles in both directions; primitives intentionally cross tile boundaries.
+    window->setContents(Vertical {
+      Horizontal {
+        _new<AButton>("Default button") AUI_LET { it->setDefault(); },
+        _new<AButton>("Common button"),
+        Label { "Label crossing the tile boundary" } AUI_OVERRIDE_STYLE {
+            BackgroundSolid { 0x80ff0000_argb },
+            BorderRadius { 8_dp },
+        },
+      },
+      Label { "Shadow" } AUI_OVERRIDE_STYLE {
+          FixedSize { 200_dp, 100_dp },
+          BackgroundSolid { 0xffffff_rgb },
+          BoxShadow { 0, 4_dp, 24_dp, 0x80000000_argb },
+          Border { 3_dp, 0x0000ff_rgb },
+          BorderRadius { 16_dp },
+      },
+      AScrollArea::Builder().withContents(Vertical {
+        Label { "Masked 1" },
+        Label { "Masked 2" },
+        Label { "Masked 3" },
+        Label { "Masked 4" },
+      }).build() AUI_OVERRIDE_STYLE { FixedSize { 150_dp, 40_dp }, BorderRadius { 10_dp } },
+    } AUI_OVERRIDE_STYLE { MinSize { 300_dp, 300_dp } });
+    window->show();
+
+    auto context = dynamic_cast<SoftwareRenderingContext*>(window->getRenderingContext().get());
+    ASSERT_NE(context, nullptr);
+
+    auto immediate = AStubWindowManager::makeScreenshot(window);
+    context->setTiledRendering(true);
+    auto tiled = AStubWindowManager::makeScreenshot(window);
+
+    ASSERT_EQ(immediate.size(), tiled.size());
+    EXPECT_GT(immediate.size().x, SoftwareRenderer::TILE_SIZE);
+    EXPECT_GT(immediate.size().y, SoftwareRenderer::TILE_SIZE);
+    EXPECT_EQ(std::memcmp(immediate.data(), tiled.data(), immediate.buffer().size()), 0);
+}
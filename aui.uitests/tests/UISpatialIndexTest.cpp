@@ -0,0 +1,112 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gmock/gmock.h>
+#include <AUI/UITest.h>
+#include <AUI/Util/UIBuildingHelpers.h>
+#include <AUI/Layout/AAbsoluteLayout.h>
+#include <AUI/View/AScrollArea.h>
+
+using namespace declarative;
+
+/**
+ * Checks that containers with the spatial index enabled render and hit-test exactly the same views as without it.
+ */
+
+namespace {
+class ViewMock : public AView {
+public:
+    MOCK_METHOD(void, render, (ARenderContext), ());
+};
+
+class UISpatialIndexTest : public testing::UITest {
+protected:
+    static constexpr int COLUMNS = 40;
+    static constexpr int ROWS = 25;
+    static constexpr int STEP = 50;
+    static constexpr int SIZE = 40;
+
+    void SetUp() override {
+        UITest::SetUp();
+
+        mCanvas = _new<AViewContainer>();
+        mCanvas->setLayout(std::make_unique<AAbsoluteLayout>());
+        mCanvas->setSpatialIndexEnabled(true);
+        for (int y = 0; y < ROWS; ++y) {
+            for (int x = 0; x < COLUMNS; ++x) {
+                auto view = _new<ViewMock>();
+                mCanvas->addView(view);
+                mViews << view;
+            }
+        }
+
+        mWindow = _new<AWindow>();
+        mWindow->setContents(Centered {
+          mScroll = AScrollArea::Builder().withContents(mCanvas).build() AUI_OVERRIDE_STYLE { ass::FixedSize(200_px) },
+        });
+        mWindow->pack();
+        mWindow->show();
+        uitest::frame();
+
+        for (int i = 0; i < int(mViews.size()); ++i) {
+            mViews[i]->setGeometry((i % COLUMNS) * STEP, (i / COLUMNS) * STEP, SIZE, SIZE);
+        }
+        uitest::frame();
+    }
+
+    void TearDown() override {
+        mWindow = nullptr;
+        UITest::TearDown();
+    }
+
+    void expectSameViewsAt(AVector<glm::ivec2> points) {
+        for (auto point : points) {
+            mCanvas->setSpatialIndexEnabled(false);
+            auto expected = mCanvas->getViewAt(point);
+            mCanvas->setSpatialIndexEnabled(true);
+            EXPECT_EQ(mCanvas->getViewAt(point), expected) << point.x << ", " << point.y;
+        }
+    }
+
+    _<AWindow> mWindow;
+    _<AScrollArea> mScroll;
+    _<AViewContainer> mCanvas;
+    AVector<_<ViewMock>> mViews;
+};
+}   // namespace
+
+TEST_F(UISpatialIndexTest, HitTest) {
+    EXPECT_EQ(mCanvas->getViewAt({ 10, 10 }), mViews[0]);
+    EXPECT_EQ(mCanvas->getViewAt({ STEP + 10, 10 }), mViews[1]);
+    expectSameViewsAt({ { 0, 0 }, { SIZE - 1, SIZE - 1 }, { SIZE, SIZE }, { 333, 777 }, { 1999, 1249 } });
+
+    // moving a view updates the index
+    mViews[0]->setPosition({ 1042, 1042 });
+    EXPECT_EQ(mCanvas->getViewAt({ 10, 10 }), nullptr);
+    EXPECT_EQ(mCanvas->getViewAt({ 1045, 1045 }), mViews[0]); // in the gap between the views of the grid
+    expectSameViewsAt({ { 10, 10 }, { 1045, 1045 }, { 1060, 1060 } });
+}
+
+TEST_F(UISpatialIndexTest, Culling) {
+    // the scroll area shows the top left corner of the canvas; the views far away are not rendered.
+    for (const auto& view : mViews) {
+        const auto position = view->getPosition();
+        if (position.x < 150 && position.y < 150) {
+            EXPECT_CALL(*view, render(testing::_)).Times(testing::AtLeast(1));
+        } else if (position.x >= 300 || position.y >= 300) {
+            EXPECT_CALL(*view, render(testing::_)).Times(0);
+        } else {
+            EXPECT_CALL(*view, render(testing::_)).Times(testing::AnyNumber());
+        }
+    }
+    mWindow->redraw();
+    uitest::frame();
+}
@@ -192,3 +192,55 @@ TEST_F(UIStyleTest, Merge) {
     By::type<View>().check(pixelColorAt({0.f, 0.5f}, AColor::BLACK)); // outside of cross
     By::type<View>().check(pixelColorAt({0.5f, 0.5f}, AColor::RED)); // within cross, overlayed by red
 }
+
+TEST_F(UIStyleTest, IndexedRules) {
+    using namespace ass;
+
+    _<AView> first, second, other, button;
+    mWindow->setContents(Vertical {
+      Horizontal {
+        first = _new<View>() AUI_LET { it->addAssName(".item"); },
+        second = _new<View>() AUI_LET { it->addAssName(".item"); },
+        other = _new<View>() AUI_LET { it->addAssName(".other"); },
+      } AUI_LET { it->addAssName(".row"); },
+      button = Button { Label { "Button" } },
+    });
+    mWindow->setExtraStylesheet(AStylesheet {
+      { t<View>(), MinSize { 1_dp } },
+      { c(".item"), MinSize { 2_dp } },
+      { c(".row") > c(".item"), MinSize { 3_dp } },
+      { c(".row") >> t<View>(), MinSize { 4_dp } },
+      { c(".item") && !c(".other"), MinSize { 5_dp } },
+      { !c(".item"), MinSize { 6_dp } },
+      { { t<AButton>(), c(".other") }, MinSize { 7_dp } },
+      { button::Default(t<AButton>()), MinSize { 8_dp } },
+    });
+    uitest::frame();
+
+    // candidate rules are looked up by the rightmost simple selector; the result must be the same as checking each
+    // rule.
+    auto selectors = [](auto&& rules) {
+        AVector<const IAssSubSelector*> result;
+        for (const ass::Rule& r : rules) {
+            result << r.getSelector().getSubSelectors().first().get();
+        }
+        return result;
+    };
+    for (const auto& view : { first, second, other, button, mWindow->getViews().first() }) {
+        AVector<ass::Rule> expected;
+        for (const AStylesheet* sh : { &AStylesheet::global(), mWindow->extraStylesheet().get() }) {
+            for (const auto& r : sh->getRules()) {
+                if (r.getSelector().isPossiblyApplicable(view.get())) {
+                    expected << r;
+                }
+            }
+        }
+        EXPECT_EQ(selectors(view->getAssHelper()->getPossiblyApplicableRules()), selectors(expected));
+    }
+
+    // views with the same types, classes and parents share the rule list.
+    EXPECT_EQ(&first->getAssHelper()->getPossiblyApplicableRules(),
+              &second->getAssHelper()->getPossiblyApplicableRules());
+    EXPECT_NE(&first->getAssHelper()->getPossiblyApplicableRules(),
+              &other->getAssHelper()->getPossiblyApplicableRules());
+}
@@ -363,3 +363,61 @@ TEST_F(UITextArea, NextLineCursorPos) {
     mTextArea->moveCursorLeft();
     EXPECT_EQ(mTextArea->getCursorPosition().y, 0);
 }
+
+TEST_F(UITextArea, EraseFuzzyMultiline) {
+    const std::string_view SAMPLE = "a\nbc\n\nd e\n";
+    for (unsigned i = 0; i <= SAMPLE.length(); ++i) {
+        for (unsigned j = i; j <= SAMPLE.length(); ++j) {
+            AString expected = SAMPLE;
+            mTextArea->setText(expected);
+            if (i == j) { // non selection mode; just cursor hit backspace
+                if (i > 0) { // at beginning backspace does not take effect.
+                    expected.erase(i - 1, 1);
+                }
+            } else {
+                expected.erase(i, j - i);
+            }
+            mTextArea->setSelection({i, j});
+            auto selection = mTextArea->selection();
+            By::type<ATextArea>().perform(keyDownAndUp(AInput::BACKSPACE));
+            ASSERT_EQ(mTextArea->text(), expected) << "(cursor was at " << selection << ")";
+        }
+    }
+}
+
+TEST_F(UITextArea, InsertMultiline) {
+    const std::string_view SAMPLE = "a\nbc\n\nd e\n";
+    const std::string_view SAMPLE_PASTE = "x\ny ";
+    for (unsigned i = 0; i <= SAMPLE.length(); ++i) {
+        mTextArea->setText(SAMPLE);
+        mTextArea->setSelection(i);
+        mTextArea->paste(SAMPLE_PASTE);
+        AString expectedString = SAMPLE;
+        expectedString.insert(i, SAMPLE_PASTE);
+
+        EXPECT_EQ(mTextArea->text(), expectedString) << "(insert at " << i << ")";
+    }
+}
+
+TEST_F(UITextArea, LinePositions) {
+    mTextArea->setText("first\n\nthird");
+    const auto first = mTextArea->getPosByIndex(0);
+    const auto second = mTextArea->getPosByIndex(6);
+    const auto third = mTextArea->getPosByIndex(7);
+    EXPECT_LT(first.y, second.y);
+    EXPECT_LT(second.y, third.y);
+    EXPECT_EQ(second.x, first.x);
+    EXPECT_EQ(third.x, first.x);
+
+    // editing a line does not move the lines below
+    mTextArea->setSelection(5);
+    By::type<ATextArea>().perform(type("!"));
+    EXPECT_EQ(mTextArea->text(), "first!\n\nthird");
+    EXPECT_EQ(mTextArea->getPosByIndex(8), third);
+
+    // erasing a line break merges the lines
+    mTextArea->setSelection(8);
+    By::type<ATextArea>().perform(keyDownAndUp(AInput::BACKSPACE));
+    EXPECT_EQ(mTextArea->text(), "first!\nthird");
+    EXPECT_EQ(mTextArea->getPosByIndex(7), second);
+}
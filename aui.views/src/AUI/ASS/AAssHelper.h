@@ -33,7 +33,10 @@ class AAssHelper: public AObject {
     friend class AView;
 
 private:
-    AVector<ass::Rule> mPossiblyApplicableRules;
+    /**
+     * @brief Shared between views with the same types, ASS classes and stylesheets in the parent chain.
+     */
+    _<const AVector<ass::Rule>> mPossiblyApplicableRules;
 
 public:
     void onInvalidateFullAss() {
@@ -45,7 +48,11 @@ public:
 
     [[nodiscard]]
     const AVector<ass::Rule>& getPossiblyApplicableRules() const {
-        return mPossiblyApplicableRules;
+        if (!mPossiblyApplicableRules) {
+            static const AVector<ass::Rule> empty;
+            return empty;
+        }
+        return *mPossiblyApplicableRules;
     }
 
     struct State {
@@ -46,6 +46,8 @@
 #include "AUI/View/ATextArea.h"
 #include "AUI/View/ASpinnerV2.h"
 #include "AUI/View/ATextField.h"
+#include "AUI/Traits/callables.h"
+#include <atomic>
 
 AStylesheet::AStylesheet() {
     using namespace ass;
@@ -696,3 +698,51 @@ _<AStylesheet>& AStylesheet::globalStorage() {
     static _<AStylesheet> s = _new<AStylesheet>();
     return s;
 }
+
+std::uint64_t AStylesheet::nextRevision() {
+    static std::atomic_uint64_t revision = 0;
+    return ++revision;
+}
+
+AVector<std::size_t> AStylesheet::candidateRules(AView* view) const {
+    if (!mIndex) {
+        mIndex = Index {};
+        auto& index = *mIndex;
+        for (std::size_t i = 0; i < mRules.size(); ++i) {
+            for (const auto& subSelector : mRules[i].getSelector().getSubSelectors()) {
+                std::visit(aui::lambda_overloaded {
+                    [&](const ass::IndexKey::Universal&) { index.universal << i; },
+                    [&](const ass::IndexKey::Type& type) { index.byType << std::make_pair(type.matches, i); },
+                    [&](const ass::IndexKey::Class& classes) {
+                        for (const auto& name : classes.classes) {
+                            index.byClass[name] << i;
+                        }
+                    },
+                }, subSelector->indexKey().value);
+            }
+        }
+    }
+
+    auto& index = *mIndex;
+    auto byType = index.byDynamicType.find(typeid(*view));
+    if (byType == index.byDynamicType.end()) {
+        AVector<std::size_t> matching;
+        for (const auto& [matches, i] : index.byType) {
+            if (matches(view)) {
+                matching << i;
+            }
+        }
+        byType = index.byDynamicType.emplace(typeid(*view), std::move(matching)).first;
+    }
+
+    AVector<std::size_t> result = index.universal;
+    result.insert(result.end(), byType->second.begin(), byType->second.end());
+    for (const auto& name : view->getAssNames()) {
+        if (auto byClass = index.byClass.find(name); byClass != index.byClass.end()) {
+            result.insert(result.end(), byClass->second.begin(), byClass->second.end());
+        }
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
@@ -16,12 +16,37 @@
 #pragma once
 
 #include <initializer_list>
+#include <typeindex>
+#include <unordered_map>
 #include "Rule.h"
 
 class API_AUI_VIEWS AStylesheet {
 private:
+    /**
+     * @brief Rule indices bucketed by the rightmost simple selector of each alternative of the rule's selector.
+     */
+    struct Index {
+        AVector<std::size_t> universal;
+        std::unordered_map<AString, AVector<std::size_t>> byClass;
+        AVector<std::pair<bool (*)(AView*), std::size_t>> byType;
+
+        /**
+         * @brief byType resolved for the dynamic types of the views met so far.
+         */
+        std::unordered_map<std::type_index, AVector<std::size_t>> byDynamicType;
+    };
+
     AVector<ass::Rule> mRules;
     bool mIgnoreRules = false;
+    std::uint64_t mRevision = nextRevision();
+    mutable AOptional<Index> mIndex;
+
+    void onRulesChanged() {
+        mRevision = nextRevision();
+        mIndex.reset();
+    }
+
+    static std::uint64_t nextRevision();
 
 public:
     AStylesheet();
@@ -37,6 +62,7 @@ public:
             auto& rule = const_cast<ass::Rule&>(constRule);
             mRules << std::move(rule);
         }
+        onRulesChanged();
     }
 
     void addRule(const ass::Rule& r) {
@@ -44,6 +70,7 @@ public:
             return;
         }
         mRules << r;
+        onRulesChanged();
     }
 
 
@@ -52,6 +79,7 @@ public:
             return;
         }
         mRules << std::forward<ass::Rule>(r);
+        onRulesChanged();
     }
 
     void setIgnoreRules(bool ignoreRules) {
@@ -63,12 +91,31 @@ public:
         return mRules;
     }
 
+    /**
+     * @brief Identifies the current set of rules.
+     * @details
+     * Revisions are unique across all stylesheets; the revision changes each time the rules are changed.
+     */
+    [[nodiscard]] std::uint64_t revision() const noexcept {
+        return mRevision;
+    }
+
+    /**
+     * @brief Indices of the rules that might be possibly applicable to the view, in ascending order.
+     * @details
+     * Selects rules by the rightmost simple selector (type, ASS class or universal), like browser engines do. The
+     * result is a superset of the rules whose selector isPossiblyApplicable to the view; the caller is still expected
+     * to perform the full check.
+     */
+    [[nodiscard]] AVector<std::size_t> candidateRules(AView* view) const;
+
     static AColor getOsThemeColor();
 
     static AStylesheet& global();
 
     void setRules(AVector<ass::Rule> rules) {
         mRules = std::move(rules);
+        onRulesChanged();
     }
 
 private:
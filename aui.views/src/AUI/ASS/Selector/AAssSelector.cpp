@@ -24,6 +24,10 @@ bool ass::IAssSubSelector::isStateApplicable(AView* view) {
 void ass::IAssSubSelector::setupConnections(AView* view, const _<AAssHelper>& helper) {
 }
 
+ass::IndexKey ass::IAssSubSelector::indexKey() const {
+    return {};
+}
+
 void ass::AAssSelector::setupConnections(AView* view, const _<AAssHelper>& helper) const {
     for (const auto& s : mSubSelectors) {
         if (s->isPossiblyApplicable(view)) {
@@ -16,20 +16,73 @@
 #pragma once
 
 #include <AUI/Common/AVector.h>
+#include <AUI/Common/AStringVector.h>
 #include <AUI/Util/kAUI.h>
 #include <type_traits>
 #include <utility>
+#include <variant>
 
 class AView;
 class AAssHelper;
 
 namespace ass {
 
+    /**
+     * @brief Rightmost simple selector of a subselector.
+     * @details
+     * AStylesheet buckets rules by their index keys, so isPossiblyApplicable is called only for the rules whose
+     * rightmost simple selector matches the view.
+     */
+    struct IndexKey {
+        /**
+         * @brief The subselector should be checked against every view.
+         */
+        struct Universal {};
+
+        /**
+         * @brief The subselector applies to views of a C++ type only. matches() depends on the dynamic type of the
+         * view only.
+         */
+        struct Type {
+            bool (*matches)(AView* view);
+        };
+
+        /**
+         * @brief The subselector applies to views having one of the ASS classes only.
+         */
+        struct Class {
+            AStringVector classes;
+        };
+
+        std::variant<Universal, Type, Class> value;
+
+        [[nodiscard]]
+        bool isUniversal() const noexcept {
+            return std::holds_alternative<Universal>(value);
+        }
+    };
+
     class API_AUI_VIEWS IAssSubSelector {
     public:
+        /**
+         * @brief Checks the view against parts of the selector that do not depend on the view's state.
+         * @details
+         * The result must depend only on the C++ types and ASS classes of the view and its parents; checks that depend
+         * on the view state belong to isStateApplicable. AView caches the result and shares it between views that
+         * are equal in that regard.
+         */
         virtual bool isPossiblyApplicable(AView* view) = 0;
         virtual bool isStateApplicable(AView* view);
         virtual void setupConnections(AView* view, const _<AAssHelper>& helper);
+
+        /**
+         * @brief Index key of the subselector.
+         * @details
+         * Views not matching the key must not be possibly applicable. The default implementation returns
+         * IndexKey::Universal, which is always correct.
+         */
+        virtual IndexKey indexKey() const;
+
         virtual ~IAssSubSelector() = default;
     };
 
@@ -35,6 +35,12 @@ namespace ass {
             l.setupConnections(view, helper);
             r.setupConnections(view, helper);
         }
+
+        IndexKey indexKey() const override {
+            // both have to match; either key is correct.
+            auto key = l.indexKey();
+            return key.isUniversal() ? r.indexKey() : key;
+        }
     };
     /**
      * @brief Makes a selector that applies two selectors.
@@ -52,6 +52,10 @@ namespace ass {
             r.setupConnections(view, helper);
             l.setupConnections(parent, helper);
         }
+
+        IndexKey indexKey() const override {
+            return r.indexKey();
+        }
     };
 
     /**
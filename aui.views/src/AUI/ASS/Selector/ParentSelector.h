@@ -66,6 +66,10 @@ namespace ass {
              */
             AUI_ASSERT(0);
         }
+
+        IndexKey indexKey() const override {
+            return r.indexKey();
+        }
     };
 
     /**
@@ -67,5 +67,9 @@ namespace ass {
             view->customCssPropertyChanged.clearAllOutgoingConnectionsWith(helper.get());
             AObject::connect(view->customCssPropertyChanged, AUI_SLOT(helper)::onInvalidateStateAss);
         }
+
+        IndexKey indexKey() const override {
+            return mWrapped->indexKey();
+        }
     };
 }
\ No newline at end of file
@@ -48,6 +48,10 @@ namespace ass {
                 return isPossiblyApplicable(view);
             }
 
+            IndexKey indexKey() const override {
+                return { IndexKey::Class { mClasses } };
+            }
+
             const AStringVector& getClasses() const {
                 return mClasses;
             }
@@ -37,6 +37,10 @@ namespace ass {
                 return dynamic_cast<T*>(view) != nullptr;
             }
 
+            IndexKey indexKey() const override {
+                return { IndexKey::Type { [](AView* view) { return dynamic_cast<T*>(view) != nullptr; } } };
+            }
+
         };
     }
 
@@ -18,7 +18,7 @@
 
 void AAnimator::animate(AView* view, IRenderer& render) {
     if (mIsPlaying) {
-        AWindow::current()->flagRedraw();
+        AWindow::current()->markAllPixelDataInvalid();
         auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
                 std::chrono::high_resolution_clock::now().time_since_epoch());
 
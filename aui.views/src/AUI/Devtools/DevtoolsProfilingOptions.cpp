@@ -15,6 +15,8 @@
 #include "AUI/View/ACheckBox.h"
 #include "AUI/View/AText.h"
 #include "AUI/Platform/APlatform.h"
+#include "AUI/Platform/AFontManager.h"
+#include "AUI/View/AButton.h"
 
 using namespace ass;
 using namespace declarative;
@@ -36,6 +38,24 @@ _<AView> makeLink(AString text, AUrl destination) {
     return l;
 }
 
+_<AView> glyphCacheUsage() {
+    _<AViewContainer> fonts = Vertical {};
+    auto update = [fonts = fonts.get()] {
+        fonts->removeAllViews();
+        for (const auto& font : AFontManager::inst().loadedFonts()) {
+            const auto usage = font->memoryUsage();
+            fonts->addView(Label { "{}: {} glyphs, {} of {} KiB of bitmaps, {} evictions"_format(
+                font->getFontFamilyName(), usage.characterCount, usage.bitmapBytes / 1024,
+                font->glyphCacheBudget() / 1024, usage.evictions) });
+        }
+    };
+    update();
+    return Vertical {
+        fonts,
+        Button { Label { "Refresh" }, std::move(update) },
+    };
+}
+
 _<ALabel> header(AString title) {
     return Label { std::move(title) } AUI_OVERRIDE_STYLE { FontSize{16_pt}, Padding{0}, Margin { 4_dp, 24_dp, 8_dp } };
 }
@@ -89,6 +109,19 @@ DevtoolsProfilingOptions::DevtoolsProfilingOptions(ASurface* targetWindow) {
                 "update. When breakpoint is triggered, checkbox is unset. Note: when debugger is not attached, "
                 "behaviour is undefined." }),
           /// [fromItems]
+          CheckBox {
+            AUI_REACT(targetWindow->profiling()->highlightDamage),
+            [targetWindow](bool checked) {
+                targetWindow->profiling()->highlightDamage = checked;
+            },
+            Label { "Highlight damage" },
+          },
+          AText::fromItems(
+              { "Draws red rect ", coloredRect(0xff0000_rgb),
+                " around the area repainted by the frame. Only the invalidated area of the window is repainted and "
+                "presented when the rendering context preserves the previous frame (i.e. software rendering on "
+                "Linux). Note: while enabled, the window is repainted completely; the rect displays the area that "
+                "would be repainted otherwise." }),
 
           header("Scale"),
           Vertical {
@@ -137,6 +170,10 @@ DevtoolsProfilingOptions::DevtoolsProfilingOptions(ASurface* targetWindow) {
           AText::fromItems(
               { "Displays a horizontal line indicating the text baseline. When multiple text views are placed in a row, "
                 "their baselines should align for proper visual appearance." }),
+          glyphCacheUsage(),
+          AText::fromItems(
+              { "Memory used by the glyph cache of each font. Least recently used glyph bitmaps are evicted when the "
+                "budget (AFont::setGlyphCacheBudget) is exceeded." }),
         }
         << ".items" AUI_OVERRIDE_STYLE {
                       MaxSize { 700_dp, {} },
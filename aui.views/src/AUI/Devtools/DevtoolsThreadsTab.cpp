@@ -101,7 +101,7 @@ DevtoolsThreadsTab::DevtoolsThreadsTab(AThreadPool& targetThreadPool) {
         views->addViews({
           _new<ALabel>(thread->threadName()),
           _new<WatcherView>([thread] {
-              return thread->messageQueue().messages().size();
+              return thread->messageQueue().size();
           }) AUI_LET { connect(mUpdateTimer->fired, AUI_SLOT(it)::update); },
         });
     };
@@ -69,7 +69,11 @@ AFont::Character AFont::renderGlyph(const FontEntry& fs, AChar glyph) {
     int size = fs.first.size;
     FontRendering fr = fs.first.fr;
 
-    FT_Set_Pixel_Sizes(mFace, 0, size);
+    if (mPixelSize != unsigned(size)) {
+        // glyphs are usually requested in runs of the same size; switching sizes is not free.
+        FT_Set_Pixel_Sizes(mFace, 0, size);
+        mPixelSize = size;
+    }
 
     FT_Int32 flags = FT_LOAD_RENDER;
 
@@ -123,6 +127,7 @@ AFont::Character AFont::renderGlyph(const FontEntry& fs, AChar glyph) {
 
         return Character{
             .image = _new<AImage>(data, glm::uvec2(width, height), imageFormat),
+            .imageSize = glm::uvec2(width, height),
             .size = { div * g->metrics.width, div * g->metrics.height },
             .horizontal = {
               .bearing = { g->bitmap_left, g->bitmap_top },
@@ -138,17 +143,68 @@ AFont::Character AFont::renderGlyph(const FontEntry& fs, AChar glyph) {
 }
 
 AFont::Character& AFont::getCharacter(const FontEntry& charset, AChar glyph) {
-    auto& chars = charset.second.characters;
-    if (chars.size() > glyph && chars[glyph.codepoint()]) {
-        return *chars[glyph.codepoint()];
-    } else {
-        if (chars.size() <= glyph) {
-            chars.resize(glyph + 1, std::nullopt);
+    auto& data = charset.second;
+    auto [it, inserted] = data.characters.try_emplace(glyph.codepoint());
+    auto& entry = it->second;
+    auto& character = entry.character;
+    if (inserted) {
+        try {
+            character = renderGlyph(charset, glyph);
+        } catch (...) {
+            data.characters.erase(it);
+            throw;
         }
-        chars[glyph.codepoint()] = std::move(renderGlyph(charset, glyph));
+    } else if (character.image) {
+        mLru.splice(mLru.begin(), mLru, entry.lruPosition);
+        return character;
+    } else if (character.empty() || character.rendererData != nullptr) {
+        return character;
+    } else {
+        // the bitmap was evicted
+        character.image = renderGlyph(charset, glyph).image;
+    }
+    if (character.image) {
+        cacheBitmap(data, glyph.codepoint(), entry);
+    }
+    return character;
+}
+
+void AFont::cacheBitmap(FontData& data, char32_t codepoint, FontData::Entry& entry) {
+    const auto bytes = entry.character.image->buffer().size();
+    // at least one bitmap (the requested one) is always kept.
+    evictBitmaps(mGlyphCacheBudget > bytes ? mGlyphCacheBudget - bytes : 0);
+    mBitmapBytes += bytes;
+    mLru.emplace_front(&data, codepoint);
+    entry.lruPosition = mLru.begin();
+}
+
+void AFont::evictBitmaps(std::size_t budget) {
+    while (mBitmapBytes > budget && !mLru.empty()) {
+        auto [data, codepoint] = mLru.back();
+        mLru.pop_back();
+        auto it = data->characters.find(codepoint);
+        AUI_ASSERT(it != data->characters.end());
+        auto& image = it->second.character.image;
+        mBitmapBytes -= image->buffer().size();
+        image = nullptr;
+        ++mEvictions;
+    }
+}
+
+void AFont::setGlyphCacheBudget(std::size_t bytes) {
+    mGlyphCacheBudget = bytes;
+    evictBitmaps(bytes);
+}
 
-        return *chars[glyph.codepoint()];
+AFont::MemoryUsage AFont::memoryUsage() const noexcept {
+    MemoryUsage result {
+        .bitmapBytes = mBitmapBytes,
+        .evictions = mEvictions,
+    };
+    for (const auto& [key, data] : mCharData) {
+        result.characterCount += data.characters.size();
     }
+    return result;
 }
 
 int AFont::length(const FontEntry& charset, AStringView text) {
@@ -11,7 +11,9 @@
 
 #pragma once
 
+#include <list>
 #include <string>
+#include <AUI/Common/AMap.h>
 #include <glm/glm.hpp>
 #include <AUI/Url/AUrl.h>
 
@@ -42,9 +44,17 @@ public:
     struct Character {
         /**
          * @brief Bitmap of the glyph.
+         * @details
+         * The bitmap may be evicted from the glyph cache if it is not used for a while. AFont::getCharacter restores it
+         * unless rendererData is set.
          */
         _<AImage> image;
 
+        /**
+         * @brief Size of image in pixels. Unlike image, stays valid when the bitmap is evicted.
+         */
+        glm::uvec2 imageSize{};
+
         /**
          * @brief Glyph's image bounding box size. It's independent of the layout direction.
          */
@@ -80,11 +90,18 @@ public:
          */
         Metrics vertical{};
 
+        /**
+         * @return true, if the glyph has no bitmap (i.e. a whitespace or an unsupported character).
+         */
         [[nodiscard]]
         bool empty() const {
-            return image == nullptr;
+            return imageSize == glm::uvec2(0);
         }
 
+        /**
+         * @brief Renderer specific data. Once set, the renderer is considered to hold its own copy of the bitmap (i.e.
+         * in a texture atlas), so the image is not restored after eviction.
+         */
         void* rendererData = nullptr;
     };
 
@@ -102,10 +119,47 @@ public:
     };
 
     struct FontData {
-        AVector<AOptional<Character>> characters;
+        struct Entry {
+            Character character;
+
+            /**
+             * @brief Position in AFont's LRU list of the glyph bitmaps. Valid if character.image is set.
+             */
+            std::list<std::pair<FontData*, char32_t>>::iterator lruPosition;
+        };
+
+        /**
+         * @brief Glyphs by codepoint.
+         * @details
+         * A hash map, so a sparse set of characters (i.e. CJK or emoji) costs memory proportional to its size only.
+         * Node-based, so references to characters are stable.
+         */
+        AUnorderedMap<char32_t, Entry> characters;
         void* rendererData = nullptr;
     };
 
+    struct MemoryUsage {
+        /**
+         * @brief Count of cached glyphs, including the ones whose bitmaps were evicted.
+         */
+        std::size_t characterCount = 0;
+
+        /**
+         * @brief Bytes occupied by the glyph bitmaps held by the cache.
+         */
+        std::size_t bitmapBytes = 0;
+
+        /**
+         * @brief Count of glyph bitmaps evicted since the font was loaded.
+         */
+        std::size_t evictions = 0;
+    };
+
+    /**
+     * @brief Default value of setGlyphCacheBudget.
+     */
+    static constexpr std::size_t DEFAULT_GLYPH_CACHE_BUDGET = 4 * 1024 * 1024;
+
 
     using FontEntry = std::pair<FontKey, FontData&>;
 
@@ -117,12 +171,32 @@ private:
 
     AMap<FontKey, FontData> mCharData;
 
+    /**
+     * @brief Glyphs having a bitmap, most recently used first.
+     */
+    std::list<std::pair<FontData*, char32_t>> mLru;
+    std::size_t mGlyphCacheBudget = DEFAULT_GLYPH_CACHE_BUDGET;
+    std::size_t mBitmapBytes = 0;
+    std::size_t mEvictions = 0;
+
+    /**
+     * @brief Pixel size the face is currently set to; FT_Set_Pixel_Sizes is called only when the size changes.
+     */
+    unsigned mPixelSize = 0;
+
     FontData& getFontEntry(unsigned size, FontRendering fr) {
         return mCharData[FontKey{size, fr}];
     }
 
     Character renderGlyph(const FontEntry& fs, AChar glyph);
 
+    /**
+     * @brief Puts the bitmap of the entry to the LRU list, evicting the least recently used bitmaps if the budget is
+     * exceeded.
+     */
+    void cacheBitmap(FontData& data, char32_t codepoint, FontData::Entry& entry);
+    void evictBitmaps(std::size_t budget);
+
 public:
     AFont(AFontManager* fm, const AString& path);
 
@@ -136,8 +210,28 @@ public:
 
     AFont(const AFont&) = delete;
 
+    /**
+     * @brief Returns the glyph, rasterizing it if needed.
+     * @details
+     * The returned reference stays valid for the lifetime of the font. Its image might be evicted by subsequent
+     * getCharacter calls though, so the caller should copy the image pointer if the bitmap is needed later.
+     */
     Character& getCharacter(const FontEntry& charset, AChar glyph);
 
+    /**
+     * @brief Sets the maximum size of the glyph bitmaps held by this font (all sizes and rendering modes in total).
+     * Least recently used bitmaps are evicted when exceeded.
+     */
+    void setGlyphCacheBudget(std::size_t bytes);
+
+    [[nodiscard]]
+    std::size_t glyphCacheBudget() const noexcept {
+        return mGlyphCacheBudget;
+    }
+
+    [[nodiscard]]
+    MemoryUsage memoryUsage() const noexcept;
+
     int length(const FontEntry& charset, AStringView text);
 
     int length(const FontEntry& charset, std::u32string_view text);
@@ -58,6 +58,8 @@
 #include <AUISL/Generated/symbol_sub.fsh.glsl120.h>
 #include <AUISL/Generated/line_solid_dashed.fsh.glsl120.h>
 #include <AUISL/Generated/square_sector.fsh.glsl120.h>
+#include <AUISL/Generated/batched.vsh.glsl120.h>
+#include <AUISL/Generated/rect_solid_batched.fsh.glsl120.h>
 #include <glm/gtx/matrix_transform_2d.hpp>
 #include <AUI/Platform/OpenGLRenderingContext.h>
 #include <AUI/GL/RenderTarget/TextureRenderTarget.h>
@@ -285,6 +287,9 @@ OpenGLRenderer::OpenGLRenderer() {
     useAuislShader<aui::sl_gen::basic_uv::vsh::glsl120::Shader,
         aui::sl_gen::line_solid_dashed::fsh::glsl120::Shader>(mLineSolidDashedShader);
 
+    useAuislShader<aui::sl_gen::batched::vsh::glsl120::Shader,
+        aui::sl_gen::rect_solid_batched::fsh::glsl120::Shader>(mBatchedShader);
+
     {
         constexpr GLuint INDICES[] = {0, 1, 2, 2, 1, 3};
         mRectangleVao.indices(INDICES);
@@ -293,6 +298,14 @@ OpenGLRenderer::OpenGLRenderer() {
         constexpr GLuint INDICES[] = {0, 1, 2, 3, 4, 5, 6, 7};
         mBorderVao.indices(INDICES);
     }
+    {
+        AVector<GLuint> indices;
+        indices.reserve(RectangleBatch::MAX_RECTANGLES * 6);
+        for (GLuint i = 0; i < RectangleBatch::MAX_RECTANGLES * 4; i += 4) {
+            indices << i << i + 1 << i + 2 << i + 2 << i + 1 << i + 3;
+        }
+        mBatch.vao.indices(AArrayView(indices));
+    }
 }
 
 glm::mat4 OpenGLRenderer::getProjectionMatrix() const {
@@ -321,6 +334,12 @@ std::array<glm::vec2, 4> OpenGLRenderer::getVerticesForRect(glm::vec2 position,
 }
 
 void OpenGLRenderer::rectangle(const ABrush& brush, glm::vec2 position, glm::vec2 size) {
+    // rounded() of rect_solid_batched.fsh is 1 everywhere inside the rectangle with such small corners.
+    static constexpr glm::vec2 NO_CORNERS(1e-4f);
+    if (batchRectangle(brush, position, size, NO_CORNERS, 0.f)) {
+        return;
+    }
+    flush();
     std::visit(aui::lambda_overloaded{
         GradientShaderHelper(*this, *mGradientShader, mGradientTexture),
         TexturedShaderHelper(*this, *mTexturedShader, mRectangleVao),
@@ -332,6 +351,54 @@ void OpenGLRenderer::rectangle(const ABrush& brush, glm::vec2 position, glm::vec
     drawRectImpl(position, size);
 }
 
+bool OpenGLRenderer::batchRectangle(const ABrush& brush, glm::vec2 position, glm::vec2 size, glm::vec2 outerSize,
+                                    float alphaThreshold) {
+    auto solid = std::get_if<ASolidBrush>(&brush);
+    if (!mBatchingEnabled || solid == nullptr || mDrawingMask || mBlending != Blending::NORMAL) {
+        // masks need the fragments to be discarded rather than transparent; other blending modes do not turn
+        // transparent fragments into no-op.
+        return false;
+    }
+    if (mBatch.size() == RectangleBatch::MAX_RECTANGLES) {
+        flush();
+    }
+    const glm::vec4 color = getColor() * solid->solidColor;
+    for (const auto& vertex : getVerticesForRect(position, size)) {
+        mBatch.positions << mTransform * glm::vec4(vertex, 0.f, 1.f);
+        mBatch.colors << color;
+        mBatch.outerSizes << outerSize;
+        mBatch.alphaThresholds << alphaThreshold;
+    }
+    mBatch.uvs << glm::vec2{0, 1} << glm::vec2{1, 1} << glm::vec2{0, 0} << glm::vec2{1, 0};
+    ++mBatchStatistics.rectangles;
+    return true;
+}
+
+void OpenGLRenderer::flush() {
+    if (mBatch.size() == 0) {
+        return;
+    }
+    // keep the shader a caller may have selected for its own draw call.
+    auto prevShader = gl::Program::currentShader();
+    mBatchedShader->use();
+    mBatch.vao.insert(0, AArrayView(mBatch.positions), "batch");
+    mBatch.vao.insert(1, AArrayView(mBatch.colors), "batch");
+    mBatch.vao.insert(2, AArrayView(mBatch.uvs), "batch");
+    mBatch.vao.insert(3, AArrayView(mBatch.outerSizes), "batch");
+    mBatch.vao.insert(4, AArrayView(mBatch.alphaThresholds), "batch");
+    mBatch.vao.drawElements(GL_TRIANGLES, GLsizei(mBatch.size() * 6));
+    ++mBatchStatistics.drawCalls;
+    mBatch.clear();
+    if (prevShader != nullptr && prevShader != &*mBatchedShader) {
+        prevShader->use();
+    }
+}
+
+void OpenGLRenderer::setBatchingEnabled(bool enabled) {
+    flush();
+    mBatchingEnabled = enabled;
+}
+
 void OpenGLRenderer::drawRectImpl(glm::vec2 position, glm::vec2 size) {
     mRectangleVao.bind();
 
@@ -354,6 +421,10 @@ void OpenGLRenderer::roundedRectangle(const ABrush& brush,
                                       glm::vec2 position,
                                       glm::vec2 size,
                                       float radius) {
+    if (batchRectangle(brush, position, size, 2.f * radius / size, 0.1f)) {
+        return;
+    }
+    flush();
     std::visit(aui::lambda_overloaded{
         GradientShaderHelper(*this, *mRoundedGradientShader, mGradientTexture),
         UnsupportedBrushHelper<ATexturedBrush>(),
@@ -371,6 +442,7 @@ void OpenGLRenderer::rectangleBorder(const ABrush& brush,
                                      glm::vec2 position,
                                      glm::vec2 size,
                                      float lineWidth) {
+    flush();
     std::visit(aui::lambda_overloaded{
         UnsupportedBrushHelper<ALinearGradientBrush>(),
         UnsupportedBrushHelper<ATexturedBrush>(),
@@ -412,6 +484,7 @@ void OpenGLRenderer::roundedRectangleBorder(const ABrush& brush,
                                             glm::vec2 size,
                                             float radius,
                                             int borderWidth) {
+    flush();
     std::visit(aui::lambda_overloaded{
         UnsupportedBrushHelper<ALinearGradientBrush>(),
         UnsupportedBrushHelper<ATexturedBrush>(),
@@ -434,6 +507,7 @@ void OpenGLRenderer::boxShadow(glm::vec2 position,
                                glm::vec2 size,
                                float blurRadius,
                                const AColor& color) {
+    flush();
     AUI_ASSERTX(blurRadius >= 0.f,
                 "blurRadius is expected to be non negative, use boxShadowInner for inset shadows instead");
     identityUv();
@@ -474,6 +548,7 @@ void OpenGLRenderer::boxShadowInner(glm::vec2 position,
                                     float borderRadius,
                                     const AColor& color,
                                     glm::vec2 offset) {
+    flush();
     AUI_ASSERTX(blurRadius >= 0.f, "blurRadius is expected to be non negative");
     blurRadius *= -1.f;
     identityUv();
@@ -511,6 +586,8 @@ void OpenGLRenderer::string(glm::vec2 position,
 }
 
 void OpenGLRenderer::setBlending(Blending blending) {
+    flush();
+    mBlending = blending;
     if (glBlendFuncSeparate) {
         switch (blending) {
             case Blending::NORMAL: {
@@ -557,13 +634,23 @@ public:
         glm::vec2 position;
         glm::vec2 uv;
     };
+
+    /**
+     * @brief Indices referring to the glyphs of a single atlas page.
+     */
+    struct PageRange {
+        _<OpenGLRenderer::GlyphPage> page;
+        std::size_t firstIndex;
+        std::size_t indexCount;
+    };
+
     OpenGLRenderer* mRenderer;
     AOptional<gl::Vao> mVao;
     gl::VertexBuffer mVertexBuffer;
     gl::IndexBuffer mIndexBuffer;
     int mTextWidth;
     int mTextHeight;
-    OpenGLRenderer::FontEntryData* mEntryData;
+    AVector<PageRange> mPageRanges;
     FontRendering mFontRendering;
 
     OpenGLPrerenderedString(OpenGLRenderer* renderer,
@@ -571,14 +658,14 @@ public:
                             gl::IndexBuffer indexBuffer,
                             int textWidth,
                             int textHeight,
-                            OpenGLRenderer::FontEntryData* entryData,
+                            AVector<PageRange> pageRanges,
                             FontRendering fontRendering) :
         mRenderer(renderer),
         mVertexBuffer(std::move(vertexBuffer)),
         mIndexBuffer(std::move(indexBuffer)),
         mTextWidth(textWidth),
         mTextHeight(textHeight),
-        mEntryData(entryData),
+        mPageRanges(std::move(pageRanges)),
         mFontRendering(fontRendering) {
         if (mRenderer->isVaoAvailable()) {
             mVao.emplace();
@@ -593,27 +680,13 @@ public:
 
     void draw() override {
         if (mIndexBuffer.count() == 0) return;
-
-        decltype(auto) img = mEntryData->texturePacker.getImage();
-        if (!img)
-            return;
+        mRenderer->flush();
 
         if (AWindow::current()->profiling()->showBaseline) {
             mRenderer->rectangle(
                 ASolidBrush { AColor::RED.transparentize(0.5f) }, { 0, 0 }, { mTextWidth, 1 });   // debug baseline
         }
 
-        auto width = img->width();
-
-        float uvScale = 1.f / float(width);
-
-        if (mEntryData->isTextureInvalid) {
-            mEntryData->texture.tex2D(*img);
-            mEntryData->isTextureInvalid = false;
-        } else {
-            mEntryData->texture.bind();
-        }
-
         if (mVao) {
             mVao->bind();
         } else {
@@ -625,25 +698,31 @@ public:
         auto finalColor = mRenderer->getColor();
         if (mFontRendering == FontRendering::SUBPIXEL) {
             mRenderer->mSymbolShaderSubPixel->use();
-            mRenderer->mSymbolShaderSubPixel->set(aui::ShaderUniforms::UV_SCALE, uvScale);
             mRenderer->mSymbolShaderSubPixel->set(aui::ShaderUniforms::TRANSFORM, mRenderer->getTransform());
-            mRenderer->mSymbolShaderSubPixel->set(aui::ShaderUniforms::COLOR, glm::vec4(1, 1, 1, finalColor.a));
-            glBlendFunc(GL_ZERO, GL_ONE_MINUS_SRC_COLOR);
-            mIndexBuffer.drawWithoutBind(GL_TRIANGLES);
-
-            mRenderer->mSymbolShaderSubPixel->set(aui::ShaderUniforms::COLOR, finalColor);
-            glBlendFunc(GL_ONE, GL_ONE);
-            mIndexBuffer.drawWithoutBind(GL_TRIANGLES);
+            for (const auto& range : mPageRanges) {
+                range.page->upload();
+                mRenderer->mSymbolShaderSubPixel->set(aui::ShaderUniforms::UV_SCALE, uvScale(range));
+                mRenderer->mSymbolShaderSubPixel->set(aui::ShaderUniforms::COLOR, glm::vec4(1, 1, 1, finalColor.a));
+                glBlendFunc(GL_ZERO, GL_ONE_MINUS_SRC_COLOR);
+                mIndexBuffer.drawWithoutBind(GL_TRIANGLES, range.firstIndex, range.indexCount);
+
+                mRenderer->mSymbolShaderSubPixel->set(aui::ShaderUniforms::COLOR, finalColor);
+                glBlendFunc(GL_ONE, GL_ONE);
+                mIndexBuffer.drawWithoutBind(GL_TRIANGLES, range.firstIndex, range.indexCount);
+            }
 
             // reset blending
             mRenderer->setBlending(Blending::NORMAL);
         } else {
             mRenderer->setBlending(Blending::NORMAL);
             mRenderer->mSymbolShader->use();
-            mRenderer->mSymbolShader->set(aui::ShaderUniforms::UV_SCALE, uvScale);
             mRenderer->mSymbolShader->set(aui::ShaderUniforms::TRANSFORM, mRenderer->getTransform());
             mRenderer->mSymbolShader->set(aui::ShaderUniforms::COLOR, finalColor);
-            mIndexBuffer.drawWithoutBind(GL_TRIANGLES);
+            for (const auto& range : mPageRanges) {
+                range.page->upload();
+                mRenderer->mSymbolShader->set(aui::ShaderUniforms::UV_SCALE, uvScale(range));
+                mIndexBuffer.drawWithoutBind(GL_TRIANGLES, range.firstIndex, range.indexCount);
+            }
         }
     }
 
@@ -656,6 +735,10 @@ public:
     }
 
 private:
+    static float uvScale(const PageRange& range) {
+        return 1.f / float(range.page->texturePacker.getImage()->width());
+    }
+
     static void setupVertexAttribs() {
         glEnableVertexAttribArray(0);
         glEnableVertexAttribArray(1);
@@ -669,26 +752,47 @@ private:
 
 class OpenGLMultiStringCanvas : public IRenderer::IMultiStringCanvas {
 private:
-    AVector<OpenGLPrerenderedString::Vertex> mVertices;
+    struct PageVertices {
+        _<OpenGLRenderer::GlyphPage> page;
+        AVector<OpenGLPrerenderedString::Vertex> vertices;
+    };
+
+    /**
+     * @brief Vertices grouped by atlas page, so each page is drawn with a single draw call. Holding the pages here
+     * also prevents them from being evicted while the string is built.
+     */
+    AVector<PageVertices> mPages;
     OpenGLRenderer* mRenderer;
     AFontStyle mFontStyle;
     OpenGLRenderer::FontEntryData* mEntryData;
     int mAdvanceX = 0;
     int mAdvanceY = 0;
 
+    AVector<OpenGLPrerenderedString::Vertex>& verticesOf(OpenGLRenderer::GlyphPage* page) {
+        // typically, all glyphs of a string belong to the same page.
+        for (auto it = mPages.rbegin(); it != mPages.rend(); ++it) {
+            if (it->page.get() == page) {
+                return it->vertices;
+            }
+        }
+        auto sharedPage = *std::find_if(mEntryData->pages.begin(), mEntryData->pages.end(), [&](const auto& p) {
+            return p.get() == page;
+        });
+        mPages.push_back({ std::move(sharedPage), {} });
+        mPages.last().vertices.reserve(1000);
+        return mPages.last().vertices;
+    }
+
 public:
     OpenGLMultiStringCanvas(OpenGLRenderer* renderer, const AFontStyle& fontStyle) :
         mRenderer(renderer),
         mFontStyle(fontStyle),
         mEntryData(renderer->getFontEntryData(fontStyle)) {
-        mVertices.reserve(1000);
     }
 
     template<class UnicodeString>
     void addStringT(const glm::ivec2& position, UnicodeString text) noexcept {
-        mVertices.reserve(mVertices.capacity() + text.length() * 4);
         auto& font = mFontStyle.font;
-        auto& texturePacker = mEntryData->texturePacker;
         auto fe = mFontStyle.getFontEntry();
 
         const bool hasKerning = font->isHasKerning();
@@ -718,35 +822,22 @@ public:
 
                     int posX = advance + ch.horizontal.bearing.x;
                     int posY = advanceY - ch.horizontal.bearing.y;
-                    int width = ch.image->width();
-                    int height = ch.image->height();
-
-                    glm::vec4 uv;
-
-                    if (ch.rendererData == nullptr) {
-                        uv = texturePacker.insert(*ch.image);
-
-                        const float BIAS = 0.1f;
-                        uv.x += BIAS;
-                        uv.y += BIAS;
-                        uv.z -= BIAS;
-                        uv.w -= BIAS;
-                        mRenderer->mCharData.push_back(OpenGLRenderer::CharacterData{uv});
-                        ch.rendererData = &mRenderer->mCharData.last();
-                        mEntryData->isTextureInvalid = true;
-                    } else {
-                        uv = reinterpret_cast<OpenGLRenderer::CharacterData*>(ch.rendererData)->uv;
-                    }
+                    int width = ch.imageSize.x;
+                    int height = ch.imageSize.y;
+
+                    auto& charData = mEntryData->getCharacterData(ch);
+                    auto uv = charData.uv;
+                    auto& vertices = verticesOf(charData.page);
 
                     notifySymbolAdded({glm::ivec2{posX, posY}});
-                    mVertices.push_back({glm::vec2(posX, posY + height),
-                                         glm::vec2(uv.x, uv.w)});
-                    mVertices.push_back({glm::vec2(posX + width, posY + height),
-                                         glm::vec2(uv.z, uv.w)});
-                    mVertices.push_back({glm::vec2(posX, posY),
-                                         glm::vec2(uv.x, uv.y)});
-                    mVertices.push_back({glm::vec2(posX + width, posY),
-                                         glm::vec2(uv.z, uv.y)});
+                    vertices.push_back({glm::vec2(posX, posY + height),
+                                        glm::vec2(uv.x, uv.w)});
+                    vertices.push_back({glm::vec2(posX + width, posY + height),
+                                        glm::vec2(uv.z, uv.w)});
+                    vertices.push_back({glm::vec2(posX, posY),
+                                        glm::vec2(uv.x, uv.y)});
+                    vertices.push_back({glm::vec2(posX + width, posY),
+                                        glm::vec2(uv.z, uv.y)});
 
                 }
 
@@ -778,13 +869,23 @@ public:
 
     _<IRenderer::IPrerenderedString> finalize() noexcept override {
         gl::Vao::unbind();
+
+        AVector<OpenGLPrerenderedString::Vertex> vertices;
+        AVector<OpenGLPrerenderedString::PageRange> pageRanges;
+        pageRanges.reserve(mPages.size());
+        for (auto& page : mPages) {
+            pageRanges.push_back({ std::move(page.page), vertices.size() / 4 * 6, page.vertices.size() / 4 * 6 });
+            vertices.insert(vertices.end(), page.vertices.begin(), page.vertices.end());
+        }
+        mPages.clear();
+
         gl::VertexBuffer vertexBuffer;
-        vertexBuffer.set(mVertices);
+        vertexBuffer.set(vertices);
 
         // build indices
         AVector<GLuint> indices;
-        indices.reserve(mVertices.size() / 4 * 6);
-        for (unsigned i = 0; i < mVertices.size() / 4; ++i) {
+        indices.reserve(vertices.size() / 4 * 6);
+        for (unsigned i = 0; i < vertices.size() / 4; ++i) {
             indices.push_back(i * 4);
             indices.push_back(i * 4 + 1);
             indices.push_back(i * 4 + 2);
@@ -800,7 +901,7 @@ public:
                                              std::move(indexBuffer),
                                              mAdvanceX,
                                              mAdvanceY,
-                                             mEntryData,
+                                             std::move(pageRanges),
                                              mFontStyle.fontRendering);
     }
 
@@ -831,6 +932,76 @@ OpenGLRenderer::FontEntryData* OpenGLRenderer::getFontEntryData(const AFontStyle
     return entryData;
 }
 
+OpenGLRenderer::GlyphPage::GlyphPage() {
+    texture.bind();
+    texture.setupNearest();
+}
+
+OpenGLRenderer::GlyphPage::~GlyphPage() {
+    for (auto& data : charData) {
+        data.character->rendererData = nullptr;
+    }
+}
+
+void OpenGLRenderer::GlyphPage::upload() {
+    auto& image = *texturePacker.getImage();
+    if (texturePacker.isResized()) {
+        texture.tex2D(image);
+    } else if (const auto& dirty = texturePacker.dirtyRect()) {
+        // whole rows are uploaded so the region is contiguous in memory and GL_UNPACK_ROW_LENGTH (unavailable on
+        // GLES 2) is not needed.
+        const auto rowSize = image.width() * image.format().bytesPerPixel();
+        const auto firstRow = unsigned(dirty->p1.y);
+        const glm::u32vec2 regionSize = { image.width(), unsigned(dirty->p2.y) - firstRow };
+        texture.texSubImage2D({ 0, firstRow },
+                              AImageView(image.buffer().slice(firstRow * rowSize, regionSize.y * rowSize),
+                                         regionSize, image.format()));
+    } else {
+        texture.bind();
+        return;
+    }
+    texturePacker.resetDirty();
+}
+
+OpenGLRenderer::CharacterData& OpenGLRenderer::FontEntryData::getCharacterData(AFont::Character& character) {
+    if (character.rendererData != nullptr) {
+        return *reinterpret_cast<CharacterData*>(character.rendererData);
+    }
+    AUI_ASSERTX(character.image != nullptr, "glyph bitmap is expected to be restored by AFont::getCharacter");
+
+    AOptional<glm::vec4> uv;
+    if (!pages.empty()) {
+        uv = pages.last()->texturePacker.tryInsert(*character.image, GlyphPage::MAX_SIDE);
+    }
+    if (!uv) {
+        // the current page is full; start a new one instead of repacking.
+        evictUnusedPages();
+        pages << _new<GlyphPage>();
+        // a glyph larger than MAX_SIDE still gets a page of its own.
+        uv = pages.last()->texturePacker.insert(*character.image);
+    }
+
+    const float BIAS = 0.1f;
+    uv->x += BIAS;
+    uv->y += BIAS;
+    uv->z -= BIAS;
+    uv->w -= BIAS;
+
+    auto& page = *pages.last();
+    page.charData.push_back(CharacterData{ *uv, &page, &character });
+    character.rendererData = &page.charData.last();
+    return page.charData.last();
+}
+
+void OpenGLRenderer::FontEntryData::evictUnusedPages() {
+    if (pages.empty()) {
+        return;
+    }
+    pages.erase(std::remove_if(pages.begin(), std::prev(pages.end()), [](const _<GlyphPage>& page) {
+        return page.use_count() == 1;
+    }), std::prev(pages.end()));
+}
+
 _unique<ITexture> OpenGLRenderer::createNewTexture() {
     return std::make_unique<OpenGLTexture2D>();
 }
@@ -844,6 +1015,8 @@ bool OpenGLRenderer::isVaoAvailable() const noexcept {
 }
 
 void OpenGLRenderer::pushMaskBefore() {
+    flush();
+    mDrawingMask = true;
     glStencilFunc(GL_ALWAYS, 0, 0xff);
     glStencilOp(GL_KEEP, GL_INCR, GL_INCR);
     glStencilMask(0xff);
@@ -851,12 +1024,16 @@ void OpenGLRenderer::pushMaskBefore() {
 }
 
 void OpenGLRenderer::pushMaskAfter() {
+    flush();
+    mDrawingMask = false;
     glColorMask(true, true, true, true);
     glStencilMask(0x00);
     glStencilFunc(GL_EQUAL, ++mStencilDepth, 0xff);
 }
 
 void OpenGLRenderer::popMaskBefore() {
+    flush();
+    mDrawingMask = true;
     glStencilFunc(GL_ALWAYS, 0, 0xff);
     glStencilOp(GL_KEEP, GL_DECR, GL_DECR);
     glStencilMask(0xff);
@@ -864,6 +1041,8 @@ void OpenGLRenderer::popMaskBefore() {
 }
 
 void OpenGLRenderer::popMaskAfter() {
+    flush();
+    mDrawingMask = false;
     glColorMask(true, true, true, true);
     glStencilMask(0x00);
     glStencilFunc(GL_EQUAL, --mStencilDepth, 0xff);
@@ -909,6 +1088,7 @@ struct LineVertex {
 }
 
 void OpenGLRenderer::lines(const ABrush& brush, AArrayView<glm::vec2> points, const ABorderStyle& style, AMetric width) {
+    flush();
     if (points.size() < 2) return;
     const auto widthPx = width.getValuePx();
     bool computeDistances = setupLineShader(brush, style, widthPx);
@@ -936,6 +1116,7 @@ void OpenGLRenderer::lines(const ABrush& brush, AArrayView<glm::vec2> points, co
 
 void OpenGLRenderer::lines(const ABrush& brush, AArrayView<std::pair<glm::vec2, glm::vec2>> points,
                            const ABorderStyle& style, AMetric width) {
+    flush();
     const auto widthPx = width.getValuePx();
     bool computeDistances = setupLineShader(brush, style, widthPx);
     uploadToShaderCommon();
@@ -964,6 +1145,7 @@ void OpenGLRenderer::lines(const ABrush& brush, AArrayView<std::pair<glm::vec2,
 }
 
 void OpenGLRenderer::points(const ABrush& brush, AArrayView<glm::vec2> points, AMetric size) {
+    flush();
     if (points.size() == 0) {
         return;
     }
@@ -998,6 +1180,7 @@ void OpenGLRenderer::squareSector(const ABrush& brush,
                                   const glm::vec2& size,
                                   AAngleRadians begin,
                                   AAngleRadians end) {
+    flush();
     std::visit(aui::lambda_overloaded{
         UnsupportedBrushHelper<ALinearGradientBrush>(),
         UnsupportedBrushHelper<ATexturedBrush>(),
@@ -1050,9 +1233,11 @@ void OpenGLRenderer::beginPaint(glm::uvec2 windowSize) {
     setBlending(Blending::NORMAL);
 
     resetStencil();
+    mBatchStatistics = {};
 }
 
 void OpenGLRenderer::endPaint() {
+    flush();
     gl::State::activeTexture(0);
     gl::State::bindTexture(GL_TEXTURE_2D, 0);
     gl::State::bindVertexArray(0);
@@ -1096,6 +1281,7 @@ _unique<IRenderViewToTexture> OpenGLRenderer::newRenderViewToTexture() noexcept
             bool begin(IRenderer& renderer, glm::ivec2 surfaceSize, IRenderViewToTexture::InvalidArea& invalidArea) override {
                 AUI_ASSERT(!invalidArea.empty()); // if invalid areas are empty, what should we redraw then?
                 AUI_ASSERT(&mRenderer == &renderer);
+                mRenderer.flush();
                 auto mainRenderingFB = getMainRenderingFramebuffer(renderer);
                 AUI_ASSERT(mainRenderingFB != nullptr);
                 if (glm::any(glm::greaterThan(glm::u32vec2(surfaceSize), mainRenderingFB->size()))) {
@@ -1181,6 +1367,7 @@ _unique<IRenderViewToTexture> OpenGLRenderer::newRenderViewToTexture() noexcept
 
             void end(IRenderer& renderer) override {
                 AUI_ASSERT(&mRenderer == &renderer);
+                mRenderer.flush();
                 AUI_ASSERT(mRenderer.mRenderToTextureTarget == this);
                 mRenderer.mRenderToTextureTarget = nullptr;
                 auto mainRenderingFB = gl::Framebuffer::current();
@@ -1206,6 +1393,7 @@ _unique<IRenderViewToTexture> OpenGLRenderer::newRenderViewToTexture() noexcept
 
             void draw(IRenderer& renderer) override {
                 AUI_ASSERT(&mRenderer == &renderer);
+                mRenderer.flush();
                 mRenderer.mUnblendShader->use();
                 mRenderer.mUnblendShader->set(aui::ShaderUniforms::COLOR, renderer.getColor());
                 mTexture->bindAsTexture(0);
@@ -1267,6 +1455,7 @@ _unique<IRenderViewToTexture> OpenGLRenderer::newRenderViewToTexture() noexcept
 }
 
 void OpenGLRenderer::backdrops(glm::ivec2 position, glm::ivec2 size, std::span<ass::Backdrop::Preprocessed> backdrops) {
+    flush();
     if (!glm::all(glm::greaterThan(size, glm::ivec2(0)))) {
         return;
     }
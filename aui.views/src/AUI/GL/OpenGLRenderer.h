@@ -23,15 +23,72 @@ class API_AUI_VIEWS OpenGLRenderer final: public IRenderer {
     friend class OpenGLPrerenderedString;
     friend class OpenGLMultiStringCanvas;
 public:
-    struct FontEntryData: aui::noncopyable {
+    struct GlyphPage;
+
+    struct CharacterData {
+        /**
+         * @brief uv in pixels of the page.
+         */
+        glm::vec4 uv;
+        GlyphPage* page;
+        AFont::Character* character;
+    };
+
+    /**
+     * @brief Glyph atlas page.
+     * @details
+     * Grows up to MAX_SIDE; then the next page is started. Glyphs inserted since the last draw are uploaded to the
+     * texture incrementally.
+     *
+     * Prerendered strings hold references to the pages they use. A page no string refers to can be evicted; the
+     * glyphs of an evicted page are inserted to another page as soon as they are needed again.
+     */
+    struct GlyphPage: aui::noncopyable {
+        static constexpr Util::dim MAX_SIDE = 1024;
+
         Util::SimpleTexturePacker texturePacker;
         gl::Texture2D texture;
-        bool isTextureInvalid = true;
+        ADeque<CharacterData> charData;
 
-        FontEntryData() {
-            texture.bind();
-            texture.setupNearest();
-        }
+        GlyphPage();
+        ~GlyphPage();
+
+        /**
+         * @brief Uploads the modified part of the atlas to the texture and binds it.
+         */
+        void upload();
+    };
+
+    struct FontEntryData: aui::noncopyable {
+        /**
+         * @brief Pages of the font entry. The last one is the page new glyphs are inserted to.
+         */
+        AVector<_<GlyphPage>> pages;
+
+        /**
+         * @brief Returns the atlas entry of the glyph, inserting it if needed.
+         */
+        CharacterData& getCharacterData(AFont::Character& character);
+
+        /**
+         * @brief Destroys pages not referenced by any prerendered string, except the current one.
+         */
+        void evictUnusedPages();
+    };
+
+    /**
+     * @brief Counters of the rectangle batching, reset by beginPaint.
+     */
+    struct BatchStatistics {
+        /**
+         * @brief Rectangles drawn through the batch.
+         */
+        std::size_t rectangles = 0;
+
+        /**
+         * @brief Draw calls issued by the batch.
+         */
+        std::size_t drawCalls = 0;
     };
 
     using GLLoadProc = void* (*) (const char* name);
@@ -61,16 +118,52 @@ private:
     AOptional<gl::Program> mSymbolShaderSubPixel;
     AOptional<gl::Program> mSquareSectorShader;
     AOptional<gl::Program> mLineSolidDashedShader;
+    AOptional<gl::Program> mBatchedShader;
     gl::Vao mRectangleVao;
     gl::Vao mBorderVao;
     gl::Texture2D mGradientTexture;
 
+    /**
+     * @brief Solid rectangles and rounded rectangles waiting for a single draw call of mBatchedShader.
+     * @details
+     * Positions are transformed on the CPU, so rectangles drawn with different transforms (i.e., by different views)
+     * share the draw call. Each attribute is stored in its own array, as gl::Vao expects.
+     *
+     * The batch is flushed before any other draw call or GL state change made by the renderer, so the draw order is
+     * preserved.
+     */
+    struct RectangleBatch {
+        static constexpr std::size_t MAX_RECTANGLES = 4096;
+
+        gl::Vao vao;
+        AVector<glm::vec4> positions;
+        AVector<glm::vec4> colors;
+        AVector<glm::vec2> uvs;
+        AVector<glm::vec2> outerSizes;
+        AVector<float> alphaThresholds;
+
+        [[nodiscard]]
+        std::size_t size() const noexcept {
+            return positions.size() / 4;
+        }
 
-    struct CharacterData {
-        glm::vec4 uv;
-    };
+        void clear() noexcept {
+            positions.clear();
+            colors.clear();
+            uvs.clear();
+            outerSizes.clear();
+            alphaThresholds.clear();
+        }
+    } mBatch;
+    BatchStatistics mBatchStatistics;
+    bool mBatchingEnabled = true;
+    Blending mBlending = Blending::NORMAL;
+
+    /**
+     * @brief A mask is being drawn (between push/popMaskBefore and push/popMaskAfter).
+     */
+    bool mDrawingMask = false;
 
-    ADeque<CharacterData> mCharData;
     ADeque<FontEntryData> mFontEntryData;
     IRenderViewToTexture* mRenderToTextureTarget = nullptr;
 
@@ -97,6 +190,15 @@ private:
 
     void uploadToShaderCommon();
 
+    /**
+     * @brief Adds a rectangle to mBatch if the current state allows it.
+     * @param outerSize rounded corners as in rect_solid_rounded.fsh.
+     * @param alphaThreshold fragments with lower alpha are dropped, as rect_solid_rounded.fsh discards them.
+     * @return false, if the caller should draw the rectangle itself.
+     */
+    bool batchRectangle(const ABrush& brush, glm::vec2 position, glm::vec2 size, glm::vec2 outerSize,
+                        float alphaThreshold);
+
     FontEntryData* getFontEntryData(const AFontStyle& fontStyle);
 
     /**
@@ -204,6 +306,20 @@ public:
 
     void beginPaint(glm::uvec2 windowSize);
     void endPaint();
+    void flush() override;
+
+    [[nodiscard]]
+    const BatchStatistics& batchStatistics() const noexcept {
+        return mBatchStatistics;
+    }
+
+    /**
+     * @brief Enables or disables batching of solid rectangles. Enabled by default.
+     * @details
+     * When disabled, each rectangle is drawn by its own draw call with rect_solid.fsh or rect_solid_rounded.fsh. Used
+     * to compare the output of both paths.
+     */
+    void setBatchingEnabled(bool enabled);
     
     uint32_t getDefaultFb() const noexcept;
     void bindTemporaryVao() const noexcept;
@@ -48,3 +48,12 @@ void gl::Texture2D::tex2D(AImageView image) {
                      image.buffer().empty() ? nullptr : image.buffer().data());
     }
 }
+
+void gl::Texture2D::texSubImage2D(glm::u32vec2 position, AImageView image) {
+    AUI_ASSERT_UI_THREAD_ONLY();
+    AUI_ASSERTX(glm::all(glm::lessThanEqual(position + image.size(), mSize)), "region is out of texture bounds");
+    bind();
+    auto types = aui::gl::impl::recognize(image);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, position.x, position.y, image.width(), image.height(), types.format, types.type,
+                    image.buffer().data());
+}
@@ -20,6 +20,19 @@ namespace gl {
 class API_AUI_VIEWS Texture2D final: public Texture<TEXTURE_2D> {
 public:
     void tex2D(AImageView image);
+
+    /**
+     * @brief Updates a region of the texture previously allocated with tex2D.
+     * @param position top left corner of the region.
+     * @param image tightly packed pixels of the region; its format must match to the format passed to tex2D.
+     */
+    void texSubImage2D(glm::u32vec2 position, AImageView image);
+
+    [[nodiscard]]
+    glm::u32vec2 size() const noexcept {
+        return mSize;
+    }
+
     virtual ~Texture2D() = default;
     void framebufferTex2D(glm::u32vec2 size, gl::Type type);
 
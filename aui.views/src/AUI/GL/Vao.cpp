@@ -134,6 +134,13 @@ void gl::Vao::drawElements(GLenum type) {
     glDrawElements(type, mIndicesCount, mIndicesType, 0);
 }
 
+void gl::Vao::drawElements(GLenum type, GLsizei count) {
+    assert(mIndicesBuffer);
+    assert(count <= mIndicesCount);
+    bind();
+    glDrawElements(type, count, mIndicesType, 0);
+}
+
 void gl::Vao::indices(AArrayView<uint32_t> data) {
     bind();
     GLenum drawType = GL_DYNAMIC_DRAW;
@@ -94,6 +94,13 @@ public:
      */
     void drawElements(GLenum type = GL_TRIANGLES);
 
+    /**
+     * @brief Draws first count indices of the buffer.
+     * @param type Primitive type
+     * @param count count of indices to draw
+     */
+    void drawElements(GLenum type, GLsizei count);
+
 private:
     GLuint mHandle;
     AVector<Buffer> mBuffers;
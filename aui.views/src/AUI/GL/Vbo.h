@@ -75,6 +75,15 @@ namespace gl {
             glDrawElements(primitiveType, GLsizei(mIndicesCount), GL_UNSIGNED_INT, nullptr);
         }
 
+        /**
+         * @brief Draws indexCount indices starting from firstIndex.
+         */
+        void drawWithoutBind(GLenum primitiveType, size_t firstIndex, size_t indexCount) {
+            AUI_ASSERT(firstIndex + indexCount <= mIndicesCount);
+            glDrawElements(primitiveType, GLsizei(indexCount), GL_UNSIGNED_INT,
+                           reinterpret_cast<const void*>(firstIndex * sizeof(GLuint)));
+        }
+
         [[nodiscard]]
         size_t count() const {
             return mIndicesCount;
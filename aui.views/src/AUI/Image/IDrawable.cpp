@@ -44,6 +44,17 @@ _<IDrawable> IDrawable::Cache::load(const AUrl& key)
     return nullptr;
 }
 
+IDrawable::Cache::Cache() : ::Cache<IDrawable, Cache, AUrl>(DEFAULT_CAPACITY) {}
+
+std::size_t IDrawable::Cache::cost(const AUrl& key, const _<IDrawable>& value) {
+    if (!value) {
+        return 1;
+    }
+    // approximate size of decoded RGBA pixels (or rasterized vector image at its natural size).
+    auto size = glm::max(value->getSizeHint(), glm::ivec2(1));
+    return std::size_t(size.x) * std::size_t(size.y) * 4;
+}
+
 IDrawable::Cache& IDrawable::Cache::inst() {
     static IDrawable::Cache s;
     return s;
@@ -33,10 +33,18 @@ class IDrawable {
     friend class AImageLoaderRegistry;
     class Cache : public ::Cache<IDrawable, Cache, AUrl> {
     public:
+        /**
+         * @brief Default capacity of the drawable cache, in bytes of decoded pixels.
+         */
+        static constexpr std::size_t DEFAULT_CAPACITY = 256 * 1024 * 1024;
+
+        Cache();
+
         static Cache& inst();
 
     protected:
         _<IDrawable> load(const AUrl& key) override;
+        std::size_t cost(const AUrl& key, const _<IDrawable>& value) override;
     };
 
 public:
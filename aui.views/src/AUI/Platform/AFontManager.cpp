@@ -23,6 +23,19 @@ _<AFont> AFontManager::loadFont(const AUrl& url) {
     return _new<AFont>(this, url);
 }
 
+AVector<_<AFont>> AFontManager::loadedFonts() const {
+    AVector<_<AFont>> result;
+    if (mDefaultFont) {
+        result << mDefaultFont;
+    }
+    for (const auto& [url, font] : mLoadedFont) {
+        if (font != mDefaultFont) {
+            result << font;
+        }
+    }
+    return result;
+}
+
 AFontManager& AFontManager::inst() {
     static AFontManager f;
     return f;
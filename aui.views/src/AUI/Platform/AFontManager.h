@@ -45,6 +45,12 @@ public:
         }
         return mLoadedFont[url] = loadFont(url);
     }
+
+    /**
+     * @brief Default font and fonts loaded with getFont.
+     */
+    [[nodiscard]]
+    AVector<_<AFont>> loadedFonts() const;
 private:
     AMap<AUrl, _<AFont>> mLoadedFont;
     AMap<AString, _<AFontFamily>> mFamilies;
@@ -49,6 +49,7 @@ void AGLEmbedContext::render(const ARenderContext& context) {
                                            static_cast<float>(mSize.y),
                                            0.f));
     windowRender();
+    context.render.flush();
 
     resetGLState();
 }
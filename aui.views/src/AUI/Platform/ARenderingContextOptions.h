@@ -61,7 +61,12 @@ struct API_AUI_VIEWS ARenderingContextOptions {
         } profile = Profile::CORE;
     };
 
-    struct Software {};
+    struct Software {
+        /**
+         * @brief Rasterize frames in tiles on several threads, see SoftwareRenderingContext::setTiledRendering.
+         */
+        bool tiled = false;
+    };
 
     using InitializationVariant =  std::variant<DirectX11,
             OpenGL,
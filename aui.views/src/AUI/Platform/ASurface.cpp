@@ -474,6 +474,12 @@ void ASurface::render(ARenderContext context) {
         if (auto v = p->highlightView->lock()) {
             AViewProfiler::displayBoundsOn(*v, context);
         }
+        if (p->highlightDamage && mHighlightedDamage) {
+            RenderHints::PushColor c(context.render);
+            context.render.setColorForced(AColor::WHITE);
+            context.render.rectangle(ASolidBrush { 0x30ff0000_argb }, mHighlightedDamage->p1, mHighlightedDamage->size());
+            context.render.rectangleBorder(ASolidBrush { 0xffff0000_argb }, mHighlightedDamage->p1, mHighlightedDamage->size(), 1.f);
+        }
     }
 
 #if AUI_SHOW_TOUCHES
@@ -623,9 +629,57 @@ void ASurface::markMinContentSizeInvalid() {
         }
     }
     AViewContainer::markMinContentSizeInvalid();
-    flagRedraw();
+    // layout update may move any view.
+    markAllPixelDataInvalid();
 }
 
 void ASurface::markPixelDataInvalid(ARect<int> invalidArea) {
+    invalidArea.p1 = glm::max(invalidArea.p1, glm::ivec2(0));
+    invalidArea.p2 = glm::min(invalidArea.p2, getSize());
+    if (glm::any(glm::greaterThanEqual(invalidArea.p1, invalidArea.p2))) {
+        // outside of the surface; nothing to repaint.
+        return;
+    }
+    mDamage.addRectangle(invalidArea);
     flagRedraw();
 }
+
+void ASurface::markAllPixelDataInvalid() {
+    mDamage = IRenderViewToTexture::InvalidArea::Full{};
+    flagRedraw();
+}
+
+AOptional<ARect<int>> ASurface::takeDamage(bool previousFrameAvailable) {
+    auto damage = std::exchange(mDamage, IRenderViewToTexture::InvalidArea::Empty{});
+    mHighlightedDamage.reset();
+
+    // debug visualizations are drawn regardless of the damaged area; the whole surface is repainted while they are
+    // displayed and once after that so they do not leave trails.
+    bool profilingVisualized = false;
+    if (auto& p = profiling()) [[unlikely]] {
+        profilingVisualized = p->highlightDamage || p->highlightRedrawRequests || p->highlightView->lock();
+    }
+    const bool forceFull = std::exchange(mProfilingVisualized, profilingVisualized) || profilingVisualized;
+
+    const auto rectangles = damage.rectangles();
+    if (!previousFrameAvailable || rectangles == nullptr || rectangles->empty()) {
+        // either full damage or the redraw was requested with flagRedraw() only, so the changed area is unknown.
+        return std::nullopt;
+    }
+    ARect<int> result = rectangles->first();
+    for (const auto& rect : *rectangles) {
+        result.p1 = glm::min(result.p1, rect.p1);
+        result.p2 = glm::max(result.p2, rect.p2);
+    }
+    if (glm::all(glm::lessThanEqual(result.p1, glm::ivec2(0))) &&
+        glm::all(glm::greaterThanEqual(result.p2, getSize()))) {
+        return std::nullopt;
+    }
+    if (forceFull) [[unlikely]] {
+        if (auto& p = profiling(); p && p->highlightDamage) {
+            mHighlightedDamage = result;
+        }
+        return std::nullopt;
+    }
+    return result;
+}
@@ -75,6 +75,13 @@ public:
          * @brief When set to true, all rendered strings will display their baselines.
          */
         AProperty<bool> showBaseline = false;
+
+        /**
+         * @brief Highlight the area repainted by each frame (damage region), see frameDamage.
+         * @details
+         * While enabled, frames are repainted fully so the highlight does not leave trails.
+         */
+        AProperty<bool> highlightDamage = false;
     };
 
 
@@ -213,6 +220,27 @@ public:
     virtual void focusNextView();
     virtual void flagRedraw();
 
+    /**
+     * @brief Requests the whole surface to be repainted by the next frame.
+     * @details
+     * Unlike markPixelDataInvalid, used when the changed area is unknown, i.e. the platform has lost the surface
+     * contents or an animation affects arbitrary views.
+     */
+    void markAllPixelDataInvalid();
+
+    /**
+     * @brief Area repainted by the frame being drawn, in surface coordinates.
+     * @return std::nullopt if the whole surface is repainted.
+     * @details
+     * Invalid areas passed to markPixelDataInvalid are accumulated between frames; the frame is rendered with its
+     * clipping limited to their bounding rectangle. Rendering contexts use it to limit rasterization and presentation
+     * to the damaged area. Valid between IRenderingContext::beginPaint and IRenderingContext::endPaint.
+     */
+    [[nodiscard]]
+    const AOptional<ARect<int>>& frameDamage() const noexcept {
+        return mFrameDamage;
+    }
+
     void makeCurrent() {
         currentWindowStorage() = this;
     }
@@ -452,7 +480,29 @@ protected:
 
     void markPixelDataInvalid(ARect<int> invalidArea) override;
 
+    /**
+     * @brief Consumes the damage accumulated since the last frame and returns the area the next frame repaints.
+     * @param previousFrameAvailable whether the framebuffer holds the previous frame
+     *        (IRenderingContext::isPreviousFrameAvailable). If not, the whole surface is repainted.
+     * @return std::nullopt if the whole surface should be repainted.
+     */
+    AOptional<ARect<int>> takeDamage(bool previousFrameAvailable);
+
+    AOptional<ARect<int>> mFrameDamage;
+
 private:
+    IRenderViewToTexture::InvalidArea mDamage = IRenderViewToTexture::InvalidArea::Full{};
+
+    /**
+     * @brief Damage of the last frame displayed by Profiling::highlightDamage.
+     */
+    AOptional<ARect<int>> mHighlightedDamage;
+
+    /**
+     * @brief Whether the last frame displayed debug visualizations of Profiling.
+     */
+    bool mProfilingVisualized = false;
+
     void processTouchscreenKeyboardRequest();
 
     _weak<AView> mFocusedView;
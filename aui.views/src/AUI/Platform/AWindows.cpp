@@ -51,7 +51,7 @@ void AWindow::doDrawWindow() {
     APerformanceSection s("AWindow::doDrawWindow");
     auto& renderer = mRenderingContext->renderer();
     renderer.setWindow(this);
-    render({.clippingRects = { ARect<int>{ .p1 = glm::ivec2(0), .p2 = getSize() } }, .render = renderer });
+    render({.clippingRects = { mFrameDamage.valueOr(ARect<int>{ .p1 = glm::ivec2(0), .p2 = getSize() }) }, .render = renderer });
 }
 
 void AWindow::createDevtoolsWindow() {
@@ -97,6 +97,7 @@ void AWindow::redraw() {
             return;
         }
         auto before = duration_cast<milliseconds>(high_resolution_clock::now().time_since_epoch());
+        mFrameDamage = takeDamage(mRenderingContext->isPreviousFrameAvailable());
         {
             APerformanceSection s("IRenderingContext::beginPaint");
             mRenderingContext->beginPaint(*this);
@@ -104,6 +105,7 @@ void AWindow::redraw() {
         AUI_DEFER {
             APerformanceSection s("IRenderingContext::endPaint");
             mRenderingContext->endPaint(*this);
+            mFrameDamage.reset();
         };
 
         if (mMarkedMinContentSizeInvalid) {
@@ -335,8 +337,9 @@ void AWindowManager::initNativeWindow(const IRenderingContext::Init& init) {
                         context->init(init);
                         init.setRenderingContext(std::move(context));
                     },
-                    [&](const ARenderingContextOptions::Software&) {
+                    [&](const ARenderingContextOptions::Software& config) {
                         auto context = std::make_unique<SoftwareRenderingContext>();
+                        context->setTiledRendering(config.tiled);
                         context->init(init);
                         init.setRenderingContext(std::move(context));
                     },
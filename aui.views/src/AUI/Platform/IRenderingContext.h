@@ -57,4 +57,15 @@ public:
     virtual void endResize(ASurface& window) = 0;
 
     virtual IRenderer& renderer() = 0;
+
+    /**
+     * @brief Whether the framebuffer still holds the previous frame at the beginning of the next one.
+     * @details
+     * If true, the window repaints and presents only the invalidated area, see ASurface::frameDamage. Otherwise,
+     * each frame is painted completely.
+     */
+    [[nodiscard]]
+    virtual bool isPreviousFrameAvailable() const noexcept {
+        return false;
+    }
 };
\ No newline at end of file
@@ -0,0 +1,37 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+// platform independent part of SoftwareRenderingContext; the rest is implemented per platform.
+
+#include "SoftwareRenderingContext.h"
+#include "AUI/Software/SoftwareRenderer.h"
+
+void SoftwareRenderingContext::beginFrame(ASurface& window) {
+    auto softwareRenderer = dynamic_cast<SoftwareRenderer*>(&renderer());
+    if (!softwareRenderer) {
+        return;
+    }
+    if (const auto& damage = window.frameDamage()) {
+        softwareRenderer->setClip(damage->p1, damage->p2);
+    } else {
+        softwareRenderer->resetClip();
+    }
+    if (mTiledRendering) {
+        softwareRenderer->beginRecording();
+    }
+}
+
+void SoftwareRenderingContext::endFrame() {
+    if (auto softwareRenderer = dynamic_cast<SoftwareRenderer*>(&renderer()); softwareRenderer && softwareRenderer->isRecording()) {
+        softwareRenderer->endRecording();
+    }
+    mPreviousFrameAvailable = true;
+}
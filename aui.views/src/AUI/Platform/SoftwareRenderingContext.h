@@ -33,6 +33,31 @@ public:
 
     AImage makeScreenshot() override;
 
+    [[nodiscard]]
+    bool isPreviousFrameAvailable() const noexcept override {
+#if AUI_PLATFORM_LINUX
+        return mPreviousFrameAvailable;
+#else
+        // other platforms either clear the framebuffer in beginPaint or do not track its reallocation.
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Enables tiled rendering.
+     * @details
+     * When enabled, draw calls of a frame are recorded and rasterized in tiles in parallel at the end of the frame,
+     * see SoftwareRenderer::endRecording. Can be enabled for all windows with ARenderingContextOptions::Software::tiled.
+     */
+    void setTiledRendering(bool tiledRendering) noexcept {
+        mTiledRendering = tiledRendering;
+    }
+
+    [[nodiscard]]
+    bool isTiledRendering() const noexcept {
+        return mTiledRendering;
+    }
+
     inline uint8_t& stencil(const glm::uvec2& position) {
         return mStencilBlob.at<uint8_t>(mBitmapSize.x * position.y + position.x);
     }
@@ -42,6 +67,26 @@ public:
         return mBitmapSize;
     }
 
+    /**
+     * @return pointer to the stencil value of the first pixel of the row.
+     */
+    [[nodiscard]]
+    uint8_t* stencilRow(unsigned y) noexcept {
+        return reinterpret_cast<uint8_t*>(mStencilBlob.data()) + mBitmapSize.x * y;
+    }
+
+    /**
+     * @return pointer to the first pixel of the row. Pixels are stored as BGRA.
+     */
+    [[nodiscard]]
+    uint8_t* pixelRow(unsigned y) noexcept {
+#if AUI_PLATFORM_WIN
+        return reinterpret_cast<uint8_t*>(mBitmapBlob.data() + sizeof(BITMAPINFO)) + mBitmapSize.x * y * 4;
+#else
+        return mBitmapBlob + mBitmapSize.x * y * 4;
+#endif
+    }
+
     inline void putPixel(const glm::uvec2& position, const glm::u8vec3& color) noexcept {
         putPixel(position, glm::u8vec4(color, 255));
     }
@@ -99,7 +144,26 @@ protected:
     void reallocate(const ASurface& window);
     virtual void reallocate();
 
+    /**
+     * @brief true, if the framebuffer holds the complete previous frame.
+     */
+    bool mPreviousFrameAvailable = false;
+
+    /**
+     * @brief Restricts the renderer to ASurface::frameDamage and starts recording the frame if tiled rendering is
+     * enabled. To be called by beginPaint.
+     */
+    void beginFrame(ASurface& window);
+
+    /**
+     * @brief Rasterizes the recorded frame if tiled rendering is enabled. To be called by endPaint before the
+     * framebuffer is presented.
+     */
+    void endFrame();
+
 private:
+    bool mTiledRendering = false;
+
 #if AUI_PLATFORM_WIN
     AByteBuffer mBitmapBlob;
     BITMAPINFO* mBitmapInfo;
@@ -27,9 +27,11 @@ void SoftwareRenderingContext::destroyNativeWindow(ASurface &window) {
 void SoftwareRenderingContext::beginPaint(ASurface &window) {
     CommonRenderingContext::beginPaint(window);
     std::memset(mStencilBlob.data(), 0, mStencilBlob.getSize());
+    beginFrame(window);
 }
 
 void SoftwareRenderingContext::endPaint(ASurface &window) {
+    endFrame();
     CommonRenderingContext::endPaint(window);
 }
 
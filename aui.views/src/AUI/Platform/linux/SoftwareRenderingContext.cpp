@@ -26,9 +26,13 @@ SoftwareRenderingContext::~SoftwareRenderingContext() {
 
 void SoftwareRenderingContext::beginPaint(ASurface &window) {
     std::memset(mStencilBlob.data(), 0, mStencilBlob.getSize());
+    beginFrame(window);
 }
 
-void SoftwareRenderingContext::endPaint(ASurface &window) { CommonRenderingContext::endPaint(window); }
+void SoftwareRenderingContext::endPaint(ASurface &window) {
+    endFrame();
+    CommonRenderingContext::endPaint(window);
+}
 
 void SoftwareRenderingContext::beginResize(ASurface &window) {}
 
@@ -41,6 +45,7 @@ void SoftwareRenderingContext::reallocate(const ASurface &window) {
 }
 
 void SoftwareRenderingContext::reallocate() {
+    mPreviousFrameAvailable = false;
     if (mBitmapBlob) {
         free(mBitmapBlob);
     }
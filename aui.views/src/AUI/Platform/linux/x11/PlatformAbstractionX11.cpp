@@ -131,7 +131,7 @@ void PlatformAbstractionX11::xProcessEvent(XEvent& ev) {
                 switch (ev.type) {
                     case Expose: {
                         window = locateWindow(ev.xexpose.window);
-                        window->flagRedraw();
+                        window->markAllPixelDataInvalid();
                         break;
                     }
                     case ClientMessage: {
@@ -614,8 +614,9 @@ void PlatformAbstractionX11::windowManagerInitNativeWindow(const IRenderingConte
                   context->init(init);
                   init.setRenderingContext(std::move(context));
                 },
-                [&](const ARenderingContextOptions::Software&) {
+                [&](const ARenderingContextOptions::Software& config) {
                   auto context = std::make_unique<SoftwareRenderingContextX11>();
+                  context->setTiledRendering(config.tiled);
                   context->init(init);
                   init.setRenderingContext(std::move(context));
                 },
@@ -10,14 +10,27 @@
  */
 
 #include "SoftwareRenderingContextX11.h"
+#include <sys/ipc.h>
+#include <sys/shm.h>
 
 static XVisualInfo* vi = nullptr;
 
+namespace {
+bool gShmAttachFailed = false;
+
+int shmAttachErrorHandler(Display*, XErrorEvent*) {
+    gShmAttachFailed = true;
+    return 0;
+}
+}   // namespace
+
 SoftwareRenderingContextX11::~SoftwareRenderingContextX11() {
     if (mBitmapBlob && !mXImage) {
         free(mBitmapBlob);
         mBitmapBlob = nullptr;
     }
+    // the deleter refers to mShmSegment which is destroyed before mXImage.
+    mXImage.reset();
 }
 
 void SoftwareRenderingContextX11::init(const IRenderingContext::Init& init) {
@@ -64,19 +77,102 @@ void SoftwareRenderingContextX11::destroyNativeWindow(ASurface& window) {
 void SoftwareRenderingContextX11::endPaint(ASurface& window) {
     SoftwareRenderingContext::endPaint(window);
     if (auto nativeWindow = dynamic_cast<AWindow*>(&window)) {
-        XPutImage(PlatformAbstractionX11::ourDisplay,
-                  nativeWindow->nativeHandle(),
-                  mGC.get(),
-                  mXImage.get(),
-                  0, 0, // source x, y
-                  0, 0, // dest   x, y
-                  nativeWindow->getWidth(), nativeWindow->getHeight());
+        // present the damaged area only; the rest of the window holds the same pixels already.
+        auto area = window.frameDamage().valueOr(ARect<int>{ .p1 = glm::ivec2(0), .p2 = nativeWindow->getSize() });
+        area.p1 = glm::max(area.p1, glm::ivec2(0));
+        area.p2 = glm::min(area.p2, glm::ivec2(mBitmapSize));
+        if (glm::any(glm::greaterThanEqual(area.p1, area.p2))) {
+            return;
+        }
+        const auto size = area.size();
+        if (mShmSegment) {
+            XShmPutImage(PlatformAbstractionX11::ourDisplay,
+                         nativeWindow->nativeHandle(),
+                         mGC.get(),
+                         mXImage.get(),
+                         area.p1.x, area.p1.y, // source x, y
+                         area.p1.x, area.p1.y, // dest   x, y
+                         size.x, size.y,
+                         false);
+        } else {
+            XPutImage(PlatformAbstractionX11::ourDisplay,
+                      nativeWindow->nativeHandle(),
+                      mGC.get(),
+                      mXImage.get(),
+                      area.p1.x, area.p1.y, // source x, y
+                      area.p1.x, area.p1.y, // dest   x, y
+                      size.x, size.y);
+        }
+        // also guarantees the X server finished reading the shared framebuffer before the next frame is drawn to it.
         XSync(PlatformAbstractionX11::ourDisplay, false);
     }
 }
 
+bool SoftwareRenderingContextX11::reallocateShared() {
+    static const bool available = XShmQueryExtension(PlatformAbstractionX11::ourDisplay);
+    if (!available || mBitmapSize.x == 0 || mBitmapSize.y == 0) {
+        return false;
+    }
+    XShmSegmentInfo segment {};
+    auto image = XShmCreateImage(PlatformAbstractionX11::ourDisplay, vi->visual, vi->depth, ZPixmap, nullptr, &segment,
+                                 mBitmapSize.x, mBitmapSize.y);
+    if (!image) {
+        return false;
+    }
+    if (image->bytes_per_line != int(mBitmapSize.x * 4)) {
+        // SoftwareRenderingContext expects tightly packed 32-bit pixels.
+        XDestroyImage(image);
+        return false;
+    }
+    segment.shmid = shmget(IPC_PRIVATE, image->bytes_per_line * image->height, IPC_CREAT | 0600);
+    if (segment.shmid == -1) {
+        XDestroyImage(image);
+        return false;
+    }
+    segment.shmaddr = image->data = static_cast<char*>(shmat(segment.shmid, nullptr, 0));
+    // the segment is destroyed once both we and the X server detach from it, even if we crash.
+    AUI_DEFER { shmctl(segment.shmid, IPC_RMID, nullptr); };
+    if (segment.shmaddr == reinterpret_cast<char*>(-1)) {
+        image->data = nullptr;
+        XDestroyImage(image);
+        return false;
+    }
+    segment.readOnly = false;
+
+    // the server fails to attach asynchronously, i.e. if it runs on another machine.
+    gShmAttachFailed = false;
+    auto prevHandler = XSetErrorHandler(shmAttachErrorHandler);
+    const bool attached = XShmAttach(PlatformAbstractionX11::ourDisplay, &segment);
+    XSync(PlatformAbstractionX11::ourDisplay, false);
+    XSetErrorHandler(prevHandler);
+    if (!attached || gShmAttachFailed) {
+        shmdt(segment.shmaddr);
+        image->data = nullptr;
+        XDestroyImage(image);
+        return false;
+    }
+
+    mShmSegment = segment;
+    mBitmapBlob = reinterpret_cast<std::uint8_t*>(segment.shmaddr);
+    mXImage = aui::ptr::manage_unique(image, [&](XImage* image) {
+        XShmDetach(PlatformAbstractionX11::ourDisplay, &*mShmSegment);
+        XSync(PlatformAbstractionX11::ourDisplay, false);
+        image->data = nullptr;
+        XDestroyImage(image);
+        shmdt(mShmSegment->shmaddr);
+        mShmSegment.reset();
+        mBitmapBlob = nullptr;
+    });
+    mStencilBlob.reallocate(mBitmapSize.x * mBitmapSize.y);
+    return true;
+}
+
 void SoftwareRenderingContextX11::reallocate() {
     mXImage.reset();
+    mPreviousFrameAvailable = false;
+    if (PlatformAbstractionX11::ourDisplay.value() && vi && reallocateShared()) {
+        return;
+    }
     SoftwareRenderingContext::reallocate();
     if (!PlatformAbstractionX11::ourDisplay.value() || !vi) {
         return;
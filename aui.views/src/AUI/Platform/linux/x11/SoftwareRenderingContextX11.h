@@ -13,6 +13,7 @@
 
 #include <AUI/Platform/SoftwareRenderingContext.h>
 #include "RenderingContextX11.h"
+#include <X11/extensions/XShm.h>
 
 class SoftwareRenderingContextX11: public SoftwareRenderingContext, public RenderingContextX11 {
 public:
@@ -28,4 +29,16 @@ private:
     _<XImage> mXImage;
     std::unique_ptr<_XGC, void(*)(GC)> mGC = {nullptr, nullptr};
 
+    /**
+     * @brief Shared memory segment of mXImage if MIT-SHM is used. The framebuffer is presented without copying it
+     * through the X11 socket then.
+     */
+    AOptional<XShmSegmentInfo> mShmSegment;
+
+    /**
+     * @brief Allocates the framebuffer in a shared memory segment attached to the X server.
+     * @return false if MIT-SHM is not available (i.e. remote display), the caller falls back to XPutImage.
+     */
+    bool reallocateShared();
+
 };
\ No newline at end of file
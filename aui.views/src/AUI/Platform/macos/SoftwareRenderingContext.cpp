@@ -29,9 +29,11 @@ void SoftwareRenderingContext::destroyNativeWindow(ASurface &window) {
 
 void SoftwareRenderingContext::beginPaint(ASurface &window) {
     CommonRenderingContext::beginPaint(window);
+    beginFrame(window);
 }
 
 void SoftwareRenderingContext::endPaint(ASurface &window) {
+    endFrame();
     CommonRenderingContext::endPaint(window);
 }
 
@@ -34,9 +34,11 @@ void SoftwareRenderingContext::beginPaint(ASurface& window) {
         auto dataPtr = reinterpret_cast<uint32_t*>(mBitmapBlob.data() + sizeof(BITMAPINFO) + i * 4);
         *dataPtr = 0;
     }
+    beginFrame(window);
 }
 
 void SoftwareRenderingContext::endPaint(ASurface& window) {
+    endFrame();
     if (mPainterDC != 0) {
         StretchDIBits(mPainterDC,
                       0, 0,
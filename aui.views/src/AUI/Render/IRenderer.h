@@ -545,6 +545,15 @@ public:
      */
     virtual void setBlending(Blending blending) = 0;
 
+    /**
+     * @brief Submits draw calls deferred by the renderer.
+     * @details
+     * A renderer may batch draw calls. Code that interacts with the graphics API directly (i.e., changes OpenGL state
+     * or draws with its own shader) must call flush() first, so the deferred figures are drawn with the state they
+     * were submitted with.
+     */
+    virtual void flush() {}
+
 
     /**
      * @brief Returns a new instance of IRenderViewToTexture interface associated with this renderer.
@@ -29,13 +29,25 @@ void Util::SimpleTexturePacker::onResize(AImage& data, Util::dim side) {
 	else {
 		mImage = AImage(glm::uvec2(side, side), data.format());
 	}
+	mResized = true;
 }
 
 void Util::SimpleTexturePacker::onInsert(AImage& data, const Util::dim& x, const Util::dim& y) {
     mImage->insert({x, y}, data);
+    auto rect = ARect<dim>::fromTopLeftPositionAndSize({x, y}, {(dim)data.width(), (dim)data.height()});
+    if (mDirtyRect) {
+        mDirtyRect->p1 = glm::min(mDirtyRect->p1, rect.p1);
+        mDirtyRect->p2 = glm::max(mDirtyRect->p2, rect.p2);
+    } else {
+        mDirtyRect = rect;
+    }
 }
 
 glm::vec4 Util::SimpleTexturePacker::insert(AImage& data) {
 	return TexturePacker::insert(data, (dim)data.width(), (dim)data.height());
 }
 
+AOptional<glm::vec4> Util::SimpleTexturePacker::tryInsert(AImage& data, dim maxSide) {
+    return TexturePacker::tryInsert(data, (dim)data.width(), (dim)data.height(), maxSide);
+}
+
@@ -13,20 +13,58 @@
 
 #include "TexturePacker.h"
 #include "AUI/Image/AImage.h"
+#include "AUI/Geometry2D/ARect.h"
 
 namespace Util {
+    /**
+     * @brief Packs images into a single square AImage.
+     * @details
+     * The packer tracks which part of the image was modified since the last resetDirty() call, so a copy of the image
+     * (i.e., a GPU texture) can be updated incrementally. If the image was reallocated (isResized()), the whole copy
+     * has to be updated.
+     */
     class API_AUI_VIEWS SimpleTexturePacker : public ::Util::TexturePacker<AImage> {
     private:
         AOptional<AImage> mImage;
+        AOptional<ARect<dim>> mDirtyRect;
+        bool mResized = false;
+
     public:
         SimpleTexturePacker();
         ~SimpleTexturePacker();
         glm::vec4 insert(AImage& data) override;
         SimpleTexturePacker(const SimpleTexturePacker&) = delete;
 
+        /**
+         * @brief Inserts data unless the image would grow beyond maxSide.
+         * @return uv in pixels or std::nullopt if data does not fit.
+         */
+        AOptional<glm::vec4> tryInsert(AImage& data, dim maxSide);
+
         AOptional<AImage>& getImage() {
             return mImage;
         }
+
+        /**
+         * @brief The image was reallocated since the last resetDirty() call.
+         */
+        [[nodiscard]]
+        bool isResized() const noexcept {
+            return mResized;
+        }
+
+        /**
+         * @brief Bounding box of the images inserted since the last resetDirty() call.
+         */
+        [[nodiscard]]
+        const AOptional<ARect<dim>>& dirtyRect() const noexcept {
+            return mDirtyRect;
+        }
+
+        void resetDirty() noexcept {
+            mDirtyRect.reset();
+            mResized = false;
+        }
     protected:
         void onResize(AImage& data, dim side) override;
         void onInsert(AImage& data, const dim& x, const dim& y) override;
@@ -11,7 +11,9 @@
 
 #pragma once
 
+#include <limits>
 #include <glm/glm.hpp>
+#include "AUI/Common/AOptional.h"
 #include "AUI/Common/AVector.h"
 #include "AUI/Common/SharedPtr.h"
 
@@ -38,16 +40,27 @@ namespace Util {
     class TexturePacker : public TexturePacker_Lol {
     protected:
         glm::vec4 insert(T& data, dim width, dim height)
+        {
+            return *tryInsert(data, width, height, std::numeric_limits<dim>::max());
+        }
+
+        /**
+         * @brief Inserts data, growing the texture up to maxSide.
+         * @return uv in pixels or std::nullopt if the data does not fit into maxSide; the texture is left as is then.
+         */
+        AOptional<glm::vec4> tryInsert(T& data, dim width, dim height, dim maxSide)
         {
             if (side == 0)
                 resize(data, 64);
             Rect r(0, 0, 0, 0);
             while (!allocateRect(r, width, height))
             {
+                if (side > maxSide / 2)
+                    return std::nullopt;
                 resize(data, side * 2);
             }
             this->onInsert(data, r.x, r.y);
-            return { float(r.x), float(r.y), float(r.x + r.width), float(r.y + r.height) };
+            return glm::vec4{ float(r.x), float(r.y), float(r.x + r.width), float(r.y + r.height) };
         }
 
         virtual void onResize(T& data, dim side) = 0;
@@ -13,8 +13,10 @@
 // Created by Alex2772 on 12/5/2021.
 //
 
+#include <atomic>
 #include <range/v3/view.hpp>
 #include <AUI/Traits/callables.h>
+#include <AUI/Thread/AThreadPool.h>
 #include "SoftwareRenderer.h"
 #include "AUI/Enum/ImageRendering.h"
 #include "AUI/SL/SL.h"
@@ -107,6 +109,117 @@ private:
     }
 };
 
+/**
+ * @brief Draws a brush row by row with SoftwareRenderer::putSpan.
+ * @details
+ * The brush is resolved once per primitive. Pixel colors are computed exactly as BrushHelper does; brushes without a
+ * span implementation are drawn with BrushHelper pixel by pixel.
+ */
+class SpanPainter {
+public:
+    SpanPainter(SoftwareRenderer* renderer, const ABrush& brush, glm::ivec2 position, glm::ivec2 end)
+      : mRenderer(renderer), mBrush(brush), mPosition(position), mEnd(end),
+        mBrushHelper(renderer, mX, mY, mEnd, mPosition) {
+        std::visit(aui::lambda_overloaded {
+            [&](const ASolidBrush& brush) {
+                using namespace aui::sl_gen::rect_solid::fsh::software;
+                mKind = Kind::SOLID;
+                mSolidColor = Shader::entry({}, Shader::Uniform { .color = renderer->getColor() * brush.solidColor }).albedo;
+            },
+            [&](const ALinearGradientBrush& brush) {
+                mKind = Kind::GRADIENT;
+                mGradient.emplace(brush);
+            },
+            [&](const ATexturedBrush& brush) {
+                auto tex = dynamic_cast<SoftwareTexture*>(brush.texture.get());
+                if (brush.uv1 || brush.uv2 || mEnd - mPosition != glm::ivec2(tex->getImage().size())) {
+                    mKind = Kind::PER_PIXEL;
+                    return;
+                }
+                mKind = Kind::TEXTURE;
+                mTexture = tex;
+            },
+            [&](const ACustomShaderBrush& brush) {
+                mKind = Kind::NONE;
+            },
+        }, brush);
+    }
+
+    /**
+     * @brief Draws pixels [x1;x2) of row y.
+     */
+    void row(int y, int x1, int x2) {
+        const auto clipBegin = mRenderer->clipBegin();
+        const auto clipEnd = mRenderer->clipEnd();
+        if (y < clipBegin.y || y >= clipEnd.y) {
+            return;
+        }
+        x1 = glm::max(x1, clipBegin.x);
+        x2 = glm::min(x2, clipEnd.x);
+        if (x1 >= x2) {
+            return;
+        }
+        switch (mKind) {
+            case Kind::SOLID:
+                mRenderer->putSpan({ x1, y }, x2 - x1, mSolidColor);
+                return;
+
+            case Kind::GRADIENT: {
+                using namespace aui::sl_gen::rect_gradient::fsh::software;
+                const auto position = glm::vec2(mPosition);
+                const auto end = glm::vec2(mEnd);
+                mColors.resize(x2 - x1);
+                for (int x = x1; x < x2; ++x) {
+                    mColors[x - x1] = Shader::entry({ .uv = (glm::vec2(x, y) - position) / (end - position) },
+                                                    {
+                                                        .color1 = mGradient->colors[0],
+                                                        .color2 = mGradient->colors[1],
+                                                        .matUv = mGradient->matrix,
+                                                        .color = mRenderer->getColor(),
+                                                    }).albedo;
+                }
+                mRenderer->putSpan({ x1, y }, mColors);
+                return;
+            }
+
+            case Kind::TEXTURE: {
+                const auto& image = mTexture->getImage();
+                mColors.resize(x2 - x1);
+                for (int x = x1; x < x2; ++x) {
+                    mColors[x - x1] = mRenderer->getColor() * image.get(glm::uvec2{ x, y } - glm::uvec2(mPosition));
+                }
+                mRenderer->putSpan({ x1, y }, mColors);
+                return;
+            }
+
+            case Kind::PER_PIXEL:
+                for (mY = y, mX = x1; mX < x2; ++mX) {
+                    std::visit(mBrushHelper, mBrush);
+                }
+                return;
+
+            case Kind::NONE:
+                return;
+        }
+    }
+
+private:
+    enum class Kind { SOLID, GRADIENT, TEXTURE, PER_PIXEL, NONE };
+
+    SoftwareRenderer* mRenderer;
+    const ABrush& mBrush;
+    glm::ivec2 mPosition;
+    glm::ivec2 mEnd;
+    int mX = 0, mY = 0;
+    BrushHelper mBrushHelper;
+
+    Kind mKind = Kind::NONE;
+    AColor mSolidColor;
+    AOptional<aui::render::brush::gradient::Helper> mGradient;
+    SoftwareTexture* mTexture = nullptr;
+    AVector<AColor> mColors;
+};
+
 struct RoundedRect {
     int radius;
     int radius2;
@@ -184,15 +297,13 @@ void SoftwareRenderer::rectangle(const ABrush& brush,
                                  glm::vec2 size) {
     auto transformedPosition = glm::ivec2(mTransform * glm::vec4(position, 1.f, 1.f));
     auto end = transformedPosition + glm::ivec2(size);
+    if (record(glm::vec2(transformedPosition), glm::vec2(end), [=](SoftwareRenderer& r) { r.rectangle(brush, position, size); })) {
+        return;
+    }
 
-    int x, y;
-
-    auto sw = BrushHelper(this, x, y, end, transformedPosition);
-
-    for (y = transformedPosition.y; y < end.y; ++y) {
-        for (x = transformedPosition.x; x < end.x; ++x) {
-            std::visit(sw, brush);
-        }
+    SpanPainter painter(this, brush, transformedPosition, end);
+    for (int y = glm::max(transformedPosition.y, clipBegin().y); y < glm::min(end.y, clipEnd().y); ++y) {
+        painter.row(y, transformedPosition.x, end.x);
     }
 }
 
@@ -202,22 +313,59 @@ void SoftwareRenderer::roundedRectangle(const ABrush& brush,
                                         float radius) {
     RoundedRect r(int(radius), glm::ivec2(size), glm::ivec2(mTransform * glm::vec4(position, 1.f, 1.f)));
     auto end = r.transformedPosition + r.size;
+    if (record(glm::vec2(r.transformedPosition), glm::vec2(end), [=](SoftwareRenderer& renderer) {
+            renderer.roundedRectangle(brush, position, size, radius);
+        })) {
+        return;
+    }
 
     int x, y;
 
     auto sw = BrushHelper(this, x, y, end, r.transformedPosition);
 
-    for (y = r.transformedPosition.y; y < end.y; ++y) {
-        for (x = r.transformedPosition.x; x < end.x; ++x) {
-            if (int accumulator = r.test<true>(r.abs({x, y})); accumulator != 0) {
-                float alphaCopy = mColor.a;
-                mColor.a *= accumulator;
-                mColor.a /= 25;
-                std::visit(sw, brush);
-                mColor.a = alphaCopy;
-            }
+    // fully covered pixels get the same alpha as the antialiased path computes for them.
+    const float alphaCopy = mColor.a;
+    mColor.a *= 25;
+    mColor.a /= 25;
+    const float fullCoverageAlpha = mColor.a;
+    SpanPainter painter(this, brush, r.transformedPosition, end);
+
+    auto antialiasedPixel = [&] {
+        if (int accumulator = r.test<true>(r.abs({x, y})); accumulator != 0) {
+            mColor.a = alphaCopy;
+            mColor.a *= accumulator;
+            mColor.a /= 25;
+            std::visit(sw, brush);
+            mColor.a = fullCoverageAlpha;
+        }
+    };
+
+    // RoundedRect::test covers the pixel fully unless both abs() coordinates reach the corner area, so only the
+    // corners are drawn pixel by pixel.
+    const int cornerX = r.halfSize.x - r.radius;
+    const int cornerY = r.halfSize.y - r.radius;
+    const auto clipBegin = this->clipBegin();
+    const auto clipEnd = this->clipEnd();
+    for (y = glm::max(r.transformedPosition.y, clipBegin.y); y < glm::min(end.y, clipEnd.y); ++y) {
+        if (r.abs({r.center.x, y}).y < cornerY) {
+            painter.row(y, r.transformedPosition.x, end.x);
+            continue;
+        }
+        // pixels with abs(x) < cornerX
+        int fullBegin = r.transformedPosition.x, fullEnd = r.transformedPosition.x;
+        if (cornerX > 0) {
+            fullBegin = glm::max(r.center.x - cornerX + 1, r.transformedPosition.x);
+            fullEnd = glm::clamp(r.center.x + cornerX - int(r.size.x % 2 == 0), fullBegin, end.x);
+        }
+        for (x = glm::max(r.transformedPosition.x, clipBegin.x); x < glm::min(fullBegin, clipEnd.x); ++x) {
+            antialiasedPixel();
+        }
+        painter.row(y, fullBegin, fullEnd);
+        for (x = glm::max(fullEnd, clipBegin.x); x < glm::min(end.x, clipEnd.x); ++x) {
+            antialiasedPixel();
         }
     }
+    mColor.a = alphaCopy;
 }
 
 void SoftwareRenderer::rectangleBorder(const ABrush& brush,
@@ -239,13 +387,20 @@ void SoftwareRenderer::roundedRectangleBorder(const ABrush& brush,
     RoundedRect outside(int(radius), glm::ivec2(size), pos);
     RoundedRect inside(int(radius) - borderWidth, glm::ivec2(size) - glm::ivec2(borderWidth * 2), pos + glm::ivec2(borderWidth));
     auto end = outside.transformedPosition + outside.size;
+    if (record(glm::vec2(outside.transformedPosition), glm::vec2(end), [=](SoftwareRenderer& r) {
+            r.roundedRectangleBorder(brush, position, size, radius, borderWidth);
+        })) {
+        return;
+    }
 
     int x, y;
 
     auto sw = BrushHelper(this, x, y, end, outside.transformedPosition);
 
-    for (y = outside.transformedPosition.y; y < end.y; ++y) {
-        for (x = outside.transformedPosition.x; x < end.x; ++x) {
+    const auto clipBegin = this->clipBegin();
+    const auto clipEnd = this->clipEnd();
+    for (y = glm::max(outside.transformedPosition.y, clipBegin.y); y < glm::min(end.y, clipEnd.y); ++y) {
+        for (x = glm::max(outside.transformedPosition.x, clipBegin.x); x < glm::min(end.x, clipEnd.x); ++x) {
             int accumulator = outside.test<true>(outside.abs({ x, y }));
 
             if (x - outside.transformedPosition.x >= borderWidth &&
@@ -273,6 +428,11 @@ void SoftwareRenderer::boxShadow(glm::vec2 position,
                                  const AColor& color) {
 
     auto transformedPos = glm::vec2(mTransform * glm::vec4(position, 1.f, 1.f));
+    if (record(transformedPos - blurRadius, transformedPos + size + blurRadius, [=](SoftwareRenderer& r) {
+            r.boxShadow(position, size, blurRadius, color);
+        })) {
+        return;
+    }
 
     //transformedPos -= blurRadius;
     glm::ivec2 iTransformedPos(transformedPos - blurRadius);
@@ -287,19 +447,21 @@ void SoftwareRenderer::boxShadow(glm::vec2 position,
         .sigma = blurRadius / 2.f,
     };
 
-    for (int y = 0; y < iSize.y; ++y) { 
-        for (int x = 0; x < iSize.x; ++x) {
-            const auto result = Shader::entry(Shader::Inter {
-                .vertex = glm::ivec4(iTransformedPos + glm::ivec2{x, y}, 0, 1),
+    const auto clipBegin = this->clipBegin();
+    const auto clipEnd = this->clipEnd();
+    const int x1 = glm::max(iTransformedPos.x, clipBegin.x);
+    const int x2 = glm::min(iTransformedPos.x + iSize.x, clipEnd.x);
+    if (x1 >= x2) {
+        return;
+    }
+    AVector<AColor> colors(x2 - x1);
+    for (int y = glm::max(iTransformedPos.y, clipBegin.y); y < glm::min(iTransformedPos.y + iSize.y, clipEnd.y); ++y) {
+        for (int x = x1; x < x2; ++x) {
+            colors[x - x1] = Shader::entry(Shader::Inter {
+                .vertex = glm::ivec4(glm::ivec2{x, y}, 0, 1),
             }, uniform).albedo;
-
-            /*
-            glm::vec4 query = glm::vec4(pass_uv - glm::vec2(lower), pass_uv - glm::vec2(upper));
-            glm::vec4 integral = 0.5f + 0.5f * erf(query * (glm::sqrt(0.5f) / sigma));
-            float alpha = glm::clamp((integral.z - integral.x) * (integral.w - integral.y), 0.0f, 1.0f);
-*/
-            putPixel(iTransformedPos + glm::ivec2{ x, y }, result);
         }
+        putSpan({ x1, y }, colors);
     }
 }
 void SoftwareRenderer::boxShadowInner(glm::vec2 position,
@@ -311,6 +473,11 @@ void SoftwareRenderer::boxShadowInner(glm::vec2 position,
                                       glm::vec2 offset) {
 
     auto transformedPos = glm::vec2(mTransform * glm::vec4(position, 1.f, 1.f));
+    if (record(transformedPos, transformedPos + size + blurRadius * 2.f, [=](SoftwareRenderer& r) {
+            r.boxShadowInner(position, size, blurRadius, spreadRadius, borderRadius, color, offset);
+        })) {
+        return;
+    }
 
     //transformedPos -= blurRadius;
     glm::ivec2 iTransformedPos(transformedPos);
@@ -325,22 +492,159 @@ void SoftwareRenderer::boxShadowInner(glm::vec2 position,
         .sigma = blurRadius / 2.f,
     };
 
-    for (int y = 0; y < iSize.y; ++y) { 
-        for (int x = 0; x < iSize.x; ++x) {
-            const auto result = Shader::entry(Shader::Inter {
-                .vertex = glm::vec4(transformedPos + glm::vec2{x, y}, 0.f, 1.f),
+    const auto clipBegin = this->clipBegin();
+    const auto clipEnd = this->clipEnd();
+    const int x1 = glm::max(iTransformedPos.x, clipBegin.x);
+    const int x2 = glm::min(iTransformedPos.x + iSize.x, clipEnd.x);
+    if (x1 >= x2) {
+        return;
+    }
+    AVector<AColor> colors(x2 - x1);
+    for (int y = glm::max(iTransformedPos.y, clipBegin.y); y < glm::min(iTransformedPos.y + iSize.y, clipEnd.y); ++y) {
+        for (int x = x1; x < x2; ++x) {
+            colors[x - x1] = Shader::entry(Shader::Inter {
+                .vertex = glm::vec4(transformedPos + glm::vec2(glm::ivec2{x, y} - iTransformedPos), 0.f, 1.f),
             }, uniform).albedo;
+        }
+        putSpan({ x1, y }, colors);
+    }
+}
 
-            /*
-            glm::vec4 query = glm::vec4(pass_uv - glm::vec2(lower), pass_uv - glm::vec2(upper));
-            glm::vec4 integral = 0.5f + 0.5f * erf(query * (glm::sqrt(0.5f) / sigma));
-            float alpha = glm::clamp((integral.z - integral.x) * (integral.w - integral.y), 0.0f, 1.0f);
-*/
-            putPixel(iTransformedPos + glm::ivec2{ x, y }, result);
+
+void SoftwareRenderer::putSpan(glm::ivec2 position, int length, AColor color, AOptional<Blending> blending) noexcept {
+    AUI_ASSERTX(mContext != nullptr, "context is null");
+    const auto clipEnd = this->clipEnd();
+    if (position.y < mClipBegin.y || position.y >= clipEnd.y) {
+        return;
+    }
+    const int x1 = glm::max(position.x, mClipBegin.x);
+    const int x2 = glm::min(position.x + length, clipEnd.x);
+    if (x1 >= x2) {
+        return;
+    }
+    color = glm::clamp(color, glm::vec4(0), glm::vec4(1));
+    aui::software::Span span {
+        .pixels = mContext->pixelRow(position.y) + x1 * 4,
+        .stencil = mContext->stencilRow(position.y) + x1,
+        .length = std::size_t(x2 - x1),
+    };
+    if (mDrawingToStencil) {
+        if (color.a > 0.5f) {
+            aui::software::stencil(span, mDrawingStencilDirection, nullptr);
         }
+        return;
     }
+    aui::software::fill(span, mStencilDepth, color, blending ? *blending : mBlending);
 }
 
+void SoftwareRenderer::putSpan(glm::ivec2 position, std::span<const AColor> colors, AOptional<Blending> blending) noexcept {
+    AUI_ASSERTX(mContext != nullptr, "context is null");
+    const auto clipEnd = this->clipEnd();
+    if (position.y < mClipBegin.y || position.y >= clipEnd.y) {
+        return;
+    }
+    const int x1 = glm::max(position.x, mClipBegin.x);
+    const int x2 = glm::min(position.x + int(colors.size()), clipEnd.x);
+    if (x1 >= x2) {
+        return;
+    }
+    aui::software::Span span {
+        .pixels = mContext->pixelRow(position.y) + x1 * 4,
+        .stencil = mContext->stencilRow(position.y) + x1,
+        .length = std::size_t(x2 - x1),
+    };
+    const auto firstColor = colors.data() + (x1 - position.x);
+    if (mDrawingToStencil) {
+        aui::software::stencil(span, mDrawingStencilDirection, firstColor);
+        return;
+    }
+    aui::software::blend(span, mStencilDepth, firstColor, blending ? *blending : mBlending);
+}
+
+bool SoftwareRenderer::record(glm::vec2 begin, glm::vec2 end, std::function<void(SoftwareRenderer&)> draw) {
+    if (!mRecording) {
+        return false;
+    }
+    // bounds are widened by a pixel to stay conservative about rounding done by the primitives.
+    mDisplayList << DrawCall {
+        .begin = glm::ivec2(glm::floor(begin)) - 1,
+        .end = glm::ivec2(glm::ceil(end)) + 1,
+        .color = mColor,
+        .transform = mTransform,
+        .blending = mBlending,
+        .stencilDepth = mStencilDepth,
+        .drawingToStencil = mDrawingToStencil,
+        .drawingStencilDirection = mDrawingStencilDirection,
+        .draw = std::move(draw),
+    };
+    return true;
+}
+
+void SoftwareRenderer::beginRecording() {
+    mRecording = true;
+    mDisplayList.clear();
+}
+
+void SoftwareRenderer::endRecording() {
+    mRecording = false;
+    const auto bitmapSize = this->bitmapSize();
+    if (mDisplayList.empty() || glm::any(glm::lessThanEqual(bitmapSize, glm::ivec2(0)))) {
+        mDisplayList.clear();
+        return;
+    }
+
+    const auto clipBegin = this->clipBegin();
+    const auto clipEnd = this->clipEnd();
+    const auto tileCount = (bitmapSize + TILE_SIZE - 1) / TILE_SIZE;
+    AVector<AVector<std::uint32_t>> tiles(tileCount.x * tileCount.y);
+    for (std::uint32_t i = 0; i < mDisplayList.size(); ++i) {
+        const auto begin = glm::max(mDisplayList[i].begin, clipBegin);
+        const auto end = glm::min(mDisplayList[i].end, clipEnd);
+        if (glm::any(glm::greaterThanEqual(begin, end))) {
+            continue;
+        }
+        const auto firstTile = begin / TILE_SIZE;
+        const auto lastTile = (end - 1) / TILE_SIZE;
+        for (int y = firstTile.y; y <= lastTile.y; ++y) {
+            for (int x = firstTile.x; x <= lastTile.x; ++x) {
+                tiles[y * tileCount.x + x] << i;
+            }
+        }
+    }
+
+    // tiles are handed out one by one since their cost differs a lot (i.e. text vs empty background).
+    std::atomic_size_t nextTile = 0;
+    auto rasterizeTiles = [&] {
+        SoftwareRenderer renderer;
+        renderer.mContext = mContext;
+        for (std::size_t tile; (tile = nextTile++) < tiles.size();) {
+            if (tiles[tile].empty()) {
+                continue;
+            }
+            const auto tileBegin = glm::ivec2(tile % tileCount.x, tile / tileCount.x) * TILE_SIZE;
+            renderer.setClip(glm::max(tileBegin, clipBegin), glm::min(tileBegin + TILE_SIZE, clipEnd));
+            for (auto index : tiles[tile]) {
+                const auto& call = mDisplayList[index];
+                renderer.mColor = call.color;
+                renderer.mTransform = call.transform;
+                renderer.mBlending = call.blending;
+                renderer.mStencilDepth = call.stencilDepth;
+                renderer.mDrawingToStencil = call.drawingToStencil;
+                renderer.mDrawingStencilDirection = decltype(mDrawingStencilDirection)(call.drawingStencilDirection);
+                call.draw(renderer);
+            }
+        }
+    };
+
+    const auto taskCount = glm::min(AThreadPool::global().getTotalWorkerCount(), tiles.size());
+    AFutureSet<> futures;
+    for (std::size_t i = 1; i < taskCount; ++i) {
+        futures << AThreadPool::global() * rasterizeTiles;
+    }
+    rasterizeTiles();
+    futures.waitForAll();
+    mDisplayList.clear();
+}
 
 void SoftwareRenderer::setBlending(Blending blending) {
     mBlending = blending;
@@ -368,60 +672,99 @@ void SoftwareRenderer::popMaskAfter() {
 
 struct CharEntry {
     glm::ivec2 position;
-    AImage* image;
+
+    /**
+     * @brief Shared with the glyph cache of AFont which may evict the bitmap meanwhile.
+     */
+    _<AImage> image;
 };
 
+static void drawCharEntries(SoftwareRenderer& renderer, const AVector<CharEntry>& charEntries, FontRendering fontRendering) {
+    auto finalColor = AColor(renderer.getColor());
+    switch (fontRendering) {
+        case FontRendering::SUBPIXEL:
+            for (const auto& entry : charEntries) {
+                auto transformedPosition = glm::ivec2(renderer.getTransform() * glm::vec4(entry.position, 1.f, 1.f));
+                auto size = entry.image->size();
+                for (int y = 0; y < size.y; ++y) {
+                    for (int x = 0; x < size.x; ++x) {
+                        auto color = entry.image->get({x, y});
+                        
+                        renderer.putPixel(transformedPosition + glm::ivec2{ x, y }, AColor{ color.r, color.g, color.b, color.a * finalColor.a }, Blending::INVERSE_SRC);
+                        renderer.putPixel(transformedPosition + glm::ivec2{ x, y }, color * finalColor, Blending::ADDITIVE);
+                    }
+                }
+            }
+            break;
+        case FontRendering::ANTIALIASING: {
+            AVector<AColor> colors;
+            for (const auto& entry : charEntries) {
+                auto transformedPosition = glm::ivec2(renderer.getTransform() * glm::vec4(entry.position, 1.f, 1.f));
+                auto size = entry.image->size();
+                colors.resize(size.x);
+                for (int y = 0; y < size.y; ++y) {
+                    for (int x = 0; x < size.x; ++x) {
+                        colors[x] = { finalColor.r, finalColor.g, finalColor.b, finalColor.a * entry.image->get({x, y}).r };
+                    }
+                    renderer.putSpan(transformedPosition + glm::ivec2{ 0, y }, colors);
+                }
+            }
+            break;
+        }
+        case FontRendering::NEAREST:
+            break;
+    }
+}
+
 class SoftwarePrerenderedString: public IRenderer::IPrerenderedString {
 private:
     SoftwareRenderer* mRenderer;
-    AVector<CharEntry> mCharEntries;
+
+    /**
+     * @brief Shared with the draw calls recorded by tiled rendering.
+     */
+    _<const AVector<CharEntry>> mCharEntries;
     int mWidth = 0;
     int mHeight = 0;
     FontRendering mFontRendering;
 
+    /**
+     * @brief Bounds of the glyphs, relative to the string position.
+     */
+    glm::ivec2 mBoundsBegin{0};
+    glm::ivec2 mBoundsEnd{0};
+
 public:
     SoftwarePrerenderedString(SoftwareRenderer* renderer,
                               AVector<CharEntry> charEntries,
                               int width,
                               int height,
                               FontRendering fontRendering) : mRenderer(renderer),
-                                                             mCharEntries(std::move(charEntries)),
                                                              mWidth(width),
                                                              mHeight(height),
-                                                             mFontRendering(fontRendering) {}
+                                                             mFontRendering(fontRendering) {
+        if (!charEntries.empty()) {
+            mBoundsBegin = glm::ivec2(std::numeric_limits<int>::max());
+            mBoundsEnd = glm::ivec2(std::numeric_limits<int>::min());
+            for (const auto& entry : charEntries) {
+                mBoundsBegin = glm::min(mBoundsBegin, entry.position);
+                mBoundsEnd = glm::max(mBoundsEnd, entry.position + glm::ivec2(entry.image->size()));
+            }
+        }
+        mCharEntries = _new<const AVector<CharEntry>>(std::move(charEntries));
+    }
 
     void draw() override {
-        auto finalColor = AColor(mRenderer->getColor());
-        if (finalColor.isFullyTransparent()) return;
-        switch (mFontRendering) {
-            case FontRendering::SUBPIXEL:
-                for (const auto& entry : mCharEntries) {
-                    auto transformedPosition = glm::ivec2(mRenderer->getTransform() * glm::vec4(entry.position, 1.f, 1.f));
-                    auto size = entry.image->size();
-                    for (int y = 0; y < size.y; ++y) {
-                        for (int x = 0; x < size.x; ++x) {
-                            auto color = entry.image->get({x, y});
-                            
-                            mRenderer->putPixel(transformedPosition + glm::ivec2{ x, y }, AColor{ color.r, color.g, color.b, color.a * finalColor.a }, Blending::INVERSE_SRC);
-                            mRenderer->putPixel(transformedPosition + glm::ivec2{ x, y }, color * finalColor, Blending::ADDITIVE);
-                        }
-                    }
-                }
-                break;
-            case FontRendering::ANTIALIASING:
-                for (const auto& entry : mCharEntries) {
-                    auto transformedPosition = glm::ivec2(mRenderer->getTransform() * glm::vec4(entry.position, 1.f, 1.f));
-                    auto size = entry.image->size();
-                    for (int y = 0; y < size.y; ++y) {
-                        for (int x = 0; x < size.x; ++x) {
-                            mRenderer->putPixel(transformedPosition + glm::ivec2{ x, y }, { finalColor.r, finalColor.g, finalColor.b, finalColor.a * entry.image->get({x, y}).r });
-                        }
-                    }
-                }
-                break;
-            case FontRendering::NEAREST:
-                break;
+        if (AColor(mRenderer->getColor()).isFullyTransparent()) return;
+        const auto& transform = mRenderer->getTransform();
+        if (mRenderer->record(glm::vec2(transform * glm::vec4(mBoundsBegin, 1.f, 1.f)),
+                              glm::vec2(transform * glm::vec4(mBoundsEnd, 1.f, 1.f)),
+                              [charEntries = mCharEntries, fontRendering = mFontRendering](SoftwareRenderer& r) {
+                                  drawCharEntries(r, *charEntries, fontRendering);
+                              })) {
+            return;
         }
+        drawCharEntries(*mRenderer, *mCharEntries, mFontRendering);
     }
 
     int getWidth() override {
@@ -485,7 +828,7 @@ public:
                     notifySymbolAdded({pos});
                     mCharEntries.push_back(CharEntry{
                             pos,
-                            ch.image.get()
+                            ch.image
                     });
                 }
 
@@ -15,18 +15,59 @@
 #include <AUI/Render/IRenderer.h>
 #include <AUI/Platform/ASurface.h>
 #include <AUI/Platform/SoftwareRenderingContext.h>
+#include <AUI/Software/SoftwareSpan.h>
+#include <functional>
+#include <limits>
+#include <span>
 
 class API_AUI_VIEWS SoftwareRenderer: public IRenderer {
+    friend class SoftwarePrerenderedString;
 private:
-    SoftwareRenderingContext* mContext;
+    SoftwareRenderingContext* mContext = nullptr;
     bool mDrawingToStencil = false;
     enum {
         INCREASE = 1,
         DECREASE = -1
-    } mDrawingStencilDirection;
+    } mDrawingStencilDirection = INCREASE;
     Blending mBlending = Blending::NORMAL;
 
+    /**
+     * @brief Draw call of the display list along with the renderer state it was issued with.
+     */
+    struct DrawCall {
+        glm::ivec2 begin;
+        glm::ivec2 end;
+        AColor color;
+        glm::mat4 transform;
+        Blending blending;
+        uint8_t stencilDepth;
+        bool drawingToStencil;
+        int drawingStencilDirection;
+        std::function<void(SoftwareRenderer&)> draw;
+    };
+
+    bool mRecording = false;
+    AVector<DrawCall> mDisplayList;
+
+    /**
+     * @brief Pixels outside [mClipBegin; mClipEnd) are never touched. Used to restrict a renderer to a tile or to the
+     * damaged area of the window.
+     */
+    glm::ivec2 mClipBegin{0};
+    glm::ivec2 mClipEnd{std::numeric_limits<int>::max()};
+
+    /**
+     * @brief Records a draw call affecting the screen area [begin; end) if the renderer is recording.
+     * @return true, if the call is recorded and should not be rasterized now.
+     */
+    bool record(glm::vec2 begin, glm::vec2 end, std::function<void(SoftwareRenderer&)> draw);
+
 public:
+    /**
+     * @brief Tile size of tiled rendering, in pixels.
+     */
+    static constexpr int TILE_SIZE = 128;
+
     /**
      * Draws a pixel onto the software framebuffer following the stencil and blending rules.
      * <dl>
@@ -42,8 +83,8 @@ public:
         AUI_ASSERTX(mContext != nullptr, "context is null");
         color = glm::clamp(color, glm::vec4(0), glm::vec4(1));
         auto actualBlending = blending ? *blending : mBlending;
+        if (glm::any(glm::lessThan(position, mClipBegin)) || !glm::all(glm::lessThan(position, clipEnd()))) return;
         glm::uvec2 uposition(position);
-        if (!glm::all(glm::lessThan(uposition, mContext->bitmapSize()))) return;
 
         if (mDrawingToStencil) {
             if (color.a > 0.5f) {
@@ -51,58 +92,97 @@ public:
             }
         } else {
             auto bufferStencilValue = mContext->stencil(position);
-            if (bufferStencilValue == mStencilDepth)
-            {
-                switch (actualBlending) {
-                    case Blending::NORMAL:
-                        if (color.a >= 0.9999f) {
-                            mContext->putPixel(uposition, glm::u8vec4(glm::vec4(color) * 255.f));
-                        } else {
-                            // blending
-                            auto u8srcColor = mContext->getPixel(uposition);
-                            if (u8srcColor.a == 0) {
-                                // put the color "as is"
-                                mContext->putPixel(uposition, glm::u8vec4(color * 255.f));
-                            } else {
-                                auto srcColor = glm::vec3(u8srcColor.r, u8srcColor.g, u8srcColor.b);
-                                if (u8srcColor.a == 255) {
-                                    mContext->putPixel(uposition,
-                                                       glm::u8vec4(glm::mix(srcColor, glm::vec3(color) * 255.f, color.a), 255));
-                                } else {
-                                    // blend with the src color; calculate final alpha
-                                    auto dstColor = glm::vec3(color) * 255.f;
-                                    auto srcAlpha = float(u8srcColor.a) / 255.f;
-                                    float finalAlpha = srcAlpha + (1.f - srcAlpha) * color.a;
-                                    mContext->putPixel(uposition,
-                                                       glm::u8vec4(glm::u8vec3(srcColor * srcAlpha + dstColor * color.a), uint8_t(finalAlpha * 255.f)));
-                                }
-                            }
-                        }
-                        break;
-
-                    case Blending::ADDITIVE: {
-                        auto src = glm::uvec4(glm::vec4(color) * 255.f);
-                        src.a = (src.x + src.y + src.z) / 3.f;
-                        auto dst = glm::uvec4(mContext->getPixel(uposition));
-                        mContext->putPixel(uposition, glm::u8vec4((glm::min)(src + dst, glm::uvec4(255))));
-                        break;
-                    }
-                    case Blending::INVERSE_DST: {
-                        auto src = glm::vec3(color);
-                        auto dst = glm::vec3(mContext->getPixel(uposition)) / 255.f;
-                        mContext->putPixel(uposition, (glm::min)(glm::uvec3((src * (1.f - dst)) * 255.f), glm::uvec3(255)));
-                        break;
-                    }
-                    case Blending::INVERSE_SRC:
-                        auto src = glm::vec3(color);
-                        auto dstA = glm::vec4(mContext->getPixel(uposition)) / 255.f;
-                        auto dst = glm::vec3(dstA);
-                        mContext->putPixel(uposition, glm::u8vec4((glm::min)(glm::uvec3(((1.f - src) * dst) * 255.f), glm::uvec3(255)), glm::clamp(color.x + color.y + color.z, dstA.a, 1.f) * 255));
-                        break;
-                }
+            if (bufferStencilValue == mStencilDepth) {
+                mContext->putPixel(uposition, aui::software::blendPixel(mContext->getPixel(uposition), color, actualBlending));
             }
         }
     }
+
+    /**
+     * Draws a horizontal run of pixels of the same color following the stencil and blending rules. Produces the same
+     * result as putPixel called for each pixel of the run, but resolves blending and clipping once.
+     * @param position leftmost pixel of the run. The run is clipped by the framebuffer and the tile being drawn.
+     * @param length count of pixels.
+     * @param color color.
+     * @param blending blending. Optional. When set, the one set by the <code>setBlending</code> function is ignored.
+     */
+    void putSpan(glm::ivec2 position, int length, AColor color, AOptional<Blending> blending = std::nullopt) noexcept;
+
+    /**
+     * Draws a horizontal run of pixels of different colors following the stencil and blending rules. Produces the
+     * same result as putPixel called for each pixel of the run.
+     * @param position leftmost pixel of the run. The run is clipped by the framebuffer and the tile being drawn.
+     * @param colors color of each pixel of the run.
+     * @param blending blending. Optional. When set, the one set by the <code>setBlending</code> function is ignored.
+     */
+    void putSpan(glm::ivec2 position, std::span<const AColor> colors, AOptional<Blending> blending = std::nullopt) noexcept;
+
+    /**
+     * @return size of the framebuffer being drawn to.
+     */
+    [[nodiscard]]
+    glm::ivec2 bitmapSize() const noexcept {
+        return mContext ? glm::ivec2(mContext->bitmapSize()) : glm::ivec2(0);
+    }
+
+    /**
+     * @return top left pixel of the area the renderer draws to.
+     */
+    [[nodiscard]]
+    glm::ivec2 clipBegin() const noexcept {
+        return mClipBegin;
+    }
+
+    /**
+     * @return bottom right pixel (excluding) of the area the renderer draws to. The area is the whole framebuffer
+     * unless the renderer draws a tile or a clip is set with setClip.
+     */
+    [[nodiscard]]
+    glm::ivec2 clipEnd() const noexcept {
+        return glm::min(mClipEnd, bitmapSize());
+    }
+
+    /**
+     * @brief Restricts drawing to [begin; end). Pixels outside of the area are left intact.
+     * @details
+     * Used by SoftwareRenderingContext to repaint the damaged area of the window only, see ASurface::frameDamage.
+     */
+    void setClip(glm::ivec2 begin, glm::ivec2 end) noexcept {
+        mClipBegin = glm::max(begin, glm::ivec2(0));
+        mClipEnd = end;
+    }
+
+    /**
+     * @brief Allows drawing to the whole framebuffer.
+     */
+    void resetClip() noexcept {
+        mClipBegin = glm::ivec2(0);
+        mClipEnd = glm::ivec2(std::numeric_limits<int>::max());
+    }
+
+    /**
+     * @brief Starts recording draw calls to a display list instead of rasterizing them immediately.
+     * @details
+     * Used by SoftwareRenderingContext for tiled rendering. putPixel and putSpan are not recorded.
+     */
+    void beginRecording();
+
+    /**
+     * @brief Stops recording and rasterizes the display list.
+     * @details
+     * The framebuffer is split to tiles of TILE_SIZE; each draw call is binned to the tiles its screen bounds
+     * intersect. Tiles are rasterized in parallel on AThreadPool::global(), each one by a renderer clipped to the tile
+     * that replays the tile's draw calls in their original order with the state they were issued with. Tiles do not
+     * overlap, so each worker owns the pixels and the stencil values of its tile. Tiles outside of the clip set by
+     * setClip are skipped.
+     */
+    void endRecording();
+
+    [[nodiscard]]
+    bool isRecording() const noexcept {
+        return mRecording;
+    }
+
     _<IMultiStringCanvas> newMultiStringCanvas(const AFontStyle& style) override;
 
     void rectangle(const ABrush& brush,
@@ -0,0 +1,288 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SoftwareSpan.h"
+#include <cstring>
+
+#if AUI_ARCH_X86_64
+#include <emmintrin.h>
+#elif AUI_ARCH_ARM_64
+#include <arm_neon.h>
+#endif
+
+using namespace aui::software;
+
+namespace {
+
+/**
+ * @brief Alpha above which NORMAL blending replaces the pixel.
+ */
+constexpr float OPAQUE_ALPHA = 0.9999f;
+
+glm::u8vec4 loadRGBA(const std::uint8_t* bgra) noexcept {
+    return { bgra[2], bgra[1], bgra[0], bgra[3] };
+}
+
+void storeRGBA(std::uint8_t* bgra, glm::u8vec4 rgba) noexcept {
+    bgra[0] = rgba[2];
+    bgra[1] = rgba[1];
+    bgra[2] = rgba[0];
+    bgra[3] = rgba[3];
+}
+
+std::uint32_t packBGRA(glm::u8vec4 rgba) noexcept {
+    std::uint32_t result;
+    const std::uint8_t bytes[] = { rgba[2], rgba[1], rgba[0], rgba[3] };
+    std::memcpy(&result, bytes, sizeof(result));
+    return result;
+}
+
+#if AUI_ARCH_X86_64
+
+__m128 loadPixel(const std::uint8_t* bgra) noexcept {
+    std::int32_t packed;
+    std::memcpy(&packed, bgra, sizeof(packed));
+    const auto zero = _mm_setzero_si128();
+    auto v = _mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero);
+    return _mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero));
+}
+
+/**
+ * @brief Converts floats to bytes as static_cast<std::uint8_t> does in the reference implementation: truncation
+ * followed by taking the lowest byte.
+ */
+__m128i toBytes(__m128 v) noexcept {
+    auto i = _mm_and_si128(_mm_cvttps_epi32(v), _mm_set1_epi32(0xFF));
+    i = _mm_packs_epi32(i, i);
+    return _mm_packus_epi16(i, i);
+}
+
+void storePixel(std::uint8_t* bgra, __m128 v) noexcept {
+    const auto packed = _mm_cvtsi128_si32(toBytes(v));
+    std::memcpy(bgra, &packed, sizeof(packed));
+}
+
+/**
+ * @brief Stencil test of 4 pixels, expanded to a 32-bit mask per pixel.
+ */
+__m128i stencilMask4(const std::uint8_t* stencil, std::uint8_t depth) noexcept {
+    std::int32_t packed;
+    std::memcpy(&packed, stencil, sizeof(packed));
+    auto mask = _mm_cmpeq_epi8(_mm_cvtsi32_si128(packed), _mm_set1_epi8(char(depth)));
+    mask = _mm_unpacklo_epi8(mask, mask);
+    return _mm_unpacklo_epi16(mask, mask);
+}
+
+#endif
+
+/**
+ * @brief NORMAL blending of a single BGRA pixel. Same as blendPixel(), without the conversion to RGBA.
+ * @param color clamped color, RGBA.
+ * @param color255 color * 255, RGBA.
+ */
+void blendNormal(std::uint8_t* bgra, const glm::vec4& color, const glm::vec4& color255) noexcept {
+    const auto dstAlpha = bgra[3];
+    if (color.a >= OPAQUE_ALPHA || dstAlpha == 0) {
+        storeRGBA(bgra, glm::u8vec4(color255));
+        return;
+    }
+#if AUI_ARCH_X86_64
+    const auto dst = loadPixel(bgra);
+    const auto src255 = _mm_setr_ps(color255.b, color255.g, color255.r, 0.f);
+    const auto srcAlpha = _mm_set1_ps(color.a);
+    if (dstAlpha == 255) {
+        // mix(dst, src, a) = dst * (1 - a) + src * a
+        auto result = _mm_add_ps(_mm_mul_ps(dst, _mm_set1_ps(1.f - color.a)), _mm_mul_ps(src255, srcAlpha));
+        storePixel(bgra, result);
+        bgra[3] = 255;
+        return;
+    }
+    const float dstAlphaF = float(dstAlpha) / 255.f;
+    auto result = _mm_add_ps(_mm_mul_ps(dst, _mm_set1_ps(dstAlphaF)), _mm_mul_ps(src255, srcAlpha));
+    storePixel(bgra, result);
+    bgra[3] = std::uint8_t((dstAlphaF + (1.f - dstAlphaF) * color.a) * 255.f);
+#else
+    storeRGBA(bgra, blendPixel(loadRGBA(bgra), color, Blending::NORMAL));
+#endif
+}
+
+/**
+ * @brief Fills 4 pixels of opaque framebuffer (alpha 255) with a translucent color. The stencil test is done by the
+ * caller.
+ * @return false if some of the pixels are not opaque; nothing is written then.
+ */
+bool blendNormalOverOpaque4(std::uint8_t* bgra, const glm::vec4& color, const glm::vec4& color255) noexcept {
+#if AUI_ARCH_X86_64
+    const auto pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bgra));
+    const auto alphaMask = _mm_set1_epi32(int(0xFF000000));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(pixels, alphaMask), alphaMask)) != 0xFFFF) {
+        return false;
+    }
+    const auto zero = _mm_setzero_si128();
+    const auto inverseAlpha = _mm_set1_ps(1.f - color.a);
+    const auto srcAlpha = _mm_set1_ps(color.a);
+    const auto src = _mm_mul_ps(_mm_setr_ps(color255.b, color255.g, color255.r, 0.f), srcAlpha);
+    auto mix = [&](__m128i dst32) {
+        return _mm_and_si128(
+            _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(dst32), inverseAlpha), src)), _mm_set1_epi32(0xFF));
+    };
+    const auto lo = _mm_unpacklo_epi8(pixels, zero);
+    const auto hi = _mm_unpackhi_epi8(pixels, zero);
+    const auto p0 = mix(_mm_unpacklo_epi16(lo, zero));
+    const auto p1 = mix(_mm_unpackhi_epi16(lo, zero));
+    const auto p2 = mix(_mm_unpacklo_epi16(hi, zero));
+    const auto p3 = mix(_mm_unpackhi_epi16(hi, zero));
+    auto result = _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3));
+    result = _mm_or_si128(result, alphaMask);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(bgra), result);
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Stores the pixel to each of the pixels passing the stencil test.
+ */
+void fillOpaque(Span span, std::uint8_t stencilDepth, std::uint32_t pixel) noexcept {
+    std::size_t i = 0;
+#if AUI_ARCH_X86_64
+    const auto value = _mm_set1_epi32(int(pixel));
+    for (; i + 4 <= span.length; i += 4) {
+        auto dst = reinterpret_cast<__m128i*>(span.pixels + i * 4);
+        const auto mask = stencilMask4(span.stencil + i, stencilDepth);
+        const auto old = _mm_loadu_si128(dst);
+        _mm_storeu_si128(dst, _mm_or_si128(_mm_and_si128(mask, value), _mm_andnot_si128(mask, old)));
+    }
+#elif AUI_ARCH_ARM_64
+    const auto value = vdupq_n_u32(pixel);
+    const auto depth = vdup_n_u8(stencilDepth);
+    for (; i + 4 <= span.length; i += 4) {
+        auto dst = reinterpret_cast<std::uint32_t*>(span.pixels + i * 4);
+        std::uint32_t stencil4;
+        std::memcpy(&stencil4, span.stencil + i, sizeof(stencil4));
+        auto mask8 = vceq_u8(vreinterpret_u8_u32(vdup_n_u32(stencil4)), depth);
+        auto mask16 = vmovl_u8(mask8);
+        auto mask = vreinterpretq_u32_u16(vzip1q_u16(mask16, mask16));
+        vst1q_u32(dst, vbslq_u32(mask, value, vld1q_u32(dst)));
+    }
+#endif
+    for (; i < span.length; ++i) {
+        if (span.stencil[i] == stencilDepth) {
+            std::memcpy(span.pixels + i * 4, &pixel, sizeof(pixel));
+        }
+    }
+}
+
+bool stencilPasses4(const std::uint8_t* stencil, std::uint8_t stencilDepth) noexcept {
+    return stencil[0] == stencilDepth && stencil[1] == stencilDepth && stencil[2] == stencilDepth &&
+           stencil[3] == stencilDepth;
+}
+
+}   // namespace
+
+glm::u8vec4 aui::software::blendPixel(glm::u8vec4 dst, AColor color, Blending blending) noexcept {
+    switch (blending) {
+        case Blending::NORMAL: {
+            if (color.a >= OPAQUE_ALPHA || dst.a == 0) {
+                return glm::u8vec4(glm::vec4(color) * 255.f);
+            }
+            auto dstColor = glm::vec3(dst.r, dst.g, dst.b);
+            if (dst.a == 255) {
+                return glm::u8vec4(glm::mix(dstColor, glm::vec3(color) * 255.f, color.a), 255);
+            }
+            // blend with the dst color; calculate final alpha
+            auto srcColor = glm::vec3(color) * 255.f;
+            auto dstAlpha = float(dst.a) / 255.f;
+            float finalAlpha = dstAlpha + (1.f - dstAlpha) * color.a;
+            return glm::u8vec4(glm::u8vec3(dstColor * dstAlpha + srcColor * color.a), uint8_t(finalAlpha * 255.f));
+        }
+
+        case Blending::ADDITIVE: {
+            auto src = glm::uvec4(glm::vec4(color) * 255.f);
+            src.a = (src.x + src.y + src.z) / 3.f;
+            return glm::u8vec4((glm::min)(src + glm::uvec4(dst), glm::uvec4(255)));
+        }
+
+        case Blending::INVERSE_DST: {
+            auto src = glm::vec3(color);
+            auto dstColor = glm::vec3(dst) / 255.f;
+            return glm::u8vec4((glm::min)(glm::uvec3((src * (1.f - dstColor)) * 255.f), glm::uvec3(255)), 255);
+        }
+
+        case Blending::INVERSE_SRC: {
+            auto src = glm::vec3(color);
+            auto dstA = glm::vec4(dst) / 255.f;
+            auto dstColor = glm::vec3(dstA);
+            return glm::u8vec4((glm::min)(glm::uvec3(((1.f - src) * dstColor) * 255.f), glm::uvec3(255)),
+                               glm::clamp(color.x + color.y + color.z, dstA.a, 1.f) * 255);
+        }
+    }
+    return dst;
+}
+
+void aui::software::fill(Span span, std::uint8_t stencilDepth, AColor color, Blending blending) noexcept {
+    if (blending != Blending::NORMAL) {
+        for (std::size_t i = 0; i < span.length; ++i) {
+            if (span.stencil[i] == stencilDepth) {
+                auto pixel = span.pixels + i * 4;
+                storeRGBA(pixel, blendPixel(loadRGBA(pixel), color, blending));
+            }
+        }
+        return;
+    }
+
+    const auto color255 = glm::vec4(color) * 255.f;
+    if (color.a >= OPAQUE_ALPHA) {
+        fillOpaque(span, stencilDepth, packBGRA(glm::u8vec4(color255)));
+        return;
+    }
+    std::size_t i = 0;
+    for (; i + 4 <= span.length; i += 4) {
+        auto pixels = span.pixels + i * 4;
+        if (stencilPasses4(span.stencil + i, stencilDepth) && blendNormalOverOpaque4(pixels, color, color255)) {
+            continue;
+        }
+        for (std::size_t j = 0; j < 4; ++j) {
+            if (span.stencil[i + j] == stencilDepth) {
+                blendNormal(pixels + j * 4, color, color255);
+            }
+        }
+    }
+    for (; i < span.length; ++i) {
+        if (span.stencil[i] == stencilDepth) {
+            blendNormal(span.pixels + i * 4, color, color255);
+        }
+    }
+}
+
+void aui::software::blend(Span span, std::uint8_t stencilDepth, const AColor* colors, Blending blending) noexcept {
+    for (std::size_t i = 0; i < span.length; ++i) {
+        if (span.stencil[i] != stencilDepth) {
+            continue;
+        }
+        const auto color = glm::clamp(glm::vec4(colors[i]), glm::vec4(0), glm::vec4(1));
+        auto pixel = span.pixels + i * 4;
+        if (blending == Blending::NORMAL) {
+            blendNormal(pixel, color, color * 255.f);
+        } else {
+            storeRGBA(pixel, blendPixel(loadRGBA(pixel), color, blending));
+        }
+    }
+}
+
+void aui::software::stencil(Span span, int direction, const AColor* colors) noexcept {
+    for (std::size_t i = 0; i < span.length; ++i) {
+        if (colors == nullptr || glm::clamp(colors[i].a, 0.f, 1.f) > 0.5f) {
+            span.stencil[i] += direction;
+        }
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <AUI/Common/AColor.h>
+#include <AUI/Render/IRenderer.h>
+
+/**
+ * @brief Row kernels of SoftwareRenderer.
+ * @details
+ * Kernels operate on a horizontal run of pixels of the software framebuffer (BGRA, 4 bytes per pixel) and the
+ * corresponding stencil bytes. Clipping is the caller's responsibility.
+ *
+ * The kernels produce exactly the same pixels as blendPixel() applied to each pixel, which is the reference
+ * implementation used by SoftwareRenderer::putPixel.
+ */
+namespace aui::software {
+
+struct Span {
+    /**
+     * @brief First pixel, BGRA.
+     */
+    std::uint8_t* pixels;
+
+    /**
+     * @brief Stencil value of the first pixel.
+     */
+    std::uint8_t* stencil;
+
+    std::size_t length;
+};
+
+/**
+ * @brief Reference blending of a single pixel.
+ * @param dst framebuffer pixel, RGBA.
+ * @param color source color, clamped to [0;1].
+ * @return new framebuffer pixel, RGBA.
+ */
+API_AUI_VIEWS glm::u8vec4 blendPixel(glm::u8vec4 dst, AColor color, Blending blending) noexcept;
+
+/**
+ * @brief Blends color to the pixels whose stencil value equals to stencilDepth.
+ * @param color source color, clamped to [0;1].
+ */
+API_AUI_VIEWS void fill(Span span, std::uint8_t stencilDepth, AColor color, Blending blending) noexcept;
+
+/**
+ * @brief Blends colors[i] to the i-th pixel if its stencil value equals to stencilDepth.
+ * @param colors span.length source colors; clamped to [0;1] by the kernel.
+ */
+API_AUI_VIEWS void blend(Span span, std::uint8_t stencilDepth, const AColor* colors, Blending blending) noexcept;
+
+/**
+ * @brief Adds direction to stencil values of the pixels whose color is opaque enough to affect the mask.
+ * @param colors span.length source colors or nullptr if all pixels are covered.
+ */
+API_AUI_VIEWS void stencil(Span span, int direction, const AColor* colors) noexcept;
+
+}   // namespace aui::software
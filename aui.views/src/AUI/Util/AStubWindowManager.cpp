@@ -40,9 +40,12 @@ public:
 
     void beginPaint(ASurface& window) override {
         std::memset(mStencilBlob.data(), 0, mStencilBlob.getSize());
+        beginFrame(window);
     }
 
-    void endPaint(ASurface& window) override {}
+    void endPaint(ASurface& window) override {
+        endFrame();
+    }
 
     IRenderer& renderer() override {
         return *gStubWindowManagerConfig->renderer;
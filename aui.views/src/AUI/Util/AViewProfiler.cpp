@@ -24,6 +24,7 @@ void AViewProfiler::displayBoundsOn(AView& v, ARenderContext ctx) {
 
     RenderHints::PushMatrix m(ctx.render);
     ctx.render.setTransform(glm::translate(glm::mat4(1.f), glm::vec3{v.getPositionInWindow(), 0.f}));
+    ctx.render.flush();
     glEnable(GL_STENCIL_TEST);
     glStencilMask(0xff);
     glStencilOp(GL_INCR, GL_INCR, GL_INCR);
@@ -50,6 +51,7 @@ void AViewProfiler::displayBoundsOn(AView& v, ARenderContext ctx) {
                              {v.getWidth() + v.getMargin().horizontal(), v.getHeight() + v.getMargin().vertical()});
     }
 
+    ctx.render.flush();
     glDisable(GL_STENCIL_TEST);
     // labels
     {
@@ -0,0 +1,121 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "AViewSpatialIndex.h"
+#include <algorithm>
+
+AViewSpatialIndex::AViewSpatialIndex(int cellSize) : mCellSize(cellSize) {
+    AUI_ASSERT(cellSize > 0);
+}
+
+int AViewSpatialIndex::cellOf(int coordinate) const noexcept {
+    // floor division; negative coordinates are valid.
+    return coordinate >= 0 ? coordinate / mCellSize : -((-coordinate - 1) / mCellSize) - 1;
+}
+
+AViewSpatialIndex::Item AViewSpatialIndex::makeItem(ARect<int> rect) const noexcept {
+    Item item {
+        .firstCell = { cellOf(rect.min().x), cellOf(rect.min().y) },
+        .lastCell = { cellOf(rect.max().x), cellOf(rect.max().y) },
+    };
+    const auto cells = glm::i64vec2(item.lastCell - item.firstCell) + std::int64_t(1);
+    item.oversized = std::uint64_t(cells.x * cells.y) > MAX_CELLS_PER_ITEM;
+    return item;
+}
+
+void AViewSpatialIndex::insert(std::size_t index) {
+    const auto& item = mItems[index];
+    if (item.oversized) {
+        mOversized << index;
+        return;
+    }
+    for (int y = item.firstCell.y; y <= item.lastCell.y; ++y) {
+        for (int x = item.firstCell.x; x <= item.lastCell.x; ++x) {
+            mCells[key(x, y)] << index;
+        }
+    }
+}
+
+void AViewSpatialIndex::erase(std::size_t index) {
+    const auto& item = mItems[index];
+    auto swapRemove = [&](AVector<std::size_t>& items) {
+        auto it = std::find(items.begin(), items.end(), index);
+        AUI_ASSERT(it != items.end());
+        *it = items.back();
+        items.pop_back();
+    };
+    if (item.oversized) {
+        swapRemove(mOversized);
+        return;
+    }
+    for (int y = item.firstCell.y; y <= item.lastCell.y; ++y) {
+        for (int x = item.firstCell.x; x <= item.lastCell.x; ++x) {
+            auto cell = mCells.find(key(x, y));
+            AUI_ASSERT(cell != mCells.end());
+            swapRemove(cell->second);
+            if (cell->second.empty()) {
+                mCells.erase(cell);
+            }
+        }
+    }
+}
+
+void AViewSpatialIndex::rebuild(const AVector<ARect<int>>& rects) {
+    mItems.clear();
+    mCells.clear();
+    mOversized.clear();
+    mItems.reserve(rects.size());
+    for (std::size_t i = 0; i < rects.size(); ++i) {
+        mItems << makeItem(rects[i]);
+        insert(i);
+    }
+}
+
+void AViewSpatialIndex::update(std::size_t item, ARect<int> rect) {
+    AUI_ASSERT(item < mItems.size());
+    auto newItem = makeItem(rect);
+    auto& oldItem = mItems[item];
+    if (newItem.oversized == oldItem.oversized &&
+        (newItem.oversized || (newItem.firstCell == oldItem.firstCell && newItem.lastCell == oldItem.lastCell))) {
+        return;
+    }
+    erase(item);
+    oldItem = newItem;
+    insert(item);
+}
+
+AVector<std::size_t> AViewSpatialIndex::query(ARect<int> area) const {
+    const glm::ivec2 firstCell { cellOf(area.min().x), cellOf(area.min().y) };
+    const glm::ivec2 lastCell { cellOf(area.max().x), cellOf(area.max().y) };
+    const auto cells = glm::i64vec2(lastCell - firstCell) + std::int64_t(1);
+
+    AVector<std::size_t> result;
+    if (std::uint64_t(cells.x * cells.y) > mItems.size()) {
+        // visiting the cells is more expensive than returning everything.
+        result.resize(mItems.size());
+        for (std::size_t i = 0; i < result.size(); ++i) {
+            result[i] = i;
+        }
+        return result;
+    }
+
+    result = mOversized;
+    for (int y = firstCell.y; y <= lastCell.y; ++y) {
+        for (int x = firstCell.x; x <= lastCell.x; ++x) {
+            if (auto cell = mCells.find(key(x, y)); cell != mCells.end()) {
+                result.insert(result.end(), cell->second.begin(), cell->second.end());
+            }
+        }
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
@@ -0,0 +1,86 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <AUI/Common/AVector.h>
+#include <AUI/Geometry2D/ARect.h>
+#include <AUI/Views.h>
+
+/**
+ * @brief Uniform grid of rectangles, used by AViewContainerBase to cull and hit-test its children.
+ * @details
+ * Items are identified by their indices; the rectangle of an item is updated incrementally with update(). Each item is
+ * registered in the grid cells its rectangle covers; items covering more than MAX_CELLS_PER_ITEM cells are stored
+ * aside and returned by every query.
+ *
+ * Bounds of rectangles and of the query area are inclusive, so the query result is a superset of the items whose
+ * rectangles intersect the area in terms of ARect::isIntersects. The caller is still expected to perform the exact
+ * check.
+ */
+class API_AUI_VIEWS AViewSpatialIndex {
+public:
+    static constexpr int DEFAULT_CELL_SIZE = 256;
+    static constexpr std::size_t MAX_CELLS_PER_ITEM = 64;
+
+    explicit AViewSpatialIndex(int cellSize = DEFAULT_CELL_SIZE);
+
+    /**
+     * @brief Replaces all items. The i-th rectangle defines the i-th item.
+     */
+    void rebuild(const AVector<ARect<int>>& rects);
+
+    /**
+     * @brief Moves the item.
+     */
+    void update(std::size_t item, ARect<int> rect);
+
+    /**
+     * @brief Items whose rectangles might intersect the area, in ascending order.
+     */
+    [[nodiscard]]
+    AVector<std::size_t> query(ARect<int> area) const;
+
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+        return mItems.size();
+    }
+
+private:
+    struct Item {
+        /**
+         * @brief Covered cells, inclusive; not defined for oversized items.
+         */
+        glm::ivec2 firstCell, lastCell;
+        bool oversized;
+    };
+
+    int mCellSize;
+    AVector<Item> mItems;
+    std::unordered_map<std::uint64_t, AVector<std::size_t>> mCells;
+    AVector<std::size_t> mOversized;
+
+    [[nodiscard]]
+    Item makeItem(ARect<int> rect) const noexcept;
+
+    void insert(std::size_t index);
+    void erase(std::size_t index);
+
+    [[nodiscard]]
+    int cellOf(int coordinate) const noexcept;
+
+    [[nodiscard]]
+    static std::uint64_t key(int x, int y) noexcept {
+        return (std::uint64_t(std::uint32_t(x)) << 32) | std::uint32_t(y);
+    }
+};
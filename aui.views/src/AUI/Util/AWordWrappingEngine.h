@@ -77,6 +77,18 @@ public:
     // include AWordWrappingEngineImpl.h for implementation
     void performLayout(const glm::ivec2& offset, const glm::ivec2& size);
 
+    /**
+     * @brief Lays out [begin, end) range of entries only, regardless of the rest of entries.
+     * @return height of the range.
+     * @details
+     * Used by views that lay out independent parts of the text (i.e., paragraphs) separately, in order to re-wrap the
+     * changed parts only. height() is not affected.
+     *
+     * include AWordWrappingEngineImpl.h for implementation
+     */
+    template<typename Iterator>
+    int performLayout(Iterator begin, Iterator end, const glm::ivec2& offset, const glm::ivec2& size);
+
     void setEntries(Container entries) {
         mEntries = std::move(entries);
     }
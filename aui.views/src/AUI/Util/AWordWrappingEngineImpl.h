@@ -17,9 +17,15 @@
 
 template<typename Container>
 void AWordWrappingEngine<Container>::performLayout(const glm::ivec2& offset, const glm::ivec2& size) {
-    if (mEntries.empty()) {
-        mHeight = 0;
-        return;
+    mHeight = performLayout(mEntries.begin(), mEntries.end(), offset, size);
+}
+
+template<typename Container>
+template<typename Iterator>
+int AWordWrappingEngine<Container>::performLayout(Iterator begin, Iterator end, const glm::ivec2& offset,
+                                                  const glm::ivec2& size) {
+    if (begin == end) {
+        return 0;
     }
 
 
@@ -170,7 +176,7 @@ void AWordWrappingEngine<Container>::performLayout(const glm::ivec2& offset, con
 
     beginRow();
 
-    for (auto currentItem = mEntries.begin(); currentItem != mEntries.end(); ++currentItem) {
+    for (auto currentItem = begin; currentItem != end; ++currentItem) {
         auto currentItemSize = (*currentItem)->getSize();
         bool forcesNextLine = (*currentItem)->forcesNextLine();
         bool escapesEdges = (*currentItem)->escapesEdges();
@@ -241,5 +247,5 @@ void AWordWrappingEngine<Container>::performLayout(const glm::ivec2& offset, con
         return ranges::max(r | ranges::views::transform([](const FloatingEntry& e) { return e.position.y + e.remainingHeight; }));
     }();
 
-    mHeight = std::max(currentY + int(float(currentRowHeight) * mLineHeight), floatingMax) - offset.y;
+    return std::max(currentY + int(float(currentRowHeight) * mLineHeight), floatingMax) - offset.y;
 }
@@ -226,5 +226,12 @@ private:
                 AObject::connect(c->defaultState, AUI_SLOT(helper)::onInvalidateStateAss);
             }
         }
+
+        IndexKey indexKey() const override {
+            if (auto key = mWrapped->indexKey(); !key.isUniversal()) {
+                return key;
+            }
+            return { IndexKey::Type { [](AView* view) { return dynamic_cast<AButton*>(view) != nullptr; } } };
+        }
     };
 }
@@ -9,6 +9,8 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <limits>
+#include <unordered_map>
 #include <range/v3/all.hpp>
 #include "AForEachUI.h"
 
@@ -18,10 +20,182 @@ static constexpr auto INFLATE_STEP_PX = RENDER_TO_TEXTURE_TILE_SIZE * 2;
 static constexpr auto POTENTIAL_PERFORMANCE_ISSUE_VIEWS_COUNT_THRESHOLD = 100;
 static constexpr auto LOG_TAG = "AForEachUIBase";
 
+namespace {
+/**
+ * @brief Indices of a longest strictly increasing subsequence of values, in ascending order.
+ */
+AVector<std::size_t> longestIncreasingSubsequence(const AVector<std::size_t>& values) {
+    AVector<std::size_t> tails;   // tails[k] is the index of the smallest tail of an increasing subsequence of length k + 1
+    AVector<std::size_t> predecessors(values.size(), std::numeric_limits<std::size_t>::max());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        auto it = std::lower_bound(tails.begin(), tails.end(), values[i], [&](std::size_t tail, std::size_t value) {
+            return values[tail] < value;
+        });
+        if (it != tails.begin()) {
+            predecessors[i] = *std::prev(it);
+        }
+        if (it == tails.end()) {
+            tails << i;
+        } else {
+            *it = i;
+        }
+    }
+    AVector<std::size_t> result(tails.size());
+    if (!tails.empty()) {
+        auto i = tails.last();
+        for (auto k = result.size(); k-- > 0; i = predecessors[i]) {
+            result[k] = i;
+        }
+    }
+    return result;
+}
+}   // namespace
+
 void AForEachUIBase::setModelImpl(AForEachUIBase::List model) {
-    putOurViewsToSharedCache();
+    auto viewsCache = getViewsCache();
+    if (!viewsCache || !mCache || mCache->items.empty()) {
+        putOurViewsToSharedCache();
+        mViewsModelCapabilities = model.capabilities();
+        mViewsModel = std::move(model);
+        return;
+    }
+
+    // iterators of the presented items are not valid anymore; keep views and keys only.
+    AVector<Entry> presented;
+    presented.reserve(mCache->items.size());
+    for (auto& item : mCache->items) {
+        presented << Entry { .view = std::move(item.view), .id = item.id };
+    }
+    mCache->items.clear();
     mViewsModelCapabilities = model.capabilities();
     mViewsModel = std::move(model);
+    reconcile(std::move(presented), *viewsCache);
+}
+
+void AForEachUIBase::reconcile(AVector<Entry> presented, aui::for_each_ui::detail::ViewsSharedCache& viewsCache) {
+    AUI_ASSERT(mCache);
+    AUI_ASSERT(getViews().size() == presented.size());
+    static constexpr auto NONE = std::numeric_limits<std::size_t>::max();
+
+    // keys of the new range are scanned on demand, since the range might be long (or infinite) and only a window of
+    // it is presented in case of a viewport.
+    AVector<List::iterator> iterators;
+    AVector<aui::for_each_ui::Key> keys;
+    auto it = mViewsModel.begin();
+    const auto end = mViewsModel.end();
+    auto scanTill = [&](std::size_t count) {
+        mKeysOnly = true;
+        AUI_DEFER { mKeysOnly = false; };
+        for (; keys.size() < count && it != end; ++it) {
+            keys << (*it).id;
+            iterators << it;
+        }
+    };
+
+    std::size_t first = 0;
+    std::size_t last = 0;
+    if (!mViewport.lock()) {
+        scanTill(NONE);
+        last = keys.size();
+    } else {
+        // the presented window follows the first presented item found in the new range, so the scroll position is
+        // kept.
+        std::unordered_map<aui::for_each_ui::Key, std::size_t> offsetOf;
+        for (std::size_t i = presented.size(); i-- > 0;) {
+            offsetOf[presented[i].id] = i;
+        }
+        scanTill(mCache->firstIndex + presented.size() * 2);
+        first = std::min(mCache->firstIndex, keys.size());
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            if (auto offset = offsetOf.find(keys[i]); offset != offsetOf.end()) {
+                first = i >= offset->second ? i - offset->second : 0;
+                break;
+            }
+        }
+        scanTill(first + presented.size());
+        last = std::min(first + presented.size(), keys.size());
+        mInflateAfterReconcile = true;
+    }
+
+    // match the presented views by keys; equal keys are matched in order.
+    std::unordered_map<aui::for_each_ui::Key, AVector<std::size_t>> presentedByKey;
+    for (std::size_t i = presented.size(); i-- > 0;) {
+        presentedByKey[presented[i].id] << i;
+    }
+    AVector<std::size_t> oldIndexOf(last - first, NONE);
+    AVector<std::size_t> matched;   // old indices of the matched items, in the new order
+    for (std::size_t i = first; i < last; ++i) {
+        auto candidates = presentedByKey.find(keys[i]);
+        if (candidates == presentedByKey.end() || candidates->second.empty()) {
+            continue;
+        }
+        oldIndexOf[i - first] = candidates->second.last();
+        candidates->second.pop_back();
+        matched << oldIndexOf[i - first];
+    }
+
+    // the longest increasing subsequence of the matched views stays in place; the rest of them is moved.
+    AVector<bool> stays(presented.size(), false);
+    AVector<bool> moves(presented.size(), false);
+    for (auto old : matched) {
+        moves[old] = true;
+    }
+    for (auto i : longestIncreasingSubsequence(matched)) {
+        stays[matched[i]] = true;
+        moves[matched[i]] = false;
+    }
+
+    bool putToSharedCache = false;
+    for (std::size_t old = presented.size(); old-- > 0;) {
+        if (stays[old]) {
+            continue;
+        }
+        AViewContainerBase::removeView(old);
+        if (!moves[old]) {
+            // other AForEachUIs of the same kind might adopt the view.
+            viewsCache[presented[old].id] = std::move(presented[old].view);
+            putToSharedCache = true;
+        }
+    }
+    if (putToSharedCache) {
+        scheduleSharedCacheCleanup(viewsCache);
+    }
+
+    mCache->firstIndex = first;
+    mCache->items.reserve(last - first);
+    for (std::size_t i = first; i < last; ++i) {
+        const auto old = oldIndexOf[i - first];
+        Cache::LazyListItemInfo item;
+        if (old == NONE) {
+            static_cast<Entry&>(item) = *iterators[i];
+            AViewContainerBase::addView(i - first, item.view);
+        } else {
+            static_cast<Entry&>(item) = std::move(presented[old]);
+            if (moves[old]) {
+                AViewContainerBase::addView(i - first, item.view);
+            }
+        }
+        item.iterator = iterators[i];
+        mCache->items << std::move(item);
+    }
+    AUI_ASSERT(getViews().size() == mCache->items.size());
+    if (mCache->items.empty()) {
+        // nothing left to follow; present the range from scratch.
+        mCache.reset();
+    }
+
+    if (mInflateAfterReconcile) {
+        // the window might be truncated; let the next layout update inflate it.
+        markMinContentSizeInvalid();
+    }
+}
+
+void AForEachUIBase::scheduleSharedCacheCleanup(aui::for_each_ui::detail::ViewsSharedCache& viewsCache) {
+    if (auto w = AWindow::current()) {
+        connect(w->layoutUpdateComplete, AObject::GENERIC_OBSERVER, [viewsCache = &viewsCache] {
+            viewsCache->clear();
+        });
+    }
 }
 
 void AForEachUIBase::putOurViewsToSharedCache() {
@@ -34,12 +208,7 @@ void AForEachUIBase::putOurViewsToSharedCache() {
             (*viewsCache)[e.id] = std::move(e.view);
 //            ALOG_DEBUG(LOG_TAG) << this << "(" << AReflect::name(this) << ") Cached view for id: " << e.id;
         }
-
-        if (auto w = AWindow::current()) {
-            connect(w->layoutUpdateComplete, AObject::GENERIC_OBSERVER, [viewsCache] {
-                viewsCache->clear();
-            });
-        }
+        scheduleSharedCacheCleanup(*viewsCache);
     }
     mCache.reset();
 }
@@ -64,6 +233,7 @@ void AForEachUIBase::applyGeometryToChildren() {
 
     if (!mCache) {
         mCache.emplace();
+        mInflateAfterReconcile = false;
         inflate();
         return;
     }
@@ -74,6 +244,10 @@ void AForEachUIBase::applyGeometryToChildren() {
     //    ALOG_DEBUG(LOG_TAG) << this << " compensateLayoutUpdatesByScroll";
     viewport->compensateLayoutUpdatesByScroll(
         getViews().first(), [this] { AViewContainerBase::applyGeometryToChildren(); }, axisMask());
+
+    if (std::exchange(mInflateAfterReconcile, false)) {
+        inflate({ .backward = false, .forward = true });
+    }
 }
 
 void AForEachUIBase::onViewGraphSubtreeChanged() {
@@ -315,6 +489,10 @@ void AForEachUIBase::addView(List::iterator iterator, AOptional<std::size_t> ind
     auto at = mCache->items.end();
     if (index) {
         at = mCache->items.begin() + *index;
+        if (*index == 0 && !mCache->items.empty()) {
+            AUI_ASSERT(mCache->firstIndex > 0);
+            --mCache->firstIndex;
+        }
     }
     entry.iterator = std::move(iterator);
     mCache->items.insert(at, std::move(entry));
@@ -329,6 +507,9 @@ void AForEachUIBase::removeViews(aui::range<AVector<_<AView>>::const_iterator> i
     auto idx = std::distance(getViews().begin(), iterators.begin());
     auto size = iterators.size();
     AViewContainerBase::removeViews(iterators);
+    if (idx == 0) {
+        mCache->firstIndex += size;
+    }
     mCache->items.erase(mCache->items.begin() + idx, mCache->items.begin() + idx + size);
 }
 
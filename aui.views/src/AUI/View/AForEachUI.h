@@ -70,15 +70,31 @@ protected:
             List::iterator iterator;
         };
         AVector<LazyListItemInfo> items;
+
+        /**
+         * @brief Index of the first presented item within the range.
+         */
+        std::size_t firstIndex = 0;
     };
 
     AOptional<Cache> mCache;
 
+    /**
+     * @brief When set, dereferencing an iterator of the range must only compute Entry::id, leaving Entry::view null.
+     * @details
+     * Used by setModelImpl to diff keys of the new range against the presented views without instantiating views.
+     */
+    bool mKeysOnly = false;
+
     void onViewGraphSubtreeChanged() override;
     void applyGeometryToChildren() override;
 
     /**
      * @brief Notifies that range was changed or iterators might have invalidated.
+     * @details
+     * If views are cached (see getViewsCache), the presented views are reconciled with the new range by keys: only
+     * the views of inserted, removed or moved items are touched. Otherwise, all views are removed and the new range is
+     * presented from scratch.
      */
     void setModelImpl(List model);
 
@@ -99,6 +115,22 @@ private:
     aui::dyn_range_capabilities mViewsModelCapabilities;
     AOptional<glm::ivec2> mLastInflatedScroll {};
 
+    /**
+     * @brief Reconciliation might have shrunk the presented window; inflate it on the next layout update.
+     */
+    bool mInflateAfterReconcile = false;
+
+    /**
+     * @brief Keyed diff of the presented views against mViewsModel.
+     * @param presented presented views, in order.
+     * @details
+     * Views whose keys form the longest increasing subsequence of the old positions stay in place; the rest of the
+     * matched views are moved. Views of the removed items are put to the shared cache.
+     */
+    void reconcile(AVector<Entry> presented, aui::for_each_ui::detail::ViewsSharedCache& viewsCache);
+
+    void scheduleSharedCacheCleanup(aui::for_each_ui::detail::ViewsSharedCache& viewsCache);
+
     void addView(List::iterator iterator, AOptional<std::size_t> index = std::nullopt);
     void removeViews(aui::range<AVector<_<AView>>::const_iterator> iterators);
 
@@ -286,6 +318,9 @@ public:
                        //
                        // see UIDeclarativeForTest.IntGroupingDynamic1 test for more info and reproducer.
                        aui::hash_combine(key, aui::for_each_ui::defaultKey(t));
+                       if (mKeysOnly) {
+                           return AForEachUIBase::Entry { .view = nullptr, .id = key };
+                       }
                        ALOG_TRACE("AForEachUIBase") << this << "(" << AReflect::name(this) << ") (?) Querying cache: " << key;
                        if (mViewsSharedCache) {
                            if (auto c = mViewsSharedCache->contains(key)) {
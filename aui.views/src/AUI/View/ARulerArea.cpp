@@ -76,7 +76,7 @@ void ARulerArea::setWrappedViewPosition(const glm::ivec2& pos) {
 void ARulerArea::render(ARenderContext ctx) {
     AViewContainerBase::render(ctx);
 
-
+    ctx.render.flush();
     glDisable(GL_STENCIL_TEST);
     // cursor display
     const auto rulerOffset = glm::ivec2(mVerticalRuler->getWidth(), mHorizontalRuler->getHeight());
@@ -114,6 +114,7 @@ void ARulerArea::render(ARenderContext ctx) {
         ctx.render.setBlending(Blending::NORMAL);
     }
 
+    ctx.render.flush();
     glEnable(GL_STENCIL_TEST);
 }
 
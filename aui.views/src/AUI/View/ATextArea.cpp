@@ -86,11 +86,14 @@ namespace {
 
     class NextLineEntry final : public aui::detail::NextLineEntry {
     public:
-        friend class ATextArea;
+        friend class ::ATextArea;
 
         using aui::detail::NextLineEntry::NextLineEntry;
 
         glm::ivec2 getPosByIndex(size_t characterIndex) override {
+            if (characterIndex == 0) {
+                return mLineEnd;
+            }
             return mPosition;
         }
 
@@ -100,7 +103,15 @@ namespace {
         }
 
     private:
+        /**
+         * @brief Beginning of the next line.
+         */
         glm::ivec2 mPosition{};
+
+        /**
+         * @brief End of the line broken by this entry.
+         */
+        glm::ivec2 mLineEnd{};
     };
 
     class WordEntry final : public aui::detail::WordEntry {
@@ -162,6 +173,7 @@ namespace {
 
 ATextArea::ATextArea() {
     mIsMultiline = true;
+    mParagraphs << Paragraph { .begin = entities().end() };
 }
 
 ATextArea::ATextArea(const AString& text) :
@@ -170,15 +182,14 @@ ATextArea::ATextArea(const AString& text) :
 }
 
 void ATextArea::setText(const AString& t) {
-    std::u32string u32str = t.toUtf32();
-    auto entries = u32str
-                   | stringToEntriesView(this)
-                   | ranges::to<Entries>();
-    mEngine.setEntries(std::move(entries));
+    entities().clear();
+    mParagraphs.clear();
+    mLength = 0;
+    replaceParagraphs(0, 0, t.toUtf32());
+    mCompiledText = t;
 
     AAbstractTypeable::setText(t);
     performLayout();
-    mCompiledText = t;
 }
 
 ATextArea::~ATextArea() {
@@ -210,126 +221,240 @@ std::u32string ATextArea::getDisplayText() {
     return compiledText;
 }
 
-void ATextArea::typeableErase(size_t begin, size_t end) {
-    auto resolvedBegin = getLeftEntity(begin);
-    if (resolvedBegin.iterator == entities().end()) {
-        return;
-    }
-    mCompiledText.reset();
-    AUI_DEFER { performLayout(); };
-    auto resolvedEnd = getLeftEntity(end - begin, resolvedBegin);
-    if (resolvedBegin.iterator == resolvedEnd.iterator) [[likely]] {
-        if (resolvedBegin.relativeIndex == 0 &&
-            resolvedEnd.relativeIndex == (*resolvedEnd.iterator)->getCharacterCount()) [[unlikely]] {
-            entities().erase(resolvedBegin.iterator);
-            return;
-        }
-        (*resolvedBegin.iterator)->erase(resolvedBegin.relativeIndex, resolvedEnd.relativeIndex);
-        return;
+void ATextArea::replaceParagraphs(size_t first, size_t last, std::u32string_view text) {
+    AUI_ASSERT(first <= last && last <= mParagraphs.size());
+    const auto next = last < mParagraphs.size() ? mParagraphs[last].begin : entities().end();
+    if (first < last) {
+        entities().erase(mParagraphs[first].begin, next);
+        for (auto i = first; i < last; ++i) {
+            mLength -= mParagraphs[i].length;
+        }
     }
 
-    if (resolvedBegin.relativeIndex != 0) [[likely]] {
-        (*resolvedBegin.iterator)->erase(resolvedBegin.relativeIndex, std::nullopt);
-        resolvedBegin = {.iterator = std::next(resolvedBegin.iterator), .relativeIndex = 0};
-    } else {
-        if (resolvedBegin.relativeIndex == (*resolvedBegin.iterator)->getCharacterCount()) {
-            resolvedBegin = {.iterator = std::next(resolvedBegin.iterator), .relativeIndex = 0};
+    AVector<Paragraph> replacement;
+    Paragraph current { .begin = next };
+    bool currentIsEmpty = true;
+    for (auto entry : text | stringToEntriesView(this)) {
+        const bool lineBreak = entry->forcesNextLine();
+        current.length += entry->getCharacterCount();
+        auto it = entities().insert(next, std::move(entry));
+        if (currentIsEmpty) {
+            current.begin = it;
+            currentIsEmpty = false;
+        }
+        if (lineBreak) {
+            replacement << std::move(current);
+            current = Paragraph { .begin = next };
+            currentIsEmpty = true;
         }
     }
+    if (!currentIsEmpty || last == mParagraphs.size()) {
+        // the text ends with a non-empty paragraph or it's the end of the whole text.
+        replacement << std::move(current);
+    }
+    for (const auto& paragraph : replacement) {
+        mLength += paragraph.length;
+    }
 
-    if (resolvedEnd.iterator != entities().end()) {
-        if (resolvedEnd.relativeIndex != (*resolvedEnd.iterator)->getCharacterCount()) {
-            (*resolvedEnd.iterator)->erase(0, resolvedEnd.relativeIndex);
-            resolvedEnd = {.iterator = resolvedEnd.iterator, .relativeIndex = 0};
-        } else {
-            resolvedEnd = {.iterator = std::next(resolvedEnd.iterator), .relativeIndex = 0};
-        }
+    mParagraphs.erase(mParagraphs.begin() + first, mParagraphs.begin() + last);
+    mParagraphs.insert(mParagraphs.begin() + first, std::make_move_iterator(replacement.begin()),
+                       std::make_move_iterator(replacement.end()));
+    mFirstInvalidOffset = glm::min(mFirstInvalidOffset, first);
+    mFirstInvalidY = glm::min(mFirstInvalidY, first);
+    mHasParagraphsToLayout = true;
+}
+
+std::u32string ATextArea::paragraphsText(size_t first, size_t last) {
+    AUI_ASSERT(first < last && last <= mParagraphs.size());
+    std::u32string result;
+    size_t length = 0;
+    for (auto i = first; i < last; ++i) {
+        length += mParagraphs[i].length;
+    }
+    result.reserve(length);
+    for (auto it = mParagraphs[first].begin, end = paragraphEnd(last - 1); it != end; ++it) {
+        (*it)->appendTo(result);
     }
+    return result;
+}
 
+ATextArea::Iterator ATextArea::paragraphEnd(size_t paragraph) {
+    if (paragraph + 1 < mParagraphs.size()) {
+        return mParagraphs[paragraph + 1].begin;
+    }
+    return entities().end();
+}
 
-    entities().erase(resolvedBegin.iterator, resolvedEnd.iterator);
+ATextArea::Iterator ATextArea::paragraphWrapEnd(size_t paragraph) {
+    if (paragraph + 1 < mParagraphs.size()) {
+        // skip the line break
+        return std::prev(mParagraphs[paragraph + 1].begin);
+    }
+    return entities().end();
 }
 
-bool ATextArea::typeableInsert(size_t at, const AString& toInsert) {
-    mCompiledText.reset();
-    auto [target, relativeIndex] = getLeftEntity(at);
-    if (target != entities().end()) {
-        if ((*target)->getCharacterCount() == relativeIndex) {
-            target++;
-            relativeIndex = 0;
-        }
-        target = splitIfNecessary({ target, relativeIndex });
+void ATextArea::updateOffsets() {
+    for (auto i = mFirstInvalidOffset; i < mParagraphs.size(); ++i) {
+        mParagraphs[i].offset = i == 0 ? 0 : mParagraphs[i - 1].offset + mParagraphs[i - 1].length;
+    }
+    mFirstInvalidOffset = mParagraphs.size();
+}
+
+void ATextArea::updateY() {
+    if (mFirstInvalidY >= mParagraphs.size()) {
+        return;
     }
-    std::u32string u32str = toInsert.toUtf32();
-    for (auto i: u32str | stringToEntriesView(this)) {
-        target = std::next(mEngine.entries().insert(target, std::move(i)));
+    for (auto i = mFirstInvalidY; i < mParagraphs.size(); ++i) {
+        mParagraphs[i].y = i == 0 ? 0 : mParagraphs[i - 1].y + mParagraphs[i - 1].height.valueOr(0);
     }
+    mFirstInvalidY = mParagraphs.size();
+    mHeight = mParagraphs.last().y + mParagraphs.last().height.valueOr(0);
+}
 
-    return true;
+size_t ATextArea::paragraphAt(size_t index) {
+    updateOffsets();
+    auto it = std::upper_bound(mParagraphs.begin(), mParagraphs.end(), index, [](size_t index, const Paragraph& p) {
+        return index < p.offset;
+    });
+    return it == mParagraphs.begin() ? 0 : std::distance(mParagraphs.begin(), it) - 1;
 }
 
-ATextArea::Iterator ATextArea::splitIfNecessary(EntityQueryResult at) {
-    auto& [target, relativeIndex] = at;
-    if (relativeIndex > 0) {
-        if (auto leftWord = _cast<WordEntry>(*target)) {
-            auto rightString = std::make_unique<WordEntry>(this, leftWord->getWord().substr(relativeIndex));
-            leftWord->getWord().resize(relativeIndex);
-            target = entities().insert(std::next(target), std::move(rightString));
+size_t ATextArea::paragraphLeftOf(size_t index) {
+    updateOffsets();
+    auto it = std::lower_bound(mParagraphs.begin(), mParagraphs.end(), index, [](const Paragraph& p, size_t index) {
+        return p.offset < index;
+    });
+    return it == mParagraphs.begin() ? 0 : std::distance(mParagraphs.begin(), it) - 1;
+}
+
+void ATextArea::validateLayoutParams() {
+    LayoutParams params { .fontStyle = getFontStyle(), .width = getWidth() - mPadding.horizontal() };
+    if (mLayoutParams && *mLayoutParams == params) {
+        return;
+    }
+    mLayoutParams = std::move(params);
+    for (auto& paragraph : mParagraphs) {
+        paragraph.height.reset();
+        paragraph.naturalWidth.reset();
+    }
+    mFirstInvalidY = 0;
+    mHasParagraphsToLayout = true;
+}
+
+void ATextArea::performLayout() {
+    APerformanceSection s("ATextArea::performLayout");
+    validateLayoutParams();
+    if (!mHasParagraphsToLayout) {
+        return;
+    }
+    mHasParagraphsToLayout = false;
+    mEngine.setTextAlign(mLayoutParams->fontStyle.align);
+    mEngine.setLineHeight(mLayoutParams->fontStyle.lineSpacing);
+    const auto emptyLineHeight = int(float(mLayoutParams->fontStyle.size) * mLayoutParams->fontStyle.lineSpacing);
+    for (size_t i = 0; i < mParagraphs.size(); ++i) {
+        auto& paragraph = mParagraphs[i];
+        if (paragraph.height) {
+            continue;
         }
-        if (auto leftWord = _cast<WhitespaceEntry>(*target)) {
-            auto rightString = std::make_unique<WhitespaceEntry>(this, leftWord->mCount - relativeIndex);
-            leftWord->mCount = relativeIndex;
-            target = entities().insert(std::next(target), std::move(rightString));
+        const auto wrapEnd = paragraphWrapEnd(i);
+        if (paragraph.begin == wrapEnd) {
+            // empty line; an empty text occupies no space though.
+            paragraph.height = mParagraphs.size() == 1 ? 0 : emptyLineHeight;
+        } else {
+            paragraph.height = mEngine.performLayout(paragraph.begin, wrapEnd, { 0, 0 }, { mLayoutParams->width, 0 });
+        }
+        if (wrapEnd != entities().end()) {
+            auto lineBreak = dynamic_cast<NextLineEntry*>(wrapEnd->get());
+            AUI_ASSERT(lineBreak != nullptr);
+            lineBreak->setPosition({ 0, *paragraph.height });
+            if (paragraph.begin != wrapEnd) {
+                const auto& lastEntry = *std::prev(wrapEnd);
+                lineBreak->mLineEnd = lastEntry->getPosByIndex(lastEntry->getCharacterCount());
+            } else {
+                lineBreak->mLineEnd = { 0, 0 };
+            }
         }
+        mFirstInvalidY = glm::min(mFirstInvalidY, i);
     }
-    return target;
+    updateY();
 }
 
-bool ATextArea::typeableInsert(size_t at, AChar toInsert) {
-    mCompiledText.reset();
-    AUI_DEFER { performLayout(); };
-    auto entity = getLeftEntity(at);
-
-    auto insertImpl = [&]<aui::factory<_unique<aui::detail::TextBaseEntry>> NewEntity, typename Append>(
-            NewEntity&& newEntity, Append&& append) {
-        tryAgain:
-        if (entity.iterator == entities().end()) {
-            entities().insert(entity.iterator, newEntity());
-            return;
-        }
-        using T = std::decay_t<decltype(*newEntity())>;
-        if constexpr (!std::is_null_pointer_v<Append>) {
-            if (auto c = _cast<T>(*entity.iterator)) {
-                append(*c);
-                return;
+int ATextArea::getContentMinimumWidth() {
+    if (expanding()->x != 0 || mFixedSize.x != 0) {
+        // there's no need to calculate min size because width is defined.
+        return 0;
+    }
+    validateLayoutParams();
+
+    // the widest paragraph, restricted by max size.
+    int max = 0;
+    const auto paddedMaxSize = mMaxSize.x - mPadding.horizontal();
+    for (size_t i = 0; i < mParagraphs.size(); ++i) {
+        auto& paragraph = mParagraphs[i];
+        const auto wrapEnd = paragraphWrapEnd(i);
+        if (!paragraph.naturalWidth) {
+            int naturalWidth = 0;
+            for (auto it = paragraph.begin; it != wrapEnd; ++it) {
+                naturalWidth += (*it)->getSize().x;
             }
+            paragraph.naturalWidth = naturalWidth;
+        }
+        if (*paragraph.naturalWidth <= paddedMaxSize) {
+            max = glm::max(max, *paragraph.naturalWidth);
+            continue;
         }
-        if ((*entity.iterator)->getCharacterCount() == entity.relativeIndex) {
-            entity.iterator++;
-            entity.relativeIndex = 0;
-            goto tryAgain;
+        int accumulator = 0;
+        for (auto it = paragraph.begin; it != wrapEnd; ++it) {
+            const auto width = (*it)->getSize().x;
+            if (accumulator + width > paddedMaxSize) {
+                if (accumulator == 0) {
+                    return mMaxSize.x;
+                }
+                // there's no need to calculate min size further.
+                return glm::max(max, accumulator);
+            }
+            accumulator += width;
         }
+    }
+    return max;
+}
 
-        entity.iterator = splitIfNecessary(entity);
-        entities().insert(entity.iterator, newEntity());
-    };
+int ATextArea::getContentMinimumHeight() {
+    performLayout();
+    return mHeight + getFontStyle().getDescenderHeight();
+}
 
-    if (toInsert == ' ') {
-        insertImpl([&] { return std::make_unique<WhitespaceEntry>(this, 1); },
-                   [](WhitespaceEntry& e) { e.mCount += 1; });
-        return true;
-    }
-    if (toInsert == '\n') {
-        insertImpl([&] { return std::make_unique<NextLineEntry>(this); },
-                   nullptr);
-        return true;
+void ATextArea::typeableErase(size_t begin, size_t end) {
+    end = glm::min(end, mLength);
+    if (begin >= end) {
+        return;
     }
+    mCompiledText.reset();
+    AUI_DEFER { performLayout(); };
 
-    insertImpl([&] { return std::make_unique<WordEntry>(this, AString(1, toInsert)); },
-               [&](WordEntry& e) { e.getWord().insert(e.getWord().begin() + entity.relativeIndex, toInsert); });
+    // the paragraph the erased range ends in is taken as well, so paragraphs are merged if a line break is erased.
+    const auto first = paragraphAt(begin);
+    const auto last = paragraphAt(end) + 1;
+    auto text = paragraphsText(first, last);
+    text.erase(begin - mParagraphs[first].offset, end - begin);
+    replaceParagraphs(first, last, text);
+}
+
+bool ATextArea::typeableInsert(size_t at, const AString& toInsert) {
+    mCompiledText.reset();
+    AUI_DEFER { performLayout(); };
+    at = glm::min(at, mLength);
+    const auto paragraph = paragraphAt(at);
+    auto text = paragraphsText(paragraph, paragraph + 1);
+    text.insert(at - mParagraphs[paragraph].offset, toInsert.toUtf32());
+    replaceParagraphs(paragraph, paragraph + 1, text);
     return true;
 }
 
+bool ATextArea::typeableInsert(size_t at, AChar toInsert) {
+    return typeableInsert(at, AString(1, toInsert));
+}
+
 size_t ATextArea::typeableFind(AChar c, size_t startPos) {
     for (auto [it, relativeIndex] = getLeftEntity(startPos);
          it != entities().end(); startPos += (*it)->getCharacterCount() - relativeIndex, ++it, relativeIndex = 0) {
@@ -388,21 +513,32 @@ void ATextArea::onCharEntered(AChar c) {
 }
 
 size_t ATextArea::length() const {
-    if (mCompiledText) {
-        return mCompiledText->length();
-    }
-    return ranges::accumulate(entities(), size_t(0), std::plus<>{}, [](const _unique<aui::detail::TextBaseEntry>& e) {
-        return e->getCharacterCount();
-    });
+    return mLength;
 }
 
 unsigned int ATextArea::cursorIndexByPos(glm::ivec2 pos) {
-    unsigned accumulator = 0;
-    for (const auto& e: mEngine.entries()) {
-        auto result = e->hitTest(pos);
+    performLayout();
+    updateOffsets();
+    pos -= glm::ivec2(mPadding.left, mPadding.top);
+
+    // the last paragraph starting above the position; a line is hit within half of the line height around its top
+    // (see WordEntry::hitTest).
+    const auto halfLineHeight = int(getFontStyle().getLineHeight()) / 2;
+    auto paragraphIt = std::upper_bound(mParagraphs.begin(), mParagraphs.end(), pos.y + halfLineHeight,
+                                        [](int y, const Paragraph& p) { return y < p.y; });
+    if (paragraphIt != mParagraphs.begin()) {
+        --paragraphIt;
+    }
+    const auto& paragraph = *paragraphIt;
+    pos.y -= paragraph.y;
+
+    unsigned accumulator = paragraph.offset;
+    for (auto it = paragraph.begin, end = paragraphWrapEnd(std::distance(mParagraphs.begin(), paragraphIt));
+         it != end; ++it) {
+        auto result = (*it)->hitTest(pos);
         if (std::holds_alternative<aui::detail::TextBaseEntry::StopLineScanningHint>(
                 result)) { // we came way below this line.
-            if (accumulator > 0) {
+            if (accumulator > paragraph.offset) {
                 return accumulator - 1;
             }
             return accumulator;
@@ -410,21 +546,22 @@ unsigned int ATextArea::cursorIndexByPos(glm::ivec2 pos) {
         if (auto offset = std::get_if<size_t>(&result)) {
             return accumulator + *offset;
         }
-        accumulator += e->getCharacterCount();
+        accumulator += (*it)->getCharacterCount();
     }
     return accumulator;
 }
 
 glm::ivec2 ATextArea::getPosByIndex(size_t index) {
     performLayout();
-    auto [it, relativeIndex] = getLeftEntity(index);
+    index = glm::min(index, mLength);
+    const auto paragraph = paragraphLeftOf(index);
+    auto [it, relativeIndex] = getLeftEntity(index - mParagraphs[paragraph].offset,
+                                             { .iterator = mParagraphs[paragraph].begin, .relativeIndex = 0 });
     if (it == entities().end()) {
-        if (it == entities().begin()) {
-            return {0, 0};
-        }
-        it = std::prev(it);
+        return {0, 0};
     }
-    return (*it)->getPosByIndex(glm::min(relativeIndex, (*it)->getCharacterCount())) - mPadding.leftTop();
+    return (*it)->getPosByIndex(glm::min(relativeIndex, (*it)->getCharacterCount())) +
+           glm::ivec2(0, mParagraphs[paragraph].y);
 }
 
 glm::ivec2 ATextArea::getCursorPosition() {
@@ -457,6 +594,26 @@ void ATextArea::setSize(glm::ivec2 size) {
 
 void ATextArea::render(ARenderContext context) {
     AViewContainerBase::render(context);
+
+    // glyphs are prepared for the visible part of the text only, with a margin of the visible height, so scrolling
+    // does not require to prepare them each frame.
+    AOptional<glm::ivec2> visibleRange;
+    for (const auto& rect : context.clippingRects) {
+        visibleRange = visibleRange ? glm::ivec2(glm::min(visibleRange->x, rect.p1.y), glm::max(visibleRange->y, rect.p2.y))
+                                    : glm::ivec2(rect.p1.y, rect.p2.y);
+    }
+    if (mPrerenderedString && mPreparedRange &&
+        (!visibleRange || visibleRange->x < mPreparedRange->x || visibleRange->y > mPreparedRange->y)) {
+        mPrerenderedString = nullptr;
+    }
+    if (!mPrerenderedString) {
+        mPreparedRange.reset();
+        if (visibleRange) {
+            const auto margin = visibleRange->y - visibleRange->x;
+            mPreparedRange = glm::ivec2(visibleRange->x - margin, visibleRange->y + margin);
+        }
+    }
+
     AStaticVector<ARect<int>, 3> selectionRects;
     if (hasSelection() && hasFocus()) {
         auto s = selection();
@@ -510,7 +667,9 @@ bool ATextArea::capturesFocus() {
 }
 
 ATextArea::EntityQueryResult ATextArea::getLeftEntity(size_t index) {
-    return getLeftEntity(index, {.iterator = entities().begin(), .relativeIndex = 0});
+    const auto paragraph = paragraphLeftOf(index);
+    return getLeftEntity(index - mParagraphs[paragraph].offset,
+                         {.iterator = mParagraphs[paragraph].begin, .relativeIndex = 0});
 }
 
 ATextArea::EntityQueryResult ATextArea::getLeftEntity(size_t index, EntityQueryResult from) {
@@ -547,15 +706,24 @@ void ATextArea::fillStringCanvas(const _<IRenderer::IMultiStringCanvas>& canvas)
         ascender.y += (getContentHeight() - this->getContentMinimumHeight()) / 2;
     }
 
-    auto wordEntries = entities()
-                       | ranges::views::transform([](const _unique<aui::detail::TextBaseEntry>& e) {
-        return _cast<aui::detail::WordEntry>(e);
-    })
-                       | ranges::views::filter([](auto ptr) { return ptr != nullptr; })
-                       | ranges::views::transform([](auto ptr) -> aui::detail::WordEntry& { return *ptr; });
-
-    for (auto& wordEntry: wordEntries) {
-        canvas->addString(wordEntry.getPosition() + ascender, wordEntry.getWord());
+    performLayout();
+    // the first paragraph ending below the top of the prepared range
+    auto first = mParagraphs.begin();
+    if (mPreparedRange) {
+        first = std::upper_bound(mParagraphs.begin(), mParagraphs.end(), mPreparedRange->x - mPadding.top,
+                                 [](int y, const Paragraph& p) { return y < p.y + p.height.valueOr(0); });
+    }
+    for (auto paragraph = first; paragraph != mParagraphs.end(); ++paragraph) {
+        if (mPreparedRange && paragraph->y + mPadding.top > mPreparedRange->y) {
+            break;
+        }
+        const auto origin = glm::ivec2(mPadding.left, mPadding.top + paragraph->y);
+        for (auto it = paragraph->begin, end = paragraphWrapEnd(std::distance(mParagraphs.begin(), paragraph));
+             it != end; ++it) {
+            if (auto wordEntry = _cast<aui::detail::WordEntry>(*it)) {
+                canvas->addString(wordEntry->getPosition() + origin + ascender, wordEntry->getWord());
+            }
+        }
     }
 }
 
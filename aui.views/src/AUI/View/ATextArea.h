@@ -47,6 +47,10 @@ class API_AUI_VIEWS AScrollArea;
  * input.
  *
  * ATextArea offers integrations and optimizations for AScrollArea specifically.
+ *
+ * The text is split into paragraphs by line breaks. Paragraphs are wrapped independently, so editing a paragraph
+ * re-wraps that paragraph only; the rest of the layout is reused. Glyphs are prepared for the visible part of the text
+ * only, which makes large documents practical.
  */
 class API_AUI_VIEWS ATextArea: public AAbstractTypeableView<ATextBase<AWordWrappingEngine<std::list<_unique<aui::detail::TextBaseEntry>>>>>, public IStringable {
 public:
@@ -75,6 +79,9 @@ public:
 
     ATextInputType textInputType() const noexcept override;
 
+    int getContentMinimumWidth() override;
+    int getContentMinimumHeight() override;
+
 protected:
     void typeableErase(size_t begin, size_t end) override;
     bool typeableInsert(size_t at, const AString& toInsert) override;
@@ -83,12 +90,72 @@ protected:
     size_t typeableReverseFind(AChar c, size_t startPos) override;
     size_t length() const override;
     void fillStringCanvas(const _<IRenderer::IMultiStringCanvas>& canvas) override;
+    void performLayout() override;
 
 private:
+    /**
+     * @brief Part of the text between line breaks.
+     * @details
+     * Entries of a paragraph are laid out relatively to the paragraph, so the layout of a paragraph stays valid until
+     * the paragraph itself is edited or the layout parameters are changed.
+     */
+    struct Paragraph {
+        /**
+         * @brief First entry of the paragraph. Each paragraph except the last one ends with a line break entry.
+         */
+        Iterator begin;
+
+        /**
+         * @brief Character count, including the trailing line break.
+         */
+        size_t length = 0;
+
+        /**
+         * @brief Height of the wrapped paragraph; empty if the paragraph needs to be laid out.
+         */
+        AOptional<int> height;
+
+        /**
+         * @brief Width of the paragraph if it were not wrapped.
+         */
+        AOptional<int> naturalWidth;
+
+        /**
+         * @brief Character offset of the paragraph; valid for paragraphs before mFirstInvalidOffset.
+         */
+        size_t offset = 0;
+
+        /**
+         * @brief Vertical offset of the paragraph; valid for paragraphs before mFirstInvalidY.
+         */
+        int y = 0;
+    };
+
+    struct LayoutParams {
+        AFontStyle fontStyle;
+        int width;
+
+        bool operator==(const LayoutParams&) const noexcept = default;
+    };
+
     mutable AOptional<AString> mCompiledText;
     glm::ivec2 mCursorPosition{0, 0};
     AAbstractSignal::AutoDestroyedConnection mUpdatedMaxScrollSignal;
 
+    AVector<Paragraph> mParagraphs;
+    size_t mLength = 0;
+    size_t mFirstInvalidOffset = 0;
+    size_t mFirstInvalidY = 0;
+    bool mHasParagraphsToLayout = false;
+    AOptional<LayoutParams> mLayoutParams;
+    int mHeight = 0;
+
+    /**
+     * @brief Vertical range (in view coordinates) glyphs of mPrerenderedString were prepared for; empty if the whole
+     * text was prepared.
+     */
+    AOptional<glm::ivec2> mPreparedRange;
+
     struct EntityQueryResult {
         Iterator iterator;
         size_t relativeIndex;
@@ -108,7 +175,42 @@ private:
 
     EntityQueryResult getLeftEntity(size_t indexRelativeToFrom, EntityQueryResult from);
     EntityQueryResult getLeftEntity(size_t index);
-    Iterator splitIfNecessary(EntityQueryResult at);
+
+    /**
+     * @brief Replaces [first, last) paragraphs with the paragraphs parsed from text.
+     * @details
+     * Unless the paragraphs are replaced till the end of the text, text is expected to end with a line break.
+     */
+    void replaceParagraphs(size_t first, size_t last, std::u32string_view text);
+
+    /**
+     * @brief Text of [first, last) paragraphs.
+     */
+    std::u32string paragraphsText(size_t first, size_t last);
+
+    /**
+     * @brief Iterator past the last entry of the paragraph, including the line break.
+     */
+    Iterator paragraphEnd(size_t paragraph);
+
+    /**
+     * @brief Iterator past the last wrapped entry of the paragraph, excluding the line break.
+     */
+    Iterator paragraphWrapEnd(size_t paragraph);
+
+    /**
+     * @brief Paragraph containing the character at the index; the last paragraph for the end of the text.
+     */
+    size_t paragraphAt(size_t index);
+
+    /**
+     * @brief Paragraph the index belongs to, preferring the left one on the boundary between paragraphs.
+     */
+    size_t paragraphLeftOf(size_t index);
+
+    void updateOffsets();
+    void updateY();
+    void validateLayoutParams();
 
     AScrollArea* findScrollArea();
 };
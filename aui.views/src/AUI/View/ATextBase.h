@@ -318,7 +318,7 @@ protected:
     _<IRenderer::IPrerenderedString> mPrerenderedString;
 
 
-    void performLayout() {
+    virtual void performLayout() {
         APerformanceSection s("ATextBase::performLayout");
         mEngine.setTextAlign(getFontStyle().align);
         mEngine.setLineHeight(getFontStyle().lineSpacing);
@@ -74,13 +74,30 @@ void AView::redraw()
     if (mRedrawRequested) {
         return;
     }
+    markPixelDataInvalid(pixelDataArea());
+    mRedrawRequested = true;
+}
+
+ARect<int> AView::pixelDataArea() const {
     static constexpr auto EXTRA_OFFSET = 8;
     auto invalidRect = ARect<int>::fromTopLeftPositionAndSize(glm::ivec2(-EXTRA_OFFSET), getSize() + glm::ivec2(EXTRA_OFFSET * 2));
     for (auto s : mAss) {
         AUI_NULLSAFE(s)->updateInvalidPixelRect(invalidRect);
     }
-    markPixelDataInvalid(invalidRect);
-    mRedrawRequested = true;
+    return invalidRect;
+}
+
+void AView::markWindowPixelDataInvalid() {
+    auto area = pixelDataArea();
+    AView* root = this;
+    for (; root->mParent; root = root->mParent) {
+        area.translate(root->mPosition);
+    }
+    if (root != this) {
+        if (auto surface = dynamic_cast<ASurface*>(root)) {
+            static_cast<AView*>(surface)->markPixelDataInvalid(area);
+        }
+    }
 }
 void AView::markMinContentSizeInvalid()
 {
@@ -199,28 +216,75 @@ static void walkToParentStack(AView* view, aui::invocable<AView*> auto&& callbac
     callback(view);
 }
 
+/**
+ * @brief Key of the possibly applicable rules cache.
+ * @details
+ * isPossiblyApplicable depends on the types and ASS classes of the view and its parents only, so views that are equal
+ * in that regard and are covered by the same stylesheet revisions share the rule list.
+ */
+static std::string styleSignature(AView* view) {
+    std::string result;
+    auto append = [&](const auto& value) {
+        result.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    append(AStylesheet::global().revision());
+    for (; view != nullptr; view = view->getParent()) {
+        append(&typeid(*view));
+        append(view->extraStylesheet() ? view->extraStylesheet()->revision() : std::uint64_t(0));
+        append(view->getAssNames().size());
+        for (const auto& name : view->getAssNames()) {
+            const auto& utf8 = name.toStdString();
+            result.append(utf8.c_str(), utf8.size() + 1);
+        }
+    }
+    return result;
+}
+
 void AView::invalidateAllStyles()
 {
     auto prevMinSize = mCachedMinContentSize ? getMinimumSizePlusMargin() : glm::ivec2(DEFINITELY_INVALID_SIZE);
     AUI_ASSERTX(mAssHelper != nullptr, "invalidateAllStyles requires mAssHelper to be initialized");
 
-    auto collectRules = [this](const AStylesheet& sh) {
-        for (const auto& r : sh.getRules()) {
-            if (r.getSelector().isPossiblyApplicable(this)) {
-                mAssHelper->mPossiblyApplicableRules << r;
-                r.getSelector().setupConnections(this, mAssHelper);
+    static constexpr std::size_t MAX_SHARED_RULE_LISTS = 1024;
+    static std::unordered_map<std::string, _<const AVector<ass::Rule>>> sharedRules;
+
+    auto& rules = sharedRules[styleSignature(this)];
+    if (!rules) {
+        AVector<ass::Rule> collected;
+        auto collectRules = [&](const AStylesheet& sh) {
+            for (auto i : sh.candidateRules(this)) {
+                const auto& r = sh.getRules()[i];
+                if (r.getSelector().isPossiblyApplicable(this)) {
+                    collected << r;
+                }
             }
-        }
-    };
+        };
 
-    collectRules(AStylesheet::global());
+        collectRules(AStylesheet::global());
 
-    walkToParentStack(this, [&](AView* v) {
-        if (!v->mExtraStylesheet) {
-            return;
+        walkToParentStack(this, [&](AView* v) {
+            if (!v->mExtraStylesheet) {
+                return;
+            }
+            collectRules(*v->mExtraStylesheet);
+        });
+
+        auto list = _new<const AVector<ass::Rule>>(std::move(collected));
+        if (sharedRules.size() > MAX_SHARED_RULE_LISTS) {
+            // signatures of outdated stylesheet revisions and destroyed view hierarchies pile up here.
+            sharedRules.clear();
+            sharedRules[styleSignature(this)] = list;
+        } else {
+            rules = list;
         }
-        collectRules(*v->mExtraStylesheet);
-    });
+        mAssHelper->mPossiblyApplicableRules = std::move(list);
+    } else {
+        mAssHelper->mPossiblyApplicableRules = rules;
+    }
+
+    for (const auto& r : *mAssHelper->mPossiblyApplicableRules) {
+        r.getSelector().setupConnections(this, mAssHelper);
+    }
 
     invalidateStateStylesImpl(prevMinSize);
 }
@@ -247,13 +311,14 @@ void AView::invalidateStateStylesImpl(glm::ivec2 prevMinimumSizePlusField) {
     mAssHelper->state.backgroundUrl.sizing.reset();
     mAssHelper->state.backgroundUrl.image.reset();
 
-    for (const auto& r : mAssHelper->mPossiblyApplicableRules) {
+    for (const auto& r : mAssHelper->getPossiblyApplicableRules()) {
         if (r.getSelector().isStateApplicable(this)) {
             applyAssRule(r);
         }
     }
     applyAssRule(mCustomStyleRule);
     commitStyle();
+    AUI_NULLSAFE(mParent)->onChildGeometryChanged(*this); // margins might have changed
 
     if (prevMinimumSizePlusField != getMinimumSizePlusMargin()) {
         mMarkedMinContentSizeInvalid = true;
@@ -502,7 +567,12 @@ void AView::setPosition(glm::ivec2 position) {
     if (mPosition == position) [[unlikely]] {
         return;
     }
+    // the area the view leaves is repainted as well as the area it moves to; the latter is not covered by redraw() if
+    // a redraw is already requested.
+    markWindowPixelDataInvalid();
     mPosition = position;
+    markWindowPixelDataInvalid();
+    AUI_NULLSAFE(mParent)->onChildGeometryChanged(*this);
     redraw();
     emit mPositionChanged(position);
 }
@@ -536,7 +606,11 @@ void AView::setSize(glm::ivec2 size)
     if (mSize == newSize) [[unlikely]] {
         return;
     }
+    // same as setPosition.
+    markWindowPixelDataInvalid();
     mSize = newSize;
+    markWindowPixelDataInvalid();
+    AUI_NULLSAFE(mParent)->onChildGeometryChanged(*this);
     redraw();
     emit mSizeChanged(newSize);
 }
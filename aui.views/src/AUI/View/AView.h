@@ -1057,7 +1057,8 @@ protected:
     /**
      * @brief Redraw requested flag for this particular view/
      * @details
-     * This flag is set in redraw() method and reset in AView::render(ARenderContext context). redraw() method does not actually requests
+     * This flag is set in redraw() method and reset in AView::render(ARenderContext context), or by
+     * AViewContainerBase::drawView when the view is skipped in the frame. redraw() method does not actually requests
      * redraw of window if mRedrawRequested. This approach ignores sequential redraw() calls if the view is not even
      * drawn.
      */
@@ -1155,6 +1156,21 @@ protected:
     virtual void commitStyle();
 
 private:
+    /**
+     * @brief Area affected by drawing of this view in this view's coordinate space, including shadows and other
+     * effects of ASS that draw outside the view.
+     */
+    [[nodiscard]]
+    ARect<int> pixelDataArea() const;
+
+    /**
+     * @brief Invalidates pixelDataArea in the window's damage directly, bypassing the parents.
+     * @details
+     * Used when the view moves or resizes: unlike redraw(), the area is invalidated even if a redraw is already
+     * requested, and the parents (i.e. render-to-texture ones) are not asked to repaint.
+     */
+    void markWindowPixelDataInvalid();
+
     /**
      * @brief Animation.
      */
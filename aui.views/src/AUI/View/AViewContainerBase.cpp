@@ -41,11 +41,22 @@ bool isDefinitelyInvisible(AView& view) {
 }
 
 void AViewContainerBase::drawView(const _<AView>& view, ARenderContext contextOfTheContainer) {
+    auto skip = [&] {
+        // the damage requested by the view is consumed by this frame even though the view is not drawn; otherwise,
+        // further redraw() calls would be ignored and the view would stay blank when it is drawn again. Views
+        // rendered to texture reset the flag themselves, see AView::markPixelDataInvalid.
+        if (!view->mRenderToTexture) {
+            view->mRedrawRequested = false;
+        }
+    };
+
     if (aui::view::impl::isDefinitelyInvisible(*view)) [[unlikely]] {
+        skip();
         return;
     }
 
     if (view->mSkipUntilLayoutUpdate) [[unlikely]] {
+        skip();
         return;
     }
 
@@ -54,6 +65,7 @@ void AViewContainerBase::drawView(const _<AView>& view, ARenderContext contextOf
     if (!ranges::any_of(contextOfTheView.clippingRects, [&](const auto& r) {
       return rectOfTheView.isIntersects(r);
     })) {
+        skip();
         return;
     }
 
@@ -444,7 +456,8 @@ bool AViewContainerBase::consumesClick(const glm::ivec2& pos) {
 _<AView> AViewContainerBase::getViewAt(glm::ivec2 pos, ABitField<AViewLookupFlags> flags) const noexcept {
     _<AView> possibleOutput = nullptr;
 
-    for (auto view: aui::reverse_iterator_wrap(mViews)) {
+    // returns true if the view is found.
+    auto visit = [&](const _<AView>& view) {
         auto targetPos = pos - view->getPosition();
 
         bool hitTest;
@@ -470,10 +483,26 @@ _<AView> AViewContainerBase::getViewAt(glm::ivec2 pos, ABitField<AViewLookupFlag
                     possibleOutput = view;
                 }
                 if (view->consumesClick(targetPos)) {
-                    return view;
+                    return true;
                 }
             }
         }
+        return false;
+    };
+
+    if (auto candidates = childrenIn({ .p1 = pos, .p2 = pos })) {
+        for (auto i : aui::reverse_iterator_wrap(*candidates)) {
+            if (visit(mViews[i])) {
+                return mViews[i];
+            }
+        }
+        return possibleOutput;
+    }
+
+    for (const auto& view: aui::reverse_iterator_wrap(mViews)) {
+        if (visit(view)) {
+            return view;
+        }
     }
     return possibleOutput;
 }
@@ -661,8 +690,80 @@ void AViewContainerBase::onClickPrevented() {
     }
 }
 
+void AViewContainerBase::setSpatialIndexEnabled(bool enabled) {
+    if (enabled == isSpatialIndexEnabled()) {
+        return;
+    }
+    mSpatialIndex = enabled ? std::make_unique<SpatialIndex>() : nullptr;
+}
+
+ARect<int> AViewContainerBase::spatialIndexRectOf(const AView& view) {
+    // covers MouseCollisionPolicy::MARGIN hit test of getViewAt. Not using getMargin() because it updates the style;
+    // the index is notified when the style changes the margin.
+    const auto& margin = view.mMargin;
+    return {
+        .p1 = view.getPosition() - glm::ivec2(margin.left, margin.top),
+        .p2 = view.getPosition() + view.getSize() + glm::ivec2(margin.horizontal(), margin.vertical()),
+    };
+}
+
+AOptional<AVector<std::size_t>> AViewContainerBase::childrenIn(ARect<int> area) const {
+    if (!mSpatialIndex) {
+        return std::nullopt;
+    }
+    if (mSpatialIndex->dirty) {
+        mSpatialIndex->dirty = false;
+        mSpatialIndex->items.clear();
+        AVector<ARect<int>> rects;
+        rects.reserve(mViews.size());
+        for (std::size_t i = 0; i < mViews.size(); ++i) {
+            mSpatialIndex->items[mViews[i].get()] = i;
+            rects << spatialIndexRectOf(*mViews[i]);
+        }
+        mSpatialIndex->grid.rebuild(rects);
+    }
+    return mSpatialIndex->grid.query(area);
+}
+
+void AViewContainerBase::updateSpatialIndex(const AView& view) {
+    if (mSpatialIndex->dirty) {
+        return;
+    }
+    auto it = mSpatialIndex->items.find(&view);
+    if (it == mSpatialIndex->items.end()) {
+        // the view is being added; the index is marked dirty afterwards.
+        return;
+    }
+    mSpatialIndex->grid.update(it->second, spatialIndexRectOf(view));
+}
+
+void AViewContainerBase::drawViewsIndexed(ARenderContext contextPassedToContainer) {
+    clipByOverflow(contextPassedToContainer);
+
+    AVector<std::size_t> visible;
+    for (const auto& rect : contextPassedToContainer.clippingRects) {
+        auto candidates = *childrenIn(rect);
+        visible.insert(visible.end(), candidates.begin(), candidates.end());
+    }
+    if (contextPassedToContainer.clippingRects.size() > 1) {
+        std::sort(visible.begin(), visible.end());
+        visible.erase(std::unique(visible.begin(), visible.end()), visible.end());
+    }
+
+    std::unique_lock lock(mViewsSafeIteration, std::try_to_lock);
+    if (!lock) {
+        throw AException("drawViews: can't ensure safe iteration");
+    }
+    for (auto i : visible) {
+        drawView(mViews[i], contextPassedToContainer);
+    }
+}
+
 void AViewContainerBase::invalidateCaches() {
     mConsumesClickCache.reset();
+    if (mSpatialIndex) {
+        mSpatialIndex->dirty = true;
+    }
     markMinContentSizeInvalid();
     redraw();
 }
@@ -22,6 +22,7 @@
 #include "AUI/Render/IRenderer.h"
 #include "AUI/Render/RenderHints.h"
 #include "AUI/Render/ARenderContext.h"
+#include "AUI/Util/AViewSpatialIndex.h"
 #include "glm/fwd.hpp"
 
 
@@ -132,6 +133,21 @@ public:
     }
 
 
+    /**
+     * @brief Enables spatial index of the children.
+     * @details
+     * By default, rendering and pointer lookup (getViewAt, getViewAtRecursive) visit each child of the container. With
+     * the spatial index enabled, they visit only the children found in a uniform grid (see AViewSpatialIndex), which
+     * is updated incrementally as the children move. Makes sense for containers with thousands of children, i.e.,
+     * absolutely positioned items of a canvas-like editor.
+     */
+    void setSpatialIndexEnabled(bool enabled);
+
+    [[nodiscard]]
+    bool isSpatialIndexEnabled() const noexcept {
+        return mSpatialIndex != nullptr;
+    }
+
     /**
      * @brief Get layout manager of the container.
      */
@@ -184,14 +200,15 @@ public:
             return false;
         };
 
-        for (const auto& view : aui::reverse_iterator_wrap(mViews)) {
+        // returns a value if the lookup is finished.
+        auto visit = [&](const _<AView>& view) -> AOptional<bool> {
             auto targetPos = pos - view->getPosition();
 
             if (targetPos.x < 0 || targetPos.y < 0 || targetPos.x >= view->getSize().x || targetPos.y >= view->getSize().y) {
-                continue;
+                return std::nullopt;
             }
             if (!flags.test(AViewLookupFlags::IGNORE_VISIBILITY) && !(view->getVisibility() & Visibility::FLAG_CONSUME_CLICKS)) {
-                continue;
+                return std::nullopt;
             }
 
             if (view->consumesClick(targetPos)) {
@@ -209,6 +226,21 @@ public:
                     possibleOutput = view;
                 }
             }
+            return std::nullopt;
+        };
+
+        if (auto candidates = childrenIn({ .p1 = pos, .p2 = pos })) {
+            for (auto i : aui::reverse_iterator_wrap(*candidates)) {
+                if (auto result = visit(mViews[i])) {
+                    return *result;
+                }
+            }
+        } else {
+            for (const auto& view : aui::reverse_iterator_wrap(mViews)) {
+                if (auto result = visit(view)) {
+                    return *result;
+                }
+            }
         }
         if (possibleOutput) {
             return process(possibleOutput);
@@ -321,8 +353,7 @@ protected:
 
     void drawView(const _<AView>& view, ARenderContext contextOfTheContainer);
 
-    template<typename Iterator>
-    void drawViews(Iterator begin, Iterator end, ARenderContext contextPassedToContainer) {
+    void clipByOverflow(ARenderContext& contextPassedToContainer) const {
         switch (mOverflow) {
             case AOverflow::VISIBLE: break;
             case AOverflow::HIDDEN:
@@ -332,6 +363,11 @@ protected:
                     .p2 = getSize(),
                 });
         }
+    }
+
+    template<typename Iterator>
+    void drawViews(Iterator begin, Iterator end, ARenderContext contextPassedToContainer) {
+        clipByOverflow(contextPassedToContainer);
 
         std::unique_lock lock(mViewsSafeIteration, std::try_to_lock);
         if (!lock) {
@@ -407,6 +443,10 @@ protected:
     void setLayout(_unique<ALayout> layout);
 
     void renderChildren(ARenderContext contextPassedToContainer) {
+        if (mSpatialIndex) [[unlikely]] {
+            drawViewsIndexed(contextPassedToContainer);
+            return;
+        }
         drawViews(mViews.begin(), mViews.end(), contextPassedToContainer);
     }
 
@@ -473,4 +513,44 @@ private:
     void removeViewImpl(const _<AView>& view, std::unique_lock<ASpinlockMutex>& lock);
     void setLayoutImpl(_unique<ALayout> layout, std::unique_lock<ASpinlockMutex>& lock);
     void removeAllViewsImpl(std::unique_lock<ASpinlockMutex>& lock);
+
+    struct SpatialIndex {
+        AViewSpatialIndex grid;
+
+        /**
+         * @brief Maps children to their indices in mViews and in the grid.
+         */
+        std::unordered_map<const AView*, std::size_t> items;
+
+        /**
+         * @brief Set of children has changed; the index is rebuilt on the next lookup.
+         */
+        bool dirty = true;
+    };
+
+    /**
+     * @see setSpatialIndexEnabled
+     * @details
+     * Rebuilt lazily, including by const lookups.
+     */
+    mutable _unique<SpatialIndex> mSpatialIndex;
+
+    /**
+     * @brief Indices of the children in mViews that might intersect the area, in ascending order.
+     * @return nullopt if the spatial index is disabled.
+     */
+    AOptional<AVector<std::size_t>> childrenIn(ARect<int> area) const;
+
+    /**
+     * @brief Called by AView when position, size or margin of a child is changed.
+     */
+    void onChildGeometryChanged(const AView& view) {
+        if (mSpatialIndex) [[unlikely]] {
+            updateSpatialIndex(view);
+        }
+    }
+
+    void updateSpatialIndex(const AView& view);
+    static ARect<int> spatialIndexRectOf(const AView& view);
+    void drawViewsIndexed(ARenderContext contextPassedToContainer);
 };
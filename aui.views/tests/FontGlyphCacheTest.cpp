@@ -0,0 +1,59 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+#include "AUI/Platform/AFontManager.h"
+#include "AUI/Util/kAUI.h"
+
+namespace {
+// unusual sizes so other tests do not affect the caches being tested
+constexpr unsigned SPARSE_SIZE = 37;
+constexpr unsigned EVICTION_SIZE = 41;
+}
+
+TEST(FontGlyphCache, Sparse) {
+    auto font = AFontManager::inst().getDefaultFont();
+    auto entry = font->getFontEntry({ SPARSE_SIZE, FontRendering::ANTIALIASING });
+    font->getCharacter(entry, U'A');
+    font->getCharacter(entry, U'\U0001F600');
+    EXPECT_EQ(entry.second.characters.size(), 2);
+}
+
+TEST(FontGlyphCache, Eviction) {
+    auto font = AFontManager::inst().getDefaultFont();
+    const auto prevBudget = font->glyphCacheBudget();
+    AUI_DEFER { font->setGlyphCacheBudget(prevBudget); };
+
+    auto entry = font->getFontEntry({ EVICTION_SIZE, FontRendering::ANTIALIASING });
+    auto& a = font->getCharacter(entry, U'A');
+    ASSERT_FALSE(a.empty());
+    ASSERT_NE(a.image, nullptr);
+    const auto advance = a.horizontal.advance;
+
+    // keep a single bitmap
+    font->setGlyphCacheBudget(a.image->buffer().size());
+    const auto evictions = font->memoryUsage().evictions;
+    for (char32_t c = U'B'; c <= U'Z'; ++c) {
+        font->getCharacter(entry, c);
+    }
+    EXPECT_LE(font->memoryUsage().bitmapBytes, font->glyphCacheBudget() * 2);
+    EXPECT_GT(font->memoryUsage().evictions, evictions);
+
+    // metrics survive the eviction
+    EXPECT_EQ(a.image, nullptr);
+    EXPECT_FALSE(a.empty());
+    EXPECT_EQ(a.horizontal.advance, advance);
+
+    // the bitmap is restored on demand
+    auto& restored = font->getCharacter(entry, U'A');
+    EXPECT_EQ(&restored, &a);
+    EXPECT_NE(a.image, nullptr);
+}
@@ -0,0 +1,43 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+#include "AUI/Render/SimpleTexturePacker.h"
+
+TEST(SimpleTexturePacker, DirtyRect) {
+    Util::SimpleTexturePacker packer;
+    AImage glyph({ 10, 12 }, APixelFormat::RGBA_BYTE);
+
+    packer.insert(glyph);
+    EXPECT_TRUE(packer.isResized());
+    packer.resetDirty();
+    EXPECT_FALSE(packer.isResized());
+    EXPECT_FALSE(packer.dirtyRect());
+
+    auto uv1 = packer.insert(glyph);
+    auto uv2 = packer.insert(glyph);
+    EXPECT_FALSE(packer.isResized());
+    ASSERT_TRUE(packer.dirtyRect());
+    EXPECT_EQ(packer.dirtyRect()->p1, glm::ivec2(glm::min(uv1.x, uv2.x), glm::min(uv1.y, uv2.y)));
+    EXPECT_EQ(packer.dirtyRect()->p2, glm::ivec2(glm::max(uv1.z, uv2.z), glm::max(uv1.w, uv2.w)));
+}
+
+TEST(SimpleTexturePacker, TryInsert) {
+    Util::SimpleTexturePacker packer;
+    AImage glyph({ 40, 40 }, APixelFormat::RGBA_BYTE);
+
+    EXPECT_TRUE(packer.tryInsert(glyph, 64));
+    // the second glyph requires 128x128
+    EXPECT_FALSE(packer.tryInsert(glyph, 64));
+    EXPECT_EQ(packer.getImage()->width(), 64);
+    EXPECT_TRUE(packer.tryInsert(glyph, 128));
+    EXPECT_EQ(packer.getImage()->width(), 128);
+}
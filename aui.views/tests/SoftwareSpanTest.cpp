@@ -0,0 +1,122 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+#include <random>
+#include "AUI/Software/SoftwareSpan.h"
+
+namespace {
+
+constexpr std::size_t LENGTH = 67;   // not a multiple of SIMD width
+constexpr std::uint8_t STENCIL_DEPTH = 1;
+
+struct Row {
+    std::vector<std::uint8_t> pixels;
+    std::vector<std::uint8_t> stencil;
+
+    aui::software::Span span() {
+        return { pixels.data(), stencil.data(), LENGTH };
+    }
+};
+
+/**
+ * Framebuffer row covering all alpha classes the NORMAL blending distinguishes: mostly opaque runs, transparent and
+ * translucent pixels, and pixels masked out by the stencil.
+ */
+Row randomRow(std::mt19937& random) {
+    Row row { std::vector<std::uint8_t>(LENGTH * 4), std::vector<std::uint8_t>(LENGTH, STENCIL_DEPTH) };
+    for (std::size_t i = 0; i < LENGTH; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            row.pixels[i * 4 + c] = random() % 256;
+        }
+        switch (random() % 8) {
+            case 0: row.pixels[i * 4 + 3] = 0; break;
+            case 1: row.pixels[i * 4 + 3] = random() % 256; break;
+            default: row.pixels[i * 4 + 3] = 255; break;
+        }
+        if (random() % 16 == 0) {
+            row.stencil[i] = 0;
+        }
+    }
+    return row;
+}
+
+AColor randomColor(std::mt19937& random) {
+    std::uniform_real_distribution<float> d(-0.1f, 1.1f);   // out of range values are clamped
+    return { d(random), d(random), d(random), d(random) };
+}
+
+/**
+ * The reference: SoftwareRenderer::putPixel for each pixel.
+ */
+void reference(Row& row, const AColor* colors, Blending blending) {
+    for (std::size_t i = 0; i < LENGTH; ++i) {
+        if (row.stencil[i] != STENCIL_DEPTH) {
+            continue;
+        }
+        auto p = row.pixels.data() + i * 4;
+        auto color = glm::clamp(colors[i], glm::vec4(0), glm::vec4(1));
+        auto result = aui::software::blendPixel({ p[2], p[1], p[0], p[3] }, color, blending);
+        p[0] = result[2];
+        p[1] = result[1];
+        p[2] = result[0];
+        p[3] = result[3];
+    }
+}
+
+constexpr Blending BLENDINGS[] = { Blending::NORMAL, Blending::ADDITIVE, Blending::INVERSE_DST, Blending::INVERSE_SRC };
+
+}   // namespace
+
+TEST(SoftwareSpan, FillMatchesReference) {
+    std::mt19937 random(0);
+    for (auto blending : BLENDINGS) {
+        for (int iteration = 0; iteration < 200; ++iteration) {
+            auto color = randomColor(random);
+            if (iteration % 4 == 0) {
+                color.a = 1.f;
+            }
+            auto actual = randomRow(random);
+            auto expected = actual;
+            aui::software::fill(actual.span(), STENCIL_DEPTH, glm::clamp(color, glm::vec4(0), glm::vec4(1)), blending);
+            std::vector<AColor> colors(LENGTH, color);
+            reference(expected, colors.data(), blending);
+            ASSERT_EQ(actual.pixels, expected.pixels) << "blending " << int(blending) << " iteration " << iteration;
+        }
+    }
+}
+
+TEST(SoftwareSpan, BlendMatchesReference) {
+    std::mt19937 random(1);
+    for (auto blending : BLENDINGS) {
+        for (int iteration = 0; iteration < 200; ++iteration) {
+            std::vector<AColor> colors(LENGTH);
+            for (auto& c : colors) {
+                c = randomColor(random);
+            }
+            auto actual = randomRow(random);
+            auto expected = actual;
+            aui::software::blend(actual.span(), STENCIL_DEPTH, colors.data(), blending);
+            reference(expected, colors.data(), blending);
+            ASSERT_EQ(actual.pixels, expected.pixels) << "blending " << int(blending) << " iteration " << iteration;
+        }
+    }
+}
+
+TEST(SoftwareSpan, Stencil) {
+    Row row { std::vector<std::uint8_t>(LENGTH * 4), std::vector<std::uint8_t>(LENGTH, 0) };
+    std::vector<AColor> colors(LENGTH, AColor(1, 1, 1, 0.f));
+    colors[3].a = 1.f;
+    aui::software::stencil(row.span(), 1, colors.data());
+    aui::software::stencil(row.span(), 1, nullptr);
+    EXPECT_EQ(row.stencil[2], 1);
+    EXPECT_EQ(row.stencil[3], 2);
+}
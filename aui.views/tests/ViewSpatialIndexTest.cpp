@@ -0,0 +1,82 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+#include <random>
+#include "AUI/Util/AViewSpatialIndex.h"
+
+namespace {
+ARect<int> randomRect(std::mt19937& random, int maxSize) {
+    std::uniform_int_distribution<int> position(-1000, 1000);
+    std::uniform_int_distribution<int> size(0, maxSize);
+    return ARect<int>::fromTopLeftPositionAndSize({ position(random), position(random) },
+                                                  { size(random), size(random) });
+}
+
+AVector<std::size_t> intersecting(const AVector<ARect<int>>& rects, ARect<int> area) {
+    AVector<std::size_t> result;
+    for (std::size_t i = 0; i < rects.size(); ++i) {
+        if (glm::all(glm::lessThanEqual(rects[i].min(), area.max())) &&
+            glm::all(glm::lessThanEqual(area.min(), rects[i].max()))) {
+            result << i;
+        }
+    }
+    return result;
+}
+}   // namespace
+
+TEST(ViewSpatialIndex, Point) {
+    AViewSpatialIndex index(100);
+    index.rebuild({
+        { .p1 = { 0, 0 }, .p2 = { 50, 50 } },
+        { .p1 = { 150, 150 }, .p2 = { 250, 250 } },
+        { .p1 = { -50, -50 }, .p2 = { -10, -10 } },
+    });
+    EXPECT_EQ(index.query({ .p1 = { 10, 10 }, .p2 = { 10, 10 } }), AVector<std::size_t>({ 0 }));
+    EXPECT_EQ(index.query({ .p1 = { 210, 210 }, .p2 = { 210, 210 } }), AVector<std::size_t>({ 1 }));
+    EXPECT_EQ(index.query({ .p1 = { -20, -20 }, .p2 = { -20, -20 } }), AVector<std::size_t>({ 2 }));
+
+    index.update(0, { .p1 = { 300, 300 }, .p2 = { 310, 310 } });
+    EXPECT_TRUE(index.query({ .p1 = { 10, 10 }, .p2 = { 10, 10 } }).empty());
+    EXPECT_EQ(index.query({ .p1 = { 305, 305 }, .p2 = { 305, 305 } }), AVector<std::size_t>({ 0 }));
+}
+
+TEST(ViewSpatialIndex, SupersetOfIntersecting) {
+    std::mt19937 random(0);
+    AVector<ARect<int>> rects;
+    for (int i = 0; i < 2000; ++i) {
+        // some rects are oversized
+        rects << randomRect(random, i % 100 == 0 ? 5000 : 100);
+    }
+    AViewSpatialIndex index(64);
+    index.rebuild(rects);
+
+    auto check = [&] {
+        for (int i = 0; i < 200; ++i) {
+            auto area = randomRect(random, i % 2 == 0 ? 0 : 200);
+            auto result = index.query(area);
+            EXPECT_TRUE(std::is_sorted(result.begin(), result.end()));
+            for (auto expected : intersecting(rects, area)) {
+                ASSERT_TRUE(std::binary_search(result.begin(), result.end(), expected)) << expected;
+            }
+            // the index is useful
+            EXPECT_LT(result.size(), rects.size() / 4);
+        }
+    };
+    check();
+
+    for (int i = 0; i < 1000; ++i) {
+        auto item = std::uniform_int_distribution<std::size_t>(0, rects.size() - 1)(random);
+        rects[item] = randomRect(random, item % 100 == 0 ? 5000 : 100);
+        index.update(item, rects[item]);
+    }
+    check();
+}
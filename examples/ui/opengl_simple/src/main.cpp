@@ -100,6 +100,7 @@ public:
 
     void render(ARenderContext ctx) override {
         AView::render(ctx);
+        ctx.render.flush();
         cleanupAUIGLState();
 
         // Draw triangle